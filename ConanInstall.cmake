@@ -52,6 +52,8 @@ if(NOT CONAN_OPENSTUDIO_ALREADY_RUN)
   endif()
 
   list(APPEND CONAN_OPTIONS "zlib:minizip=True")
+  # LocalBCL uses full text search when available
+  list(APPEND CONAN_OPTIONS "sqlite3:enable_fts5=True")
   # TODO:  list(APPEND CONAN_OPTIONS "fmt:header_only=True")
 
   # You do want to rebuild packages if there's a newer recipe in the remote (which applies mostly to our own openstudio_ruby where we don't
@@ -77,14 +77,20 @@ end
 
 class MeasureManager
 
+  # default number of models kept loaded by get_model, least recently used models are evicted first
+  DEFAULT_MAX_CACHED_MODELS = 16
+
   attr_reader :osms, :measures, :measure_info
+  attr_accessor :max_cached_models
 
-  def initialize(logger=nil)
+  def initialize(logger=nil, max_cached_models=DEFAULT_MAX_CACHED_MODELS)
     @logger = logger
-    @osms = {} # osm_path => {:checksum, :model, :workspace}
+    @max_cached_models = max_cached_models
+    @osms = {} # osm_path => {:checksum, :mtime, :size, :model, :workspace}, ordered from least to most recently used
     @idfs = {} # idf_path => {:checksum, :workspace}
     @measures = {} # measure_dir => BCLMeasure
     @measure_info = {} # measure_dir => {osm_path => RubyUserScriptInfo}
+    @measure_info_checksums = {} # measure_dir => directory checksum the cached RubyUserScriptInfo were computed with
 
     eval(OpenStudio::Ruleset::infoExtractorRubyFunction)
   end
@@ -123,33 +129,70 @@ class MeasureManager
     @idfs = {}
     @measures = {}
     @measure_info = {}
+    @measure_info_checksums = {}
+  end
+
+  # returns a checksum of the measure directory, computed from the file checksums recorded in measure.xml
+  # get_measure keeps these up to date so this does not need to re-read every file in the directory
+  def measure_dir_checksum(measure)
+    checksums = [measure.xmlChecksum]
+    measure.files.each do |file|
+      checksums << "#{file.path.to_s}:#{file.checksum}"
+    end
+    return OpenStudio::checksum(checksums.join("\n"))
+  end
+
+  # moves the model at osm_path to the most recently used position and evicts models over max_cached_models
+  def touch_model(osm_path)
+    value = @osms.delete(osm_path)
+    @osms[osm_path] = value
+
+    if @max_cached_models && @max_cached_models > 0
+      while @osms.size > @max_cached_models
+        evicted_path, _ = @osms.first
+        print_message("Evicting cached model '#{evicted_path}'")
+        @osms.delete(evicted_path)
+        @measure_info.each_value {|info| info.delete(evicted_path)}
+      end
+    end
   end
 
   # returns nil or [OpenStudio::Model::Model, OpenStudio::Workspace]
   # force_reload forces the model to be read from disk, should never be needed
+  # cached models are keyed by path and modification time, the checksum is only computed when these change
   def get_model(osm_path, force_reload)
 
     # check if model exists on disk
     if !File.exist?(osm_path)
       print_message("Model '#{osm_path}' does not exist")
-      @osms[osm_path] = nil
+      @osms.delete(osm_path)
       @measure_info.each_value {|value| value[osm_path] = nil}
-      force_reload = true
+      return nil
     end
 
-    current_checksum = OpenStudio::checksum(OpenStudio::toPath(osm_path))
+    stat = File.stat(osm_path)
+    current_checksum = nil
 
     result = nil
     if !force_reload
       # load from cache
       temp = @osms[osm_path]
       if temp
+        if temp[:mtime] == stat.mtime && temp[:size] == stat.size
+          current_checksum = temp[:checksum]
+        else
+          current_checksum = OpenStudio::checksum(OpenStudio::toPath(osm_path))
+        end
+
         last_checksum = temp[:checksum]
         if last_checksum && current_checksum == last_checksum
           model = temp[:model]
           workspace = temp[:workspace]
           if model && workspace
             result = [model, workspace]
+            temp[:mtime] = stat.mtime
+            temp[:size] = stat.size
+            touch_model(osm_path)
             print_message("Using cached model '#{osm_path}'")
           end
         else
@@ -159,6 +202,8 @@ class MeasureManager
     end
 
     if !result
+      current_checksum = OpenStudio::checksum(OpenStudio::toPath(osm_path)) if current_checksum.nil?
+
       # load from disk
       print_message("Attempting to load model '#{osm_path}'")
       vt = OpenStudio::OSVersion::VersionTranslator.new
@@ -166,17 +211,18 @@ class MeasureManager
 
       if model.empty?
         print_message("Failed to load model '#{osm_path}'")
-        @osms[osm_path] = nil
+        @osms.delete(osm_path)
       else
         print_message("Successfully loaded model '#{osm_path}'")
         model = model.get
         ft = OpenStudio::EnergyPlus::ForwardTranslator.new
         workspace = ft.translateModel(model)
-        @osms[osm_path] = {:checksum => current_checksum, :model => model, :workspace => workspace}
+        @osms[osm_path] = {:checksum => current_checksum, :mtime => stat.mtime, :size => stat.size, :model => model, :workspace => workspace}
         result = [model, workspace]
       end
 
       @measure_info.each_value {|value| value[osm_path] = nil}
+      touch_model(osm_path) if result
     end
 
     return result
@@ -363,6 +409,13 @@ class MeasureManager
 
     result = nil
 
+    # cached info is only valid for the measure directory contents it was computed with
+    dir_checksum = measure_dir_checksum(measure)
+    if @measure_info_checksums[measure_dir] != dir_checksum
+      @measure_info[measure_dir] = {}
+      @measure_info_checksums[measure_dir] = dir_checksum
+    end
+
     # load from cache
     temp = @measure_info[measure_dir]
     if temp
@@ -35,12 +35,13 @@ require_relative 'measure_manager'
 class MeasureManagerServlet < WEBrick::HTTPServlet::AbstractServlet
 
   @@instance = nil
+  @@max_cached_models = MeasureManager::DEFAULT_MAX_CACHED_MODELS
 
   def initialize(server)
     super
     @mutex = Mutex.new
     #print_message("new @mutex = #{@mutex}")
-    @measure_manager = MeasureManager.new
+    @measure_manager = MeasureManager.new(nil, @@max_cached_models)
     @my_measures_dir = File.join(Dir.home, "OpenStudio/Measures/").to_s
   end
 
@@ -53,6 +54,11 @@ class MeasureManagerServlet < WEBrick::HTTPServlet::AbstractServlet
     return @@instance
   end
 
+  # number of loaded models each servlet keeps warm, must be set before the first request
+  def self.max_cached_models=(value)
+    @@max_cached_models = value
+  end
+
   def do_GET(request, response)
 
     begin
@@ -63,7 +69,7 @@ class MeasureManagerServlet < WEBrick::HTTPServlet::AbstractServlet
       response.status = 200
       response.content_type = 'application/json'
 
-      result = {:status => "running", :my_measures_dir => @my_measures_dir}
+      result = {:status => "running", :my_measures_dir => @my_measures_dir, :pid => Process.pid}
 
       case request.path
       when "/"
@@ -362,3 +368,132 @@ class MeasureManagerServlet < WEBrick::HTTPServlet::AbstractServlet
   end
 
 end
+
+# Runs the measure manager server, either in the current process or as a pool of preforked workers.
+# Workers share the listening socket, the kernel hands each connection to one of them. Each worker keeps
+# its own warm cache of loaded models and measure info, so requests for the same model are served
+# without reloading it once a worker has seen it. State set through /set or /reset only applies to the
+# worker that handled the request.
+class MeasureManagerServer
+
+  # a worker that dies again soon after being restarted waits before its next restart, the wait starts at
+  # MIN_RESTART_DELAY seconds and doubles up to MAX_RESTART_DELAY, it is reset once a worker stays up for HEALTHY_UPTIME
+  MIN_RESTART_DELAY = 0.5
+  MAX_RESTART_DELAY = 30.0
+  HEALTHY_UPTIME = 60.0
+
+  def initialize(port, num_workers = 1, max_cached_models = MeasureManager::DEFAULT_MAX_CACHED_MODELS)
+    @port = port
+    @num_workers = num_workers
+    @max_cached_models = max_cached_models
+    @workers = {} # pid => worker index
+    @started_at = {} # worker index => monotonic time it was last started
+    @restart_delays = {} # worker index => seconds waited before its last restart
+    @stopping = false
+  end
+
+  def self.fork_supported?
+    return Process.respond_to?(:fork) && !Gem.win_platform?
+  end
+
+  def print_message(message)
+    puts message
+  end
+
+  def start
+    MeasureManagerServlet.max_cached_models = @max_cached_models
+
+    server = WEBrick::HTTPServer.new(:Port => @port)
+    server.mount "/", MeasureManagerServlet
+
+    if @num_workers <= 1 || !MeasureManagerServer.fork_supported?
+      if @num_workers > 1
+        print_message("Worker pool is not supported on this platform, starting a single server")
+      end
+
+      trap("INT") {
+        server.shutdown
+      }
+
+      server.start
+      return
+    end
+
+    print_message("Starting #{@num_workers} measure manager workers on port #{@port}")
+    @num_workers.times { |i| spawn_worker(server, i) }
+
+    ["INT", "TERM"].each do |signal|
+      trap(signal) {
+        @stopping = true
+        @workers.each_key do |pid|
+          begin
+            Process.kill("TERM", pid)
+          rescue Errno::ESRCH
+          end
+        end
+      }
+    end
+
+    # restart workers that die until we are asked to stop
+    until @workers.empty?
+      begin
+        pid, status = Process.wait2
+      rescue Errno::ECHILD
+        break
+      rescue Errno::EINTR
+        next
+      end
+
+      index = @workers.delete(pid)
+      if !@stopping && index
+        delay = restart_delay(index)
+        print_message("Measure manager worker #{pid} exited with #{status.exitstatus}, restarting in #{delay} seconds")
+        wait_unless_stopping(delay)
+        spawn_worker(server, index) if !@stopping
+      end
+    end
+
+    server.shutdown
+  end
+
+  private
+
+  def now
+    return Process.clock_gettime(Process::CLOCK_MONOTONIC)
+  end
+
+  def restart_delay(index)
+    if now - @started_at[index] >= HEALTHY_UPTIME
+      @restart_delays[index] = 0.0
+    else
+      @restart_delays[index] = [[2 * (@restart_delays[index] || 0.0), MIN_RESTART_DELAY].max, MAX_RESTART_DELAY].min
+    end
+    return @restart_delays[index]
+  end
+
+  # sleeps in short steps so a stop request does not wait for the whole delay
+  def wait_unless_stopping(seconds)
+    deadline = now + seconds
+    while !@stopping && now < deadline
+      sleep([deadline - now, 0.1].min)
+    end
+  end
+
+  def spawn_worker(server, index)
+    pid = fork do
+      ["INT", "TERM"].each do |signal|
+        trap(signal) {
+          server.shutdown
+        }
+      end
+
+      server.start
+      exit!(0)
+    end
+
+    @workers[pid] = index
+    @started_at[index] = now
+    return pid
+  end
+
+end
@@ -1228,7 +1228,7 @@ class Measure
     # find the directory
     directory = nil
     if sub_argv.size > 1
-      unless (sub_argv[0] == '-s' || sub_argv[0] == '--start_server')
+      unless (sub_argv.include?('-s') || sub_argv.include?('--start_server'))
         directory = sub_argv.pop
         $logger.debug("Directory to examine is #{directory}")
         $logger.debug("Remaining args are #{sub_argv}")
@@ -1258,6 +1258,12 @@ class Measure
         options[:start_server] = true
         options[:start_server_port] = port
       end
+      o.on('-w', '--workers N', Integer, 'Number of preforked measure manager server workers, default 1') do |num_workers|
+        options[:start_server_workers] = num_workers
+      end
+      o.on('--max_cached_models N', Integer, 'Number of loaded models each measure manager server worker keeps in memory') do |max_cached_models|
+        options[:start_server_max_cached_models] = max_cached_models
+      end
       # TODO: run unit tests
     end
 
@@ -1408,14 +1414,17 @@ class Measure
         port = 1234
       end
 
-      server = WEBrick::HTTPServer.new(:Port => port)
-
-      server.mount "/", MeasureManagerServlet
+      num_workers = options[:start_server_workers]
+      if num_workers.nil? || num_workers < 1
+        num_workers = 1
+      end
 
-      trap("INT") {
-          server.shutdown
-      }
+      max_cached_models = options[:start_server_max_cached_models]
+      if max_cached_models.nil?
+        max_cached_models = MeasureManager::DEFAULT_MAX_CACHED_MODELS
+      end
 
+      server = MeasureManagerServer.new(port, num_workers, max_cached_models)
       server.start
 
     else
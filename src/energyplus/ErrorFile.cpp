@@ -29,17 +29,194 @@
 
 #include "ErrorFile.hpp"
 
-#include <boost/regex.hpp>
-#include <boost/algorithm/string.hpp>
+#include "../utilities/core/Filesystem.hpp"
+
+#include <boost/iostreams/device/mapped_file.hpp>
+
+#include <string_view>
+#include <unordered_map>
 
 namespace openstudio {
 namespace energyplus {
 
+  namespace {
+
+    // same characters as \s in the regexes this parser replaced
+    bool isSpace(char c) {
+      return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r';
+    }
+
+    bool isAlpha(char c) {
+      return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+    }
+
+    std::string_view skipSpaces(std::string_view s) {
+      size_t i = 0;
+      while (i < s.size() && isSpace(s[i])) {
+        ++i;
+      }
+      return s.substr(i);
+    }
+
+    std::string_view trimRight(std::string_view s) {
+      size_t n = s.size();
+      while (n > 0 && isSpace(s[n - 1])) {
+        --n;
+      }
+      return s.substr(0, n);
+    }
+
+    std::string_view trim(std::string_view s) {
+      return trimRight(skipSpaces(s));
+    }
+
+    bool startsWith(std::string_view s, std::string_view prefix) {
+      return s.substr(0, prefix.size()) == prefix;
+    }
+
+    // matches ^\s*\**\s+\*\* and passes the rest of the line to f, tries the same alternatives as the regex did
+    template <typename F>
+    bool matchMessagePrefix(std::string_view line, F f) {
+      std::string_view afterSpaces = skipSpaces(line);
+      size_t numStars = 0;
+      while (numStars < afterSpaces.size() && afterSpaces[numStars] == '*') {
+        ++numStars;
+      }
+      if (numStars > 0) {
+        std::string_view afterStars = afterSpaces.substr(numStars);
+        std::string_view afterSpaces2 = skipSpaces(afterStars);
+        if (afterSpaces2.size() < afterStars.size() && startsWith(afterSpaces2, "**") && f(afterSpaces2.substr(2))) {
+          return true;
+        }
+      }
+      if (afterSpaces.size() < line.size() && startsWith(afterSpaces, "**")) {
+        return f(afterSpaces.substr(2));
+      }
+      return false;
+    }
+
+    // matches ^\s*\**\s+\*\*\s*([[:alpha:]]+)\s*\*\*(.*)$
+    bool matchWarningOrError(std::string_view line, std::string_view& type, std::string_view& message) {
+      return matchMessagePrefix(line, [&](std::string_view rest) {
+        rest = skipSpaces(rest);
+        size_t n = 0;
+        while (n < rest.size() && isAlpha(rest[n])) {
+          ++n;
+        }
+        if (n == 0) {
+          return false;
+        }
+        std::string_view afterType = skipSpaces(rest.substr(n));
+        if (!startsWith(afterType, "**")) {
+          return false;
+        }
+        type = rest.substr(0, n);
+        message = afterType.substr(2);
+        return true;
+      });
+    }
+
+    // matches ^\s*\**\s+\*\*\s*~~~\s*\*\*(.*)$
+    bool matchWarningOrErrorContinue(std::string_view line, std::string_view& message) {
+      return matchMessagePrefix(line, [&](std::string_view rest) {
+        rest = skipSpaces(rest);
+        if (!startsWith(rest, "~~~")) {
+          return false;
+        }
+        rest = skipSpaces(rest.substr(3));
+        if (!startsWith(rest, "**")) {
+          return false;
+        }
+        message = rest.substr(2);
+        return true;
+      });
+    }
+
+    // matches ^\s*\*+ and returns the rest of the line
+    bool matchStatusPrefix(std::string_view line, std::string_view& rest) {
+      std::string_view afterSpaces = skipSpaces(line);
+      size_t numStars = 0;
+      while (numStars < afterSpaces.size() && afterSpaces[numStars] == '*') {
+        ++numStars;
+      }
+      rest = afterSpaces.substr(numStars);
+      return numStars > 0;
+    }
+
+    bool matchCompletedSuccessfully(std::string_view line) {
+      std::string_view rest;
+      if (!matchStatusPrefix(line, rest)) {
+        return false;
+      }
+      if (startsWith(rest, " EnergyPlus Completed Successfully")) {
+        return true;
+      }
+      // GroundTempCalc\S* Completed Successfully
+      if (startsWith(rest, " GroundTempCalc")) {
+        rest.remove_prefix(15);
+        while (!rest.empty() && !isSpace(rest.front())) {
+          rest.remove_prefix(1);
+        }
+        return startsWith(rest, " Completed Successfully");
+      }
+      return false;
+    }
+
+    bool matchCompletedUnsuccessfully(std::string_view line) {
+      std::string_view rest;
+      return matchStatusPrefix(line, rest) && startsWith(rest, " EnergyPlus Terminated");
+    }
+
+    /// collects the messages of one error level, optionally merging repeated messages
+    class MessageList
+    {
+     public:
+      MessageList(std::vector<std::string>& messages, std::vector<unsigned>& counts, bool aggregateDuplicates)
+        : m_messages(messages), m_counts(counts), m_aggregateDuplicates(aggregateDuplicates) {}
+
+      void add(std::string message) {
+        if (m_aggregateDuplicates) {
+          auto it = m_indices.find(message);
+          if (it != m_indices.end()) {
+            ++m_counts[it->second];
+            return;
+          }
+          m_indices.emplace(message, m_messages.size());
+        }
+        m_messages.push_back(std::move(message));
+        m_counts.push_back(1);
+      }
+
+     private:
+      std::vector<std::string>& m_messages;
+      std::vector<unsigned>& m_counts;
+      bool m_aggregateDuplicates;
+      std::unordered_map<std::string, size_t> m_indices;
+    };
+
+  }  // namespace
+
   /// constructor
-  ErrorFile::ErrorFile(const openstudio::path& errPath) : m_completed(false), m_completedSuccessfully(false) {
-    openstudio::filesystem::ifstream ifs(errPath);
-    parse(ifs);
-    ifs.close();
+  ErrorFile::ErrorFile(const openstudio::path& errPath, bool aggregateDuplicates) : m_completed(false), m_completedSuccessfully(false) {
+    if (!openstudio::filesystem::is_regular_file(errPath)) {
+      return;
+    }
+
+    // a memory mapped file cannot be empty
+    if (openstudio::filesystem::file_size(errPath) == 0) {
+      return;
+    }
+
+    boost::iostreams::mapped_file_source file;
+    try {
+      file.open(openstudio::toSystemFilename(errPath));
+    } catch (const std::exception& e) {
+      LOG(Error, "Could not map error file '" << toString(errPath) << "': " << e.what());
+      return;
+    }
+
+    parse(file.data(), file.data() + file.size(), aggregateDuplicates);
+    file.close();
   }
 
   /// get warnings
@@ -57,6 +234,18 @@ namespace energyplus {
     return m_fatalErrors;
   }
 
+  std::vector<unsigned> ErrorFile::warningCounts() const {
+    return m_warningCounts;
+  }
+
+  std::vector<unsigned> ErrorFile::severeErrorCounts() const {
+    return m_severeErrorCounts;
+  }
+
+  std::vector<unsigned> ErrorFile::fatalErrorCounts() const {
+    return m_fatalErrorCounts;
+  }
+
   /// did EnergyPlus complete or crash
   bool ErrorFile::completed() const {
     return m_completed;
@@ -67,59 +256,50 @@ namespace energyplus {
     return m_completedSuccessfully;
   }
 
-  void ErrorFile::parse(openstudio::filesystem::ifstream& is) {
-    std::string line;
+  void ErrorFile::parse(const char* begin, const char* end, bool aggregateDuplicates) {
+    MessageList warnings(m_warnings, m_warningCounts, aggregateDuplicates);
+    MessageList severeErrors(m_severeErrors, m_severeErrorCounts, aggregateDuplicates);
+    MessageList fatalErrors(m_fatalErrors, m_fatalErrorCounts, aggregateDuplicates);
 
-    // matches[1], warning/error type
-    // matches[2], rest of line
-    boost::regex warningOrError("^\\s*\\**\\s+\\*\\*\\s*([[:alpha:]]+)\\s*\\*\\*(.*)$");
+    std::string_view remaining(begin, end - begin);
+    std::string_view line;
 
-    // matches[1], rest of line
-    boost::regex warningOrErrorContinue("^\\s*\\**\\s+\\*\\*\\s*~~~\\s*\\*\\*(.*)$");
-
-    // completed successfully
-    boost::regex completedSuccessful("^\\s*\\*+ EnergyPlus Completed Successfully.*");
-
-    // ground temp completed successfully
-    boost::regex groundTempCompletedSuccessful("^\\s*\\*+ GroundTempCalc\\S* Completed Successfully.*");
-
-    // completed unsuccessfully
-    boost::regex completedUnsuccessful("^\\s*\\*+ EnergyPlus Terminated.*");
-
-    // repeat count
+    // same lines as std::getline
+    auto getLine = [&remaining, &line]() {
+      if (remaining.empty()) {
+        return false;
+      }
+      size_t lineEnd = remaining.find('\n');
+      line = remaining.substr(0, lineEnd);
+      remaining.remove_prefix(lineEnd == std::string_view::npos ? remaining.size() : lineEnd + 1);
+      return true;
+    };
 
-    // read the file line by line using regexes
+    // read the file line by line, dispatching on the leading asterisks
     bool alreadyGotLine = false;
 
-    while (alreadyGotLine || std::getline(is, line)) {
+    while (alreadyGotLine || getLine()) {
 
       alreadyGotLine = false;
-      boost::smatch matches;
 
       LOG(Debug, "Parsing ErrorFile Line '" << line << "'");
 
-      // parse the file
-      if (boost::regex_search(line, matches, warningOrError)) {
+      std::string_view type;
+      std::string_view message;
+      if (matchWarningOrError(line, type, message)) {
 
-        std::string warningOrErrorType = std::string(matches[1].first, matches[1].second);
-        boost::trim(warningOrErrorType);
-        std::string warningOrErrorString = std::string(matches[2].first, matches[2].second);
-        boost::trim(warningOrErrorString);
+        std::string warningOrErrorType(trim(type));
+        std::string warningOrErrorString(trim(message));
 
         // read the rest of the multi line warning or error
         while (true) {
-          // std::streampos pos = is.tellg();
-          if (!std::getline(is, line)) {
+          if (!getLine()) {
             break;
           }
-          if (boost::regex_search(line, matches, warningOrErrorContinue)) {
-            std::string temp = std::string(matches[1].first, matches[1].second);
-            boost::trim_right(temp);
-            warningOrErrorString += "\n" + temp;
+          if (matchWarningOrErrorContinue(line, message)) {
+            warningOrErrorString += '\n';
+            warningOrErrorString += trimRight(message);
           } else {
-            // unget the line
-            // is.seekg(pos);
-            // Instead of rewind then reread (which fails on Windows if you have LF line endings)
             // We just use this bool to avoid having to re-read the line.
             alreadyGotLine = true;
             break;
@@ -129,30 +309,38 @@ namespace energyplus {
         LOG(Trace, "Error parsed: " << warningOrErrorString);
 
         // correctly sort warnings and errors
-        try {
-          ErrorLevel level(warningOrErrorType);
-
-          switch (level.value()) {
-            case ErrorLevel::Warning:
-              m_warnings.push_back(warningOrErrorString);
-              break;
-            case ErrorLevel::Severe:
-              m_severeErrors.push_back(warningOrErrorString);
-              break;
-            case ErrorLevel::Fatal:
-              m_fatalErrors.push_back(warningOrErrorString);
-              break;
-          }
+        if (warningOrErrorType == "Warning") {
+          warnings.add(std::move(warningOrErrorString));
+        } else if (warningOrErrorType == "Severe") {
+          severeErrors.add(std::move(warningOrErrorString));
+        } else if (warningOrErrorType == "Fatal") {
+          fatalErrors.add(std::move(warningOrErrorString));
+        } else {
+          try {
+            ErrorLevel level(warningOrErrorType);
 
-        } catch (...) {
-          LOG(Error, "Unknown warning or error level '" << warningOrErrorType << "'");
+            switch (level.value()) {
+              case ErrorLevel::Warning:
+                warnings.add(std::move(warningOrErrorString));
+                break;
+              case ErrorLevel::Severe:
+                severeErrors.add(std::move(warningOrErrorString));
+                break;
+              case ErrorLevel::Fatal:
+                fatalErrors.add(std::move(warningOrErrorString));
+                break;
+            }
+
+          } catch (...) {
+            LOG(Error, "Unknown warning or error level '" << warningOrErrorType << "'");
+          }
         }
 
-      } else if (boost::regex_match(line, completedSuccessful) || boost::regex_match(line, groundTempCompletedSuccessful)) {
+      } else if (matchCompletedSuccessfully(line)) {
         m_completed = true;
         m_completedSuccessfully = true;
         break;
-      } else if (boost::regex_match(line, completedUnsuccessful)) {
+      } else if (matchCompletedUnsuccessfully(line)) {
         m_completed = true;
         m_completedSuccessfully = false;
         break;
@@ -57,8 +57,8 @@ namespace energyplus {
   class ENERGYPLUS_API ErrorFile
   {
    public:
-    /// constructor
-    ErrorFile(const openstudio::path& errPath);
+    /// constructor, if aggregateDuplicates is true each distinct message is stored once along with the number of times it occurred
+    ErrorFile(const openstudio::path& errPath, bool aggregateDuplicates = false);
 
     /// get warnings
     std::vector<std::string> warnings() const;
@@ -69,6 +69,15 @@ namespace energyplus {
     /// get fatal errors
     std::vector<std::string> fatalErrors() const;
 
+    /// number of occurrences of each warning, all ones unless duplicates were aggregated
+    std::vector<unsigned> warningCounts() const;
+
+    /// number of occurrences of each severe error, all ones unless duplicates were aggregated
+    std::vector<unsigned> severeErrorCounts() const;
+
+    /// number of occurrences of each fatal error, all ones unless duplicates were aggregated
+    std::vector<unsigned> fatalErrorCounts() const;
+
     /// did EnergyPlus complete or crash
     bool completed() const;
 
@@ -78,11 +87,14 @@ namespace energyplus {
    private:
     REGISTER_LOGGER("energyplus.ErrorFile");
 
-    void parse(openstudio::filesystem::ifstream& is);
+    void parse(const char* begin, const char* end, bool aggregateDuplicates);
 
     std::vector<std::string> m_warnings;
     std::vector<std::string> m_severeErrors;
     std::vector<std::string> m_fatalErrors;
+    std::vector<unsigned> m_warningCounts;
+    std::vector<unsigned> m_severeErrorCounts;
+    std::vector<unsigned> m_fatalErrorCounts;
     bool m_completed;
     bool m_completedSuccessfully;
   };
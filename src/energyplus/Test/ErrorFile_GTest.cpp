@@ -114,3 +114,40 @@ TEST_F(EnergyPlusFixture, ErrorFile_WarningsAndCrash) {
   EXPECT_FALSE(errorFile.completed());
   EXPECT_FALSE(errorFile.completedSuccessfully());
 }
+
+TEST_F(EnergyPlusFixture, ErrorFile_AggregateDuplicates) {
+  openstudio::path path = openstudio::toPath("ErrorFile_AggregateDuplicates.err");
+  {
+    std::ofstream ofs(openstudio::toSystemFilename(path), std::ios_base::binary);
+    ofs << "Program Version,EnergyPlus\r\n"
+        << "   ** Warning ** Repeated warning\r\n"
+        << "   **   ~~~   ** with a continuation   \r\n"
+        << "   ** Severe  ** A severe error\r\n"
+        << "   ** Warning ** Repeated warning\r\n"
+        << "   **   ~~~   ** with a continuation\r\n"
+        << "   ** Warning ** Repeated warning\r\n"
+        << "   ** Warning ** Repeated warning\r\n"
+        << "   **   ~~~   ** with a continuation\r\n"
+        << "   ************* EnergyPlus Completed Successfully-- 4 Warning; 1 Severe Errors; Elapsed Time=00hr 00min  1.00sec\r\n";
+  }
+
+  ErrorFile errorFile(path);
+  ASSERT_EQ(4u, errorFile.warnings().size());
+  EXPECT_EQ("Repeated warning\n with a continuation", errorFile.warnings()[0]);
+  EXPECT_EQ("Repeated warning", errorFile.warnings()[2]);
+  EXPECT_EQ(std::vector<unsigned>(4, 1u), errorFile.warningCounts());
+  ASSERT_EQ(1u, errorFile.severeErrors().size());
+  EXPECT_EQ("A severe error", errorFile.severeErrors()[0]);
+  EXPECT_TRUE(errorFile.completedSuccessfully());
+
+  ErrorFile aggregated(path, true);
+  ASSERT_EQ(2u, aggregated.warnings().size());
+  EXPECT_EQ("Repeated warning\n with a continuation", aggregated.warnings()[0]);
+  EXPECT_EQ("Repeated warning", aggregated.warnings()[1]);
+  EXPECT_EQ(std::vector<unsigned>({3u, 1u}), aggregated.warningCounts());
+  ASSERT_EQ(1u, aggregated.severeErrors().size());
+  EXPECT_EQ(std::vector<unsigned>({1u}), aggregated.severeErrorCounts());
+  EXPECT_TRUE(aggregated.fatalErrorCounts().empty());
+  EXPECT_TRUE(aggregated.completed());
+  EXPECT_TRUE(aggregated.completedSuccessfully());
+}
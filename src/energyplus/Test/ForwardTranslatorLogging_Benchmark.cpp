@@ -0,0 +1,96 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2021, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include "../ForwardTranslator.hpp"
+
+#include "../../model/Model.hpp"
+#include "../../model/Space.hpp"
+#include "../../model/Space_Impl.hpp"
+#include "../../model/ThermalZone.hpp"
+
+#include "../../utilities/core/Logger.hpp"
+#include "../../utilities/core/StringStreamLogSink.hpp"
+#include "../../utilities/idf/Workspace.hpp"
+
+#include <memory>
+
+using namespace openstudio;
+using namespace openstudio::model;
+
+// example model with its spaces copied numCopies times, each copy in its own thermal zone
+static Model largeModel(int numCopies) {
+  Model model = exampleModel();
+  std::vector<Space> spaces = model.getConcreteModelObjects<Space>();
+  for (int i = 0; i < numCopies; ++i) {
+    for (const Space& space : spaces) {
+      Space copy = space.clone(model).cast<Space>();
+      ThermalZone zone(model);
+      copy.setThermalZone(zone);
+    }
+  }
+  return model;
+}
+
+// translate with no sink accepting Debug or Trace messages, LOG sites below Warn are skipped before formatting
+static void BM_ForwardTranslatorLoggingDisabled(benchmark::State& state) {
+  Logger::instance().standardOutLogger().disable();
+  Model model = largeModel(state.range(0));
+
+  for (auto _ : state) {
+    energyplus::ForwardTranslator ft;
+    Workspace workspace = ft.translateModel(model);
+    benchmark::DoNotOptimize(workspace);
+  }
+}
+
+// translate with a sink accepting every message, asynchronous or not
+static void BM_ForwardTranslatorLoggingEnabled(benchmark::State& state, bool asynchronous) {
+  Logger::instance().standardOutLogger().disable();
+  Model model = largeModel(state.range(0));
+
+  StringStreamLogSink sink(asynchronous);
+  sink.setLogLevel(Trace);
+
+  for (auto _ : state) {
+    energyplus::ForwardTranslator ft;
+    Workspace workspace = ft.translateModel(model);
+    benchmark::DoNotOptimize(workspace);
+    sink.flush();
+
+    state.PauseTiming();
+    sink.resetStringStream();
+    state.ResumeTiming();
+  }
+}
+
+BENCHMARK(BM_ForwardTranslatorLoggingDisabled)->Unit(benchmark::kMillisecond)->Arg(10)->Arg(50);
+BENCHMARK_CAPTURE(BM_ForwardTranslatorLoggingEnabled, synchronous, false)->Unit(benchmark::kMillisecond)->Arg(10)->Arg(50);
+BENCHMARK_CAPTURE(BM_ForwardTranslatorLoggingEnabled, asynchronous, true)->Unit(benchmark::kMillisecond)->Arg(10)->Arg(50);
@@ -12,6 +12,9 @@
 // Ignore stuff that takes/returns Json::Value
 %ignore openstudio::epJSON::toJSON;
 %ignore openstudio::epJSON::loadJSON;
+%ignore openstudio::epJSON::fromJSON;
+// Ignore stuff that takes std::ostream
+%ignore openstudio::epJSON::writeJSON;
 
 %include <utilities/core/CommonInclude.i>
 %import <utilities/core/CommonImport.i>
@@ -9,13 +9,29 @@
 #include "../utilities/idf/IdfExtensibleGroup.hpp"
 #include "../utilities/idf/WorkspaceExtensibleGroup.hpp"
 #include "../utilities/core/ApplicationPathHelpers.hpp"
+#include "../utilities/core/Filesystem.hpp"
+#include "../utilities/core/FilesystemHelpers.hpp"
 
 #include <utilities/idd/IddEnums.hxx>
+#include <utilities/idd/IddFactory.hxx>
 
 #include <json/json.h>
 #include <fmt/format.h>
-#include <vector>
+#include <boost/algorithm/string/case_conv.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
 #include <string_view>
+#include <unordered_map>
+#include <variant>
+#include <vector>
 
 namespace openstudio::epJSON {
 
@@ -101,12 +117,12 @@ const std::string& toJSONFieldName(std::map<std::string, std::string>& fieldName
 const Json::Value& getSchemaObjectProperties(const Json::Value& schema, const std::string& type_description) {
   const auto& patternProperties = safeLookupValue(schema, "properties", type_description, "patternProperties");
 
-  if (!patternProperties.isObject()) {
-    LOG_FREE(LogLevel::Error, "epJSONTranslator", "Unable to find epJSON schema object for patternProperties for " << type_description);
+  if (!patternProperties.isObject() || patternProperties.empty()) {
     return patternProperties;
   }
 
-  return safeLookupValue(patternProperties, patternProperties.getMemberNames()[0], "properties");
+  // first member in sorted order
+  return safeLookupValue(*patternProperties.begin(), "properties");
 }
 
 const Json::Value& getSchemaFieldNames(const Json::Value& schema, const std::string& type_description) {
@@ -132,32 +148,185 @@ JSONValueType schemaPropertyTypeDecode(const Json::Value& type) {
   return JSONValueType::NumberOrString;
 }
 
-/** Locate the properties for a given field of an object.
- * - group_name can be empty, or it's the name of the extensible group.
- * - field_name is the name of the field
- * - field_property_name is something like 'type', 'anyOf', or 'enum'
- *
- * if group_name is empty:
- *  getSchemaObjectProperties > [field_name] > [field_property_name]
- * else:
- *  getSchemaObjectProperties > [group_name] > items > properties > [field_name] > [field_property_name]
- */
-const Json::Value& getSchemaObjectFieldProperty(const Json::Value& schema, const std::string& type_description, const std::string& group_name,
-                                                const std::string& field_name, const std::string& field_property_name) {
+/** Precomputed lookups for one field of an object in the epJSON schema */
+struct SchemaField
+{
+  JSONValueType type = JSONValueType::NumberOrString;
+  // whether the field has an 'enum' property at all
+  bool hasEnum = false;
+  // case folded 'enum' choice => choice as spelled in the schema
+  std::unordered_map<std::string, std::string> enumValues;
+  // case folded 'anyOf' > 'enum' choice => choice as spelled in the schema
+  std::unordered_map<std::string, std::string> anyOfEnumValues;
+  // first 'anyOf' > 'enum' choice starting with "auto", empty if there is none
+  std::string autoValue;
+};
+
+/** Precomputed lookups for one object in the epJSON schema */
+struct SchemaObject
+{
+  // first property of type 'array' holding the extensible groups, empty if the groups are not an array
+  std::string groupName;
+  bool isArrayGroup = false;
+  // schema > properties > [type_description] > legacy_idd > fields
+  std::vector<std::string> legacyFieldNames;
+  // getSchemaObjectProperties > [field_name]
+  std::unordered_map<std::string, SchemaField> fields;
+  // getSchemaObjectProperties > [groupName] > items > properties > [field_name]
+  std::unordered_map<std::string, SchemaField> groupFields;
+
+  /** Find the field with the given name, group_name is empty or groupName */
+  const SchemaField& field(const std::string& group_name, const std::string& field_name) const {
+    static const SchemaField missing;
+    const auto& lookup = group_name.empty() ? fields : groupFields;
+    const auto it = lookup.find(field_name);
+    return (it == lookup.end()) ? missing : it->second;
+  }
+};
+
+SchemaField makeSchemaField(const Json::Value& fieldProperties) {
+  SchemaField result;
+  if (!fieldProperties.isObject()) {
+    return result;
+  }
+
+  result.type = schemaPropertyTypeDecode(fieldProperties["type"]);
+
+  const auto& enumOptions = fieldProperties["enum"];
+  if (!enumOptions.isNull()) {
+    result.hasEnum = true;
+    for (const auto& enumOption : enumOptions) {
+      if (enumOption.isString()) {
+        const auto& enumStr = enumOption.asString();
+        // first spelling wins
+        result.enumValues.emplace(boost::to_lower_copy(enumStr), enumStr);
+      }
+    }
+  }
+
+  const auto& anyOf = fieldProperties["anyOf"];
+  if (anyOf.isArray()) {
+    for (const auto& possibleValues : anyOf) {
+      if (!possibleValues.isObject() || !possibleValues["enum"].isArray()) {
+        continue;
+      }
+      for (const auto& enumOption : possibleValues["enum"]) {
+        if (enumOption.isString()) {
+          const auto& enumStr = enumOption.asString();
+          auto lowerEnumStr = boost::to_lower_copy(enumStr);
+          if (result.autoValue.empty() && lowerEnumStr.find("auto") == 0) {
+            result.autoValue = enumStr;
+          }
+          result.anyOfEnumValues.emplace(std::move(lowerEnumStr), enumStr);
+        }
+      }
+    }
+  }
+
+  return result;
+}
+
+SchemaObject makeSchemaObject(const Json::Value& schema, const std::string& type_description) {
+  SchemaObject result;
+
+  for (const auto& fieldName : getSchemaFieldNames(schema, type_description)) {
+    result.legacyFieldNames.push_back(fieldName.isString() ? fieldName.asString() : std::string());
+  }
 
   const auto& objectProperties = getSchemaObjectProperties(schema, type_description);
+  if (!objectProperties.isObject()) {
+    return result;
+  }
 
-  if (group_name.empty()) {
-    return safeLookupValue(objectProperties, field_name, field_property_name);
-  } else {
-    return safeLookupValue(objectProperties, group_name, "items", "properties", field_name, field_property_name);
+  // object members iterate in sorted order, same as getMemberNames
+  for (auto it = objectProperties.begin(); it != objectProperties.end(); ++it) {
+    const auto propertyName = it.name();
+    result.fields.emplace(propertyName, makeSchemaField(*it));
+
+    const auto& type = (*it)["type"];
+    if (!result.isArrayGroup && type.isString() && type.asString() == "array") {
+      result.groupName = propertyName;
+      result.isArrayGroup = true;
+    }
+  }
+
+  if (result.isArrayGroup) {
+    const auto& groupProperties = safeLookupValue(objectProperties, result.groupName, "items", "properties");
+    if (groupProperties.isObject()) {
+      for (auto it = groupProperties.begin(); it != groupProperties.end(); ++it) {
+        result.groupFields.emplace(it.name(), makeSchemaField(*it));
+      }
+    }
+  }
+
+  return result;
+}
+
+/** Parsed epJSON schema reduced to the per object and per field tables used by the translator */
+class Schema
+{
+ public:
+  explicit Schema(const Json::Value& schema) {
+    const auto& objects = schema["properties"];
+    if (objects.isObject()) {
+      for (auto it = objects.begin(); it != objects.end(); ++it) {
+        const auto type_description = it.name();
+        m_objects.emplace(type_description, makeSchemaObject(schema, type_description));
+      }
+    }
+  }
+
+  /** Returns nullptr if the schema does not describe type_description */
+  const SchemaObject* object(const std::string& type_description) const {
+    const auto it = m_objects.find(type_description);
+    return (it == m_objects.end()) ? nullptr : &it->second;
+  }
+
+ private:
+  std::unordered_map<std::string, SchemaObject> m_objects;
+};
+
+/** Process wide cache of parsed schemas keyed by path, reparsed if the file's size or timestamp change.
+ *  Returns nullptr if the schema cannot be loaded. */
+std::shared_ptr<const Schema> loadSchema(const openstudio::path& path) {
+  struct CachedSchema
+  {
+    time_t lastWriteTime;
+    uintmax_t fileSize;
+    std::shared_ptr<const Schema> schema;
+  };
+
+  static std::mutex cacheMutex;
+  static std::map<openstudio::path, CachedSchema> cache;
+
+  if (!openstudio::filesystem::is_regular_file(path)) {
+    return nullptr;
   }
+  const auto lastWriteTime = openstudio::filesystem::last_write_time_as_time_t(path);
+  const auto fileSize = openstudio::filesystem::file_size(path);
+
+  std::lock_guard<std::mutex> lock(cacheMutex);
+
+  if (const auto it = cache.find(path); it != cache.end()) {
+    if ((it->second.lastWriteTime == lastWriteTime) && (it->second.fileSize == fileSize)) {
+      return it->second.schema;
+    }
+  }
+
+  // parse while holding the lock so concurrent translations share one parse
+  const Json::Value root = loadJSON(path);
+  if (root.isNull()) {
+    return nullptr;
+  }
+
+  auto schema = std::make_shared<const Schema>(root);
+  cache[path] = CachedSchema{lastWriteTime, fileSize, schema};
+  return schema;
 }
 
-/** Find the 'type' property of a field and convert that to enum.*/
-JSONValueType getSchemaObjectFieldPropertyType(const Json::Value& schema, const std::string& type_description, const std::string& group_name,
-                                               const std::string& field_name) {
-  JSONValueType type = schemaPropertyTypeDecode(getSchemaObjectFieldProperty(schema, type_description, group_name, field_name, "type"));
+/** Find the 'type' property of a field */
+JSONValueType getSchemaObjectFieldPropertyType(const SchemaObject& schemaObject, const std::string& group_name, const std::string& field_name) {
+  JSONValueType type = schemaObject.field(group_name, field_name).type;
   if (type == JSONValueType::NumberOrString) {
     LOG_FREE(LogLevel::Warn, "epJSONTranslator",
              "Unknown value passed to schemaPropertyTypeDecode, returning generic 'NumberOrString' Option. "
@@ -169,25 +338,19 @@ JSONValueType getSchemaObjectFieldPropertyType(const Json::Value& schema, const
 /** epJSON (unlike IDF) is case sensitive, so this routine find the correct 'enum' choice casing
  * It applies to fieldType = 'ChoiceType' or 'RealType' (since RealType can also be `anyOf` with values like 'Autosize' 'Autocalculate'))
  * eg: if given value='autosize', will convert it to 'Autosize' so that EnergyPlus' InputParser does recognize it */
-std::string fixupEnumerationValue(const Json::Value& schema, const std::string& value, const std::string& type_description,
-                                  const std::string& group_name, const std::string& field_name, const openstudio::IddFieldType fieldType) {
+std::string fixupEnumerationValue(const SchemaObject& schemaObject, const std::string& value, const std::string& group_name,
+                                  const std::string& field_name, const openstudio::IddFieldType fieldType) {
 
   if (fieldType == openstudio::IddFieldType::ChoiceType) {
-    const auto& fieldProperty = getSchemaObjectFieldProperty(schema, type_description, group_name, field_name, "enum");
-    const auto lower = boost::to_lower_copy(value);
+    const auto& schemaField = schemaObject.field(group_name, field_name);
 
-    if (fieldProperty.isNull()) {
+    if (!schemaField.hasEnum) {
       LOG_FREE(LogLevel::Error, "epJSONTranslator", "Unable to find enum value for " << value << " in " << group_name << "::" << field_name)
       return value;
     }
 
-    for (const auto& enumOption : fieldProperty) {
-      if (enumOption.isString()) {
-        const auto& enumStr = enumOption.asString();
-        if (boost::to_lower_copy(enumStr) == lower) {
-          return enumStr;
-        }
-      }
+    if (const auto it = schemaField.enumValues.find(boost::to_lower_copy(value)); it != schemaField.enumValues.end()) {
+      return it->second;
     }
 
     // value wasn't found, so return passed-in value
@@ -195,32 +358,16 @@ std::string fixupEnumerationValue(const Json::Value& schema, const std::string&
   }
 
   if (fieldType == openstudio::IddFieldType::RealType) {
+    const auto& schemaField = schemaObject.field(group_name, field_name);
+    const auto lower = boost::to_lower_copy(value);
 
-    const auto& fieldProperty = getSchemaObjectFieldProperty(schema, type_description, group_name, field_name, "anyOf");
-
-    if (fieldProperty.isArray()) {
-      const auto lower = boost::to_lower_copy(value);
-
-      for (const auto& possibleValues : fieldProperty) {
-        const auto& enumOptions = possibleValues["enum"];
-        if (enumOptions.isArray()) {
-          for (const auto& enumOption : enumOptions) {
-            if (enumOption.isString()) {
-              const auto& enumStr = enumOption.asString();
-              const auto lowerEnumStr = boost::to_lower_copy(enumStr);
-
-              if (lowerEnumStr == lower) {
-                return enumStr;
-              }
+    // any "auto" value maps to the first "auto" option, eg 'Autocalculate' for 'autosize'
+    if (!schemaField.autoValue.empty() && lower.find("auto") == 0) {
+      return schemaField.autoValue;
+    }
 
-              if (lowerEnumStr.find("auto") == 0 && lower.find("auto") == 0) {
-                // it's the "auto" option, return it
-                return enumStr;
-              }
-            }
-          }
-        }
-      }
+    if (const auto it = schemaField.anyOfEnumValues.find(lower); it != schemaField.anyOfEnumValues.end()) {
+      return it->second;
     }
 
     // value wasn't found, so return passed-in value
@@ -231,36 +378,6 @@ std::string fixupEnumerationValue(const Json::Value& schema, const std::string&
   return value;
 }
 
-/* Find name of an extensible group and cache it */
-auto getGroupName(std::map<std::pair<std::string, std::string>, std::pair<std::string, bool>>& group_names,
-                  std::map<std::string, std::string>& field_names, const Json::Value& schema, const std::string& type_description,
-                  const std::string& group_name) -> const auto& {
-
-  const auto key = std::pair{type_description, group_name};
-
-  if (const auto cached = group_names.find(key); cached != group_names.end()) {
-    return cached->second;
-  }
-
-  const auto cache_result = [&](const auto& name, const bool is_array) -> const auto& {
-    return group_names.emplace(key, std::pair{name, is_array}).first->second;
-  };
-
-  const auto& objectProperties = getSchemaObjectProperties(schema, type_description);
-
-  for (const auto& propertyName : objectProperties.getMemberNames()) {
-    const auto& type = safeLookupValue(objectProperties, propertyName, "type");
-    if (type.isString()) {
-      if (type.asString() == "array") {
-        return cache_result(propertyName, true);
-      }
-    }
-  }
-
-  // group name is irrelevant if it's not an array group
-  return cache_result("", false);
-}
-
 openstudio::path defaultSchemaPath(openstudio::IddFileType filetype) {
   openstudio::path schemaPath;
   if (filetype == openstudio::IddFileType::EnergyPlus) {
@@ -286,95 +403,113 @@ Json::Value loadJSON(const openstudio::path& path) {
   return root;
 }
 
-std::string getFieldName(const bool is_array, const IddObject& iddObject, const Json::Value& schema, const std::string& type_description,
-                         const std::size_t group_number, const std::size_t field_number, std::string_view field_name) {
+const std::string& getFieldName(const bool is_array, const IddObject& iddObject, const SchemaObject& schemaObject, const std::size_t group_number,
+                                const std::size_t field_number, const std::string& field_name) {
   if (is_array) {
-    return std::string{field_name};
+    return field_name;
   }
 
   // Legacy IDD field names
-  const auto& fieldNames = getSchemaFieldNames(schema, type_description);
+  const auto& fieldNames = schemaObject.legacyFieldNames;
 
   // use the index of the field inside of the IddObject to look up what its name should be
   // inside of the epJSON schema
   //
   // This is (partially) necessary because OpenStudio treats all groups as extensible.
-  const auto& lookedUpFieldName =
-    fieldNames[static_cast<int>((group_number - 1) * iddObject.extensibleGroup().size() + field_number + iddObject.nonextensibleFields().size())];
+  const auto index = (group_number - 1) * iddObject.extensibleGroup().size() + field_number + iddObject.nonextensibleFields().size();
 
-  LOG_FREE(LogLevel::Error, "epJSONTranslator", "Unable to look up field name for input field" << field_name)
-  OS_ASSERT(lookedUpFieldName.isString());
-  return lookedUpFieldName.asString();
+  if (index >= fieldNames.size() || fieldNames[index].empty()) {
+    LOG_FREE(LogLevel::Error, "epJSONTranslator", "Unable to look up field name for input field" << field_name)
+  }
+  OS_ASSERT(index < fieldNames.size());
+  return fieldNames[index];
 }
 
-Json::Value toJSON(const openstudio::IdfFile& idf, const openstudio::path& schemaPath) {
+/** Value of a translated field */
+using FieldValue = std::variant<int, double, std::string>;
 
-  openstudio::path schemaToLoad = schemaPath;
-  if (schemaToLoad.empty()) {
-    schemaToLoad = defaultSchemaPath(idf.iddFileType());
-    if (schemaToLoad.empty()) {
-      return Json::Value::null;
+/** Translated fields in translation order, setting a key again replaces its value like Json::Value does */
+class FieldValues
+{
+ public:
+  void set(std::string_view key, FieldValue value) {
+    for (auto& [k, v] : m_values) {
+      if (k == key) {
+        v = std::move(value);
+        return;
+      }
     }
+    m_values.emplace_back(key, std::move(value));
   }
 
-  std::map<std::string, int> type_counts;
-
-  Json::Value result;
-
-  std::map<std::pair<std::string, std::string>, std::pair<std::string, bool>> group_names;
-  std::map<std::string, std::string> field_names;
-
-  Json::Value schema = loadJSON(schemaToLoad);
-  if (schema.isNull()) {
-    LOG_FREE(LogLevel::Error, "epJSONTranslator", "Schema is invalid at path=" << schemaToLoad);
-    return Json::Value::null;
+  const std::vector<std::pair<std::string_view, FieldValue>>& values() const {
+    return m_values;
   }
 
-  result["Version"]["Version 1"]["version_identifier"] = fmt::format("{}.{}", idf.version().major(), idf.version().minor());
+ private:
+  // keys point into the schema tables or the translator's field name cache
+  std::vector<std::pair<std::string_view, FieldValue>> m_values;
+};
 
-  for (const auto& obj : idf.objects()) {
-    if (obj.iddObject().type().value() == openstudio::IddObjectType::CommentOnly) {
-      // we aren't translating comments it seems
-      continue;
-    }
+/** An IdfObject translated against the schema */
+struct TranslatedObject
+{
+  FieldValues fields;
+  // name of the array holding the extensible groups, empty if the groups are written to fields
+  std::string_view groupName;
+  std::vector<FieldValues> groups;
+};
 
-    const auto& type_description = obj.iddObject().type().valueDescription();
+/** Translates the objects of one IdfFile against a cached schema, shared by toJSON and writeJSON */
+class ObjectTranslator
+{
+ public:
+  explicit ObjectTranslator(std::shared_ptr<const Schema> schema) : m_schema(std::move(schema)) {}
 
+  /** Key of the object in its type group, unnamed objects are numbered per type in call order so call once per object */
+  std::string objectName(const openstudio::IdfObject& obj) {
+    const auto& type_description = obj.iddObject().type().valueDescription();
     const auto& name = obj.name();
-    const auto& defaultedName = obj.nameString(true);
+    const bool is_fluid_properties_name = isFluidPropertiesName(type_description);
 
-    auto& json_group = result[type_description];
+    if (name && !is_fluid_properties_name) {
+      return *name;
+    }
+    const auto defaultedName = obj.nameString(true);
+    if (!defaultedName.empty() && !is_fluid_properties_name) {
+      return defaultedName;
+    }
+    return fmt::format("{} {}", type_description, ++m_typeCounts[type_description]);
+  }
 
-    const bool is_fluid_properties_name = type_description.find("FluidProperties:Name") != std::string::npos;
+  TranslatedObject translate(const openstudio::IdfObject& obj) {
+    TranslatedObject result;
 
-    const auto& usable_json_object_name = [&]() {
-      if (name && !is_fluid_properties_name) {
-        return *name;
-      } else {
-        if (!defaultedName.empty() && !is_fluid_properties_name) {
-          return defaultedName;
-        } else {
-          return fmt::format("{} {}", type_description, ++type_counts[type_description]);
-        }
-      }
-    }();
+    const auto& type_description = obj.iddObject().type().valueDescription();
 
-    auto& json_object = json_group[usable_json_object_name];
-    json_object = Json::Value(Json::objectValue);
+    static const SchemaObject missingSchemaObject;
+    const SchemaObject* schemaObjectPtr = m_schema->object(type_description);
+    if (schemaObjectPtr == nullptr) {
+      LOG_FREE(LogLevel::Error, "epJSONTranslator", "Unable to find epJSON schema object for patternProperties for " << type_description);
+      schemaObjectPtr = &missingSchemaObject;
+    }
+    const SchemaObject& schemaObject = *schemaObjectPtr;
 
-    if (name && is_fluid_properties_name) {
-      json_object["fluid_name"] = *name;
+    if (isFluidPropertiesName(type_description)) {
+      if (const auto& name = obj.name()) {
+        result.fields.set(fluidNameKey, *name);
+      }
     }
 
-    const auto visitField = [&schema, &type_description](auto&& visitor, const openstudio::IddField& iddField, const std::string& group_name,
-                                                         const auto& fieldName, const auto& field, const auto idx) -> bool {
-      const auto jsonFieldType = getSchemaObjectFieldPropertyType(schema, type_description, group_name, fieldName);
+    const auto visitField = [&schemaObject](auto&& visitor, const openstudio::IddField& iddField, const std::string& group_name,
+                                            const auto& fieldName, const auto& field, const auto idx) -> bool {
+      const auto jsonFieldType = getSchemaObjectFieldPropertyType(schemaObject, group_name, fieldName);
 
       switch (jsonFieldType) {
         case JSONValueType::String: {
           const auto fieldString = field.getString(idx);
           if (fieldString && !fieldString->empty()) {
-            visitor(fixupEnumerationValue(schema, *fieldString, type_description, group_name, fieldName, iddField.properties().type));
+            visitor(fixupEnumerationValue(schemaObject, *fieldString, group_name, fieldName, iddField.properties().type));
             return true;
           }
         }
@@ -404,7 +539,7 @@ Json::Value toJSON(const openstudio::IdfFile& idf, const openstudio::path& schem
       {
         const auto fieldString = field.getString(idx);
         if (fieldString && !fieldString->empty()) {
-          visitor(fixupEnumerationValue(schema, *fieldString, type_description, group_name, fieldName, iddField.properties().type));
+          visitor(fixupEnumerationValue(schemaObject, *fieldString, group_name, fieldName, iddField.properties().type));
 
           return true;
         }
@@ -413,20 +548,22 @@ Json::Value toJSON(const openstudio::IdfFile& idf, const openstudio::path& schem
       return false;
     };
 
+    const auto& group_name = schemaObject.groupName;
+    const auto is_array_group = schemaObject.isArrayGroup;
+    if (is_array_group) {
+      result.groupName = group_name;
+    }
+
     std::size_t cur_group_number = 0;
 
     for (const auto& g : obj.extensibleGroups()) {
       ++cur_group_number;
-      // get first field and try to make a group name out of it
-      const auto& [group_name, is_array_group] =
-        openstudio::epJSON::getGroupName(group_names, field_names, schema, type_description, obj.iddObject().extensibleGroup()[0].name());
 
-      auto& containing_json = [&json_object, &group_name = group_name, is_array_group = is_array_group ]() -> auto& {
+      auto& containing_fields = [&result, is_array_group]() -> auto& {
         if (is_array_group) {
-          auto& array_obj = json_object[group_name];
-          return array_obj.append(Json::Value{Json::objectValue});
+          return result.groups.emplace_back();
         } else {
-          return json_object;
+          return result.fields;
         }
       }
       ();
@@ -434,18 +571,19 @@ Json::Value toJSON(const openstudio::IdfFile& idf, const openstudio::path& schem
       for (unsigned int idx = 0; idx < g.numFields(); ++idx) {
         const auto& iddField = obj.iddObject().extensibleGroup()[idx];
 
-        const auto fieldName = getFieldName(is_array_group, obj.iddObject(), schema, type_description, cur_group_number, idx,
-                                            toJSONFieldName(field_names, iddField.name()));
+        const auto& fieldName =
+          getFieldName(is_array_group, obj.iddObject(), schemaObject, cur_group_number, idx, toJSONFieldName(m_fieldNames, iddField.name()));
 
-        [[maybe_unused]] const auto fieldAdded = visitField([&containing_json, &fieldName](const auto& value) { containing_json[fieldName] = value; },
-                                                            iddField, group_name, fieldName, g, idx);
+        [[maybe_unused]] const auto fieldAdded =
+          visitField([&containing_fields, &fieldName](const auto& value) { containing_fields.set(fieldName, value); }, iddField, group_name,
+                     fieldName, g, idx);
       }
     }
 
     for (unsigned int idx = 0; idx < obj.numFields(); ++idx) {
       const auto& iddField = obj.iddObject().getField(idx);
 
-      const auto& fieldName = toJSONFieldName(field_names, iddField->name());
+      const auto& fieldName = toJSONFieldName(m_fieldNames, iddField->name());
 
       if (iddField->isNameField()) {
         // skip name, we already got that
@@ -457,7 +595,83 @@ Json::Value toJSON(const openstudio::IdfFile& idf, const openstudio::path& schem
         continue;
       }
 
-      visitField([&json_object, &fieldName](const auto& value) { json_object[fieldName] = value; }, iddField.get(), "", fieldName, obj, idx);
+      visitField([&result, &fieldName](const auto& value) { result.fields.set(fieldName, value); }, iddField.get(), "", fieldName, obj, idx);
+    }
+
+    return result;
+  }
+
+ private:
+  static constexpr std::string_view fluidNameKey = "fluid_name";
+
+  static bool isFluidPropertiesName(const std::string& type_description) {
+    return type_description.find("FluidProperties:Name") != std::string::npos;
+  }
+
+  std::shared_ptr<const Schema> m_schema;
+  std::map<std::string, int> m_typeCounts;
+  std::map<std::string, std::string> m_fieldNames;
+};
+
+/** Resolve the schema for idf, logs and returns nullptr if it cannot be loaded */
+std::shared_ptr<const Schema> loadSchemaFor(const openstudio::IdfFile& idf, const openstudio::path& schemaPath) {
+  openstudio::path schemaToLoad = schemaPath;
+  if (schemaToLoad.empty()) {
+    schemaToLoad = defaultSchemaPath(idf.iddFileType());
+    if (schemaToLoad.empty()) {
+      return nullptr;
+    }
+  }
+
+  auto schema = loadSchema(schemaToLoad);
+  if (!schema) {
+    LOG_FREE(LogLevel::Error, "epJSONTranslator", "Schema is invalid at path=" << schemaToLoad);
+  }
+  return schema;
+}
+
+std::string versionIdentifier(const openstudio::IdfFile& idf) {
+  return fmt::format("{}.{}", idf.version().major(), idf.version().minor());
+}
+
+Json::Value toJSONValue(const FieldValues& fields) {
+  Json::Value result(Json::objectValue);
+  for (const auto& [key, value] : fields.values()) {
+    std::visit([&result, key = key](const auto& v) { result[std::string{key}] = v; }, value);
+  }
+  return result;
+}
+
+Json::Value toJSON(const openstudio::IdfFile& idf, const openstudio::path& schemaPath) {
+
+  const auto schema = loadSchemaFor(idf, schemaPath);
+  if (!schema) {
+    return Json::Value::null;
+  }
+
+  ObjectTranslator translator(schema);
+
+  Json::Value result;
+
+  result["Version"]["Version 1"]["version_identifier"] = versionIdentifier(idf);
+
+  for (const auto& obj : idf.objects()) {
+    if (obj.iddObject().type().value() == openstudio::IddObjectType::CommentOnly) {
+      // we aren't translating comments it seems
+      continue;
+    }
+
+    const auto& type_description = obj.iddObject().type().valueDescription();
+    const auto usable_json_object_name = translator.objectName(obj);
+    const auto translated = translator.translate(obj);
+
+    auto& json_object = result[type_description][usable_json_object_name];
+    json_object = toJSONValue(translated.fields);
+
+    if (!translated.groupName.empty()) {
+      for (const auto& group : translated.groups) {
+        json_object[std::string{translated.groupName}].append(toJSONValue(group));
+      }
     }
   }
   return result;
@@ -475,4 +689,761 @@ std::string toJSONString(const openstudio::Workspace& workspace, const openstudi
   return toJSON(workspace, schemaPath).toStyledString();
 }
 
+/** Minimal JSON emitter into a memory buffer for writeJSON */
+class JSONBufferWriter
+{
+ public:
+  explicit JSONBufferWriter(std::ostream& os) : m_os(os) {}
+
+  void raw(std::string_view str) {
+    m_buffer.append(str.data(), str.data() + str.size());
+  }
+
+  /** Escapes like jsoncpp's writers: non ASCII characters become \u escapes (surrogate pairs above the BMP) and
+   *  malformed UTF-8 becomes \ufffd, so the output is pure ASCII and always valid JSON */
+  void quoted(std::string_view str) {
+    m_buffer.push_back('"');
+    const char* end = str.data() + str.size();
+    for (const char* c = str.data(); c != end; ++c) {
+      unsigned cp = codepoint(c, end);
+      switch (cp) {
+        case '"':
+          raw("\\\"");
+          break;
+        case '\\':
+          raw("\\\\");
+          break;
+        case '\b':
+          raw("\\b");
+          break;
+        case '\f':
+          raw("\\f");
+          break;
+        case '\n':
+          raw("\\n");
+          break;
+        case '\r':
+          raw("\\r");
+          break;
+        case '\t':
+          raw("\\t");
+          break;
+        default:
+          if (cp < 0x20) {
+            fmt::format_to(std::back_inserter(m_buffer), "\\u{:04x}", cp);
+          } else if (cp < 0x80) {
+            m_buffer.push_back(static_cast<char>(cp));
+          } else if (cp < 0x10000) {
+            fmt::format_to(std::back_inserter(m_buffer), "\\u{:04x}", cp);
+          } else {
+            cp -= 0x10000;
+            fmt::format_to(std::back_inserter(m_buffer), "\\u{:04x}\\u{:04x}", 0xD800 + ((cp >> 10) & 0x3FF), 0xDC00 + (cp & 0x3FF));
+          }
+      }
+    }
+    m_buffer.push_back('"');
+  }
+
+  void value(int v) {
+    fmt::format_to(std::back_inserter(m_buffer), "{}", v);
+  }
+
+  /** Doubles keep a fraction or exponent so they read back as reals, non finite values are written like jsoncpp does */
+  void value(double v) {
+    if (std::isnan(v)) {
+      raw("null");
+    } else if (std::isinf(v)) {
+      raw(v < 0 ? "-1e+9999" : "1e+9999");
+    } else {
+      const auto start = m_buffer.size();
+      fmt::format_to(std::back_inserter(m_buffer), "{}", v);
+      if (std::find_if(m_buffer.begin() + start, m_buffer.end(), [](char c) { return c == '.' || c == 'e'; }) == m_buffer.end()) {
+        raw(".0");
+      }
+    }
+  }
+
+  void value(const std::string& v) {
+    quoted(v);
+  }
+
+  void object(const FieldValues& fields, std::string_view groupName, const std::vector<FieldValues>& groups) {
+    m_buffer.push_back('{');
+    bool first = true;
+    for (const auto& [key, value] : fields.values()) {
+      if (!first) {
+        raw(", ");
+      }
+      first = false;
+      quoted(key);
+      raw(": ");
+      std::visit([this](const auto& v) { this->value(v); }, value);
+    }
+    if (!groupName.empty() && !groups.empty()) {
+      if (!first) {
+        raw(", ");
+      }
+      quoted(groupName);
+      raw(": [");
+      for (std::size_t i = 0; i < groups.size(); ++i) {
+        if (i > 0) {
+          raw(", ");
+        }
+        object(groups[i], {}, {});
+      }
+      m_buffer.push_back(']');
+    }
+    m_buffer.push_back('}');
+  }
+
+  /** Hand the buffer to the stream once it is large enough, or always if force */
+  void flush(bool force = false) {
+    if (force || m_buffer.size() > 65536) {
+      m_os.write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+      m_buffer.clear();
+    }
+  }
+
+ private:
+  /** Decodes the UTF-8 sequence starting at c the way jsoncpp does, leaving c on its last byte. Truncated, overlong
+   *  and surrogate sequences decode to U+FFFD */
+  static unsigned codepoint(const char*& c, const char* end) {
+    constexpr unsigned replacement = 0xFFFD;
+    auto byte = [&c](int i) { return static_cast<unsigned>(static_cast<unsigned char>(c[i])); };
+    const unsigned first = byte(0);
+    if (first < 0x80) {
+      return first;
+    }
+    if (first < 0xE0) {
+      if (end - c < 2) {
+        return replacement;
+      }
+      const unsigned cp = ((first & 0x1F) << 6) | (byte(1) & 0x3F);
+      c += 1;
+      return (cp < 0x80) ? replacement : cp;
+    }
+    if (first < 0xF0) {
+      if (end - c < 3) {
+        return replacement;
+      }
+      const unsigned cp = ((first & 0x0F) << 12) | ((byte(1) & 0x3F) << 6) | (byte(2) & 0x3F);
+      c += 2;
+      return ((cp < 0x800) || ((cp >= 0xD800) && (cp <= 0xDFFF))) ? replacement : cp;
+    }
+    if (first < 0xF8) {
+      if (end - c < 4) {
+        return replacement;
+      }
+      const unsigned cp = ((first & 0x07) << 18) | ((byte(1) & 0x3F) << 12) | ((byte(2) & 0x3F) << 6) | (byte(3) & 0x3F);
+      c += 3;
+      return (cp < 0x10000) ? replacement : cp;
+    }
+    return replacement;
+  }
+
+  std::ostream& m_os;
+  fmt::memory_buffer m_buffer;
+};
+
+bool writeJSON(const openstudio::IdfFile& idf, std::ostream& os, const openstudio::path& schemaPath) {
+
+  const auto schema = loadSchemaFor(idf, schemaPath);
+  if (!schema) {
+    return false;
+  }
+
+  ObjectTranslator translator(schema);
+
+  // group by type and then by name like the Json::Value document, a later object with the same name replaces an earlier one.
+  // The Version entry is written from idf.version() unless an object replaces it
+  const std::vector<openstudio::IdfObject> objects = idf.objects();
+  std::map<std::string, std::map<std::string, const openstudio::IdfObject*>> index;
+  index["Version"]["Version 1"] = nullptr;
+  for (const auto& obj : objects) {
+    if (obj.iddObject().type().value() == openstudio::IddObjectType::CommentOnly) {
+      continue;
+    }
+    index[obj.iddObject().type().valueDescription()][translator.objectName(obj)] = &obj;
+  }
+
+  JSONBufferWriter writer(os);
+  writer.raw("{");
+  bool firstType = true;
+  for (const auto& [type_description, objectsByName] : index) {
+    writer.raw(firstType ? "\n  " : ",\n  ");
+    firstType = false;
+    writer.quoted(type_description);
+    writer.raw(": {");
+    bool firstObject = true;
+    for (const auto& [name, obj] : objectsByName) {
+      writer.raw(firstObject ? "\n    " : ",\n    ");
+      firstObject = false;
+      writer.quoted(name);
+      writer.raw(": ");
+      if (obj == nullptr) {
+        writer.raw("{\"version_identifier\": ");
+        writer.quoted(versionIdentifier(idf));
+        writer.raw("}");
+      } else {
+        const auto translated = translator.translate(*obj);
+        writer.object(translated.fields, translated.groupName, translated.groups);
+      }
+      writer.flush();
+    }
+    writer.raw("\n  }");
+  }
+  writer.raw("\n}\n");
+  writer.flush(true);
+
+  return os.good();
+}
+
+bool writeJSON(const openstudio::Workspace& workspace, std::ostream& os, const openstudio::path& schemaPath) {
+  return writeJSON(workspace.toIdfFile(), os, schemaPath);
+}
+
+bool saveJSON(const openstudio::IdfFile& idf, const openstudio::path& outputPath, const openstudio::path& schemaPath) {
+  openstudio::filesystem::ofstream ofs(outputPath, std::ios_base::binary | std::ios_base::trunc);
+  if (!ofs.is_open()) {
+    LOG_FREE(LogLevel::Error, "epJSONTranslator", "Unable to open " << outputPath << " for writing");
+    return false;
+  }
+  return writeJSON(idf, ofs, schemaPath);
+}
+
+bool saveJSON(const openstudio::Workspace& workspace, const openstudio::path& outputPath, const openstudio::path& schemaPath) {
+  return saveJSON(workspace.toIdfFile(), outputPath, schemaPath);
+}
+
+/** Decodes the binary forms of epJSON that EnergyPlus accepts, CBOR (RFC 8949) and MessagePack, into a Json::Value.
+ *  Throws std::runtime_error on malformed input */
+class BinaryJSONDecoder
+{
+ public:
+  enum class Format
+  {
+    CBOR,
+    MessagePack
+  };
+
+  BinaryJSONDecoder(const std::string& data, Format format) : m_data(data), m_format(format) {}
+
+  Json::Value decode() {
+    Json::Value result = item(0);
+    if (m_pos != m_data.size()) {
+      throw std::runtime_error("Unexpected data after the end of the document");
+    }
+    return result;
+  }
+
+ private:
+  static constexpr unsigned maxDepth = 256;
+
+  std::uint8_t byte() {
+    if (m_pos >= m_data.size()) {
+      throw std::runtime_error("Unexpected end of document");
+    }
+    return static_cast<std::uint8_t>(m_data[m_pos++]);
+  }
+
+  std::uint64_t bigEndian(unsigned numBytes) {
+    std::uint64_t result = 0;
+    for (unsigned i = 0; i < numBytes; ++i) {
+      result = (result << 8) | byte();
+    }
+    return result;
+  }
+
+  /** Checks a length against the bytes left so corrupt lengths cannot trigger huge allocations */
+  std::size_t length(std::uint64_t n) {
+    if (n > m_data.size() - m_pos) {
+      throw std::runtime_error("Length exceeds the size of the document");
+    }
+    return static_cast<std::size_t>(n);
+  }
+
+  std::string bytes(std::uint64_t n) {
+    const auto len = length(n);
+    std::string result = m_data.substr(m_pos, len);
+    m_pos += len;
+    return result;
+  }
+
+  static Json::Value integer(std::uint64_t n) {
+    if (n <= static_cast<std::uint64_t>(std::numeric_limits<Json::Int64>::max())) {
+      return Json::Value(static_cast<Json::Int64>(n));
+    }
+    return Json::Value(static_cast<Json::UInt64>(n));
+  }
+
+  static double halfToDouble(std::uint16_t half) {
+    const int exponent = (half >> 10) & 0x1f;
+    const int mantissa = half & 0x3ff;
+    double result;
+    if (exponent == 0) {
+      result = std::ldexp(mantissa, -24);
+    } else if (exponent != 31) {
+      result = std::ldexp(mantissa + 1024, exponent - 25);
+    } else {
+      result = (mantissa == 0) ? std::numeric_limits<double>::infinity() : std::numeric_limits<double>::quiet_NaN();
+    }
+    return (half & 0x8000) ? -result : result;
+  }
+
+  static double floatToDouble(std::uint32_t bits) {
+    float result;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+  }
+
+  static double doubleFromBits(std::uint64_t bits) {
+    double result;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+  }
+
+  Json::Value item(unsigned depth) {
+    if (depth > maxDepth) {
+      throw std::runtime_error("Document is nested too deeply");
+    }
+    return (m_format == Format::CBOR) ? cborItem(depth) : msgpackItem(depth);
+  }
+
+  // CBOR
+
+  bool cborBreak() {
+    if (m_pos < m_data.size() && static_cast<std::uint8_t>(m_data[m_pos]) == 0xff) {
+      ++m_pos;
+      return true;
+    }
+    return false;
+  }
+
+  std::uint64_t cborArgument(unsigned info) {
+    if (info < 24) {
+      return info;
+    } else if (info <= 27) {
+      return bigEndian(1u << (info - 24));
+    }
+    throw std::runtime_error("Invalid CBOR additional information");
+  }
+
+  std::string cborString(unsigned majorType, unsigned info) {
+    if (info != 31) {
+      return bytes(cborArgument(info));
+    }
+    // indefinite length, a sequence of definite length chunks of the same major type
+    std::string result;
+    while (!cborBreak()) {
+      const auto ib = byte();
+      if ((ib >> 5) != majorType || (ib & 0x1f) == 31) {
+        throw std::runtime_error("Invalid CBOR string chunk");
+      }
+      result += bytes(cborArgument(ib & 0x1f));
+    }
+    return result;
+  }
+
+  Json::Value cborItem(unsigned depth) {
+    const auto ib = byte();
+    const unsigned majorType = ib >> 5;
+    const unsigned info = ib & 0x1f;
+
+    switch (majorType) {
+      case 0:
+        return integer(cborArgument(info));
+      case 1: {
+        const auto n = cborArgument(info);
+        if (n > static_cast<std::uint64_t>(std::numeric_limits<Json::Int64>::max())) {
+          throw std::runtime_error("CBOR negative integer out of range");
+        }
+        return Json::Value(-1 - static_cast<Json::Int64>(n));
+      }
+      case 2:
+      case 3:
+        return Json::Value(cborString(majorType, info));
+      case 4: {
+        Json::Value result(Json::arrayValue);
+        if (info == 31) {
+          while (!cborBreak()) {
+            result.append(item(depth + 1));
+          }
+        } else {
+          for (auto n = length(cborArgument(info)); n > 0; --n) {
+            result.append(item(depth + 1));
+          }
+        }
+        return result;
+      }
+      case 5: {
+        Json::Value result(Json::objectValue);
+        const auto member = [&]() {
+          const Json::Value key = item(depth + 1);
+          if (!key.isString()) {
+            throw std::runtime_error("CBOR map keys must be strings");
+          }
+          result[key.asString()] = item(depth + 1);
+        };
+        if (info == 31) {
+          while (!cborBreak()) {
+            member();
+          }
+        } else {
+          for (auto n = length(cborArgument(info)); n > 0; --n) {
+            member();
+          }
+        }
+        return result;
+      }
+      case 6:
+        // tags carry no meaning for epJSON, decode the tagged item
+        cborArgument(info);
+        return item(depth + 1);
+      default:
+        break;
+    }
+
+    // major type 7, simple values and floats
+    switch (info) {
+      case 20:
+        return Json::Value(false);
+      case 21:
+        return Json::Value(true);
+      case 22:
+      case 23:
+        return Json::Value::null;
+      case 24:
+        byte();
+        return Json::Value::null;
+      case 25:
+        return Json::Value(halfToDouble(static_cast<std::uint16_t>(bigEndian(2))));
+      case 26:
+        return Json::Value(floatToDouble(static_cast<std::uint32_t>(bigEndian(4))));
+      case 27:
+        return Json::Value(doubleFromBits(bigEndian(8)));
+      default:
+        if (info < 20) {
+          return Json::Value::null;
+        }
+    }
+    throw std::runtime_error("Invalid CBOR simple value");
+  }
+
+  // MessagePack
+
+  Json::Value msgpackArray(std::size_t n, unsigned depth) {
+    Json::Value result(Json::arrayValue);
+    for (n = length(n); n > 0; --n) {
+      result.append(item(depth + 1));
+    }
+    return result;
+  }
+
+  Json::Value msgpackMap(std::size_t n, unsigned depth) {
+    Json::Value result(Json::objectValue);
+    for (n = length(n); n > 0; --n) {
+      const Json::Value key = item(depth + 1);
+      if (!key.isString()) {
+        throw std::runtime_error("MessagePack map keys must be strings");
+      }
+      result[key.asString()] = item(depth + 1);
+    }
+    return result;
+  }
+
+  Json::Value msgpackItem(unsigned depth) {
+    const auto b = byte();
+
+    if (b <= 0x7f) {
+      return Json::Value(static_cast<Json::Int64>(b));
+    } else if (b <= 0x8f) {
+      return msgpackMap(b & 0x0f, depth);
+    } else if (b <= 0x9f) {
+      return msgpackArray(b & 0x0f, depth);
+    } else if (b <= 0xbf) {
+      return Json::Value(bytes(b & 0x1f));
+    } else if (b >= 0xe0) {
+      return Json::Value(static_cast<Json::Int64>(static_cast<std::int8_t>(b)));
+    }
+
+    switch (b) {
+      case 0xc0:
+        return Json::Value::null;
+      case 0xc2:
+        return Json::Value(false);
+      case 0xc3:
+        return Json::Value(true);
+      case 0xc4:
+      case 0xc5:
+      case 0xc6:
+        return Json::Value(bytes(bigEndian(1u << (b - 0xc4))));
+      case 0xc7:
+      case 0xc8:
+      case 0xc9: {
+        // extension types carry no meaning for epJSON
+        const auto n = bigEndian(1u << (b - 0xc7));
+        byte();
+        bytes(n);
+        return Json::Value::null;
+      }
+      case 0xca:
+        return Json::Value(floatToDouble(static_cast<std::uint32_t>(bigEndian(4))));
+      case 0xcb:
+        return Json::Value(doubleFromBits(bigEndian(8)));
+      case 0xcc:
+      case 0xcd:
+      case 0xce:
+      case 0xcf:
+        return integer(bigEndian(1u << (b - 0xcc)));
+      case 0xd0:
+        return Json::Value(static_cast<Json::Int64>(static_cast<std::int8_t>(bigEndian(1))));
+      case 0xd1:
+        return Json::Value(static_cast<Json::Int64>(static_cast<std::int16_t>(bigEndian(2))));
+      case 0xd2:
+        return Json::Value(static_cast<Json::Int64>(static_cast<std::int32_t>(bigEndian(4))));
+      case 0xd3:
+        return Json::Value(static_cast<Json::Int64>(bigEndian(8)));
+      case 0xd4:
+      case 0xd5:
+      case 0xd6:
+      case 0xd7:
+      case 0xd8:
+        byte();
+        bytes(1u << (b - 0xd4));
+        return Json::Value::null;
+      case 0xd9:
+      case 0xda:
+      case 0xdb:
+        return Json::Value(bytes(bigEndian(1u << (b - 0xd9))));
+      case 0xdc:
+      case 0xdd:
+        return msgpackArray(bigEndian(2u << (b - 0xdc)), depth);
+      case 0xde:
+      case 0xdf:
+        return msgpackMap(bigEndian(2u << (b - 0xde)), depth);
+      default:
+        break;
+    }
+    throw std::runtime_error("Invalid MessagePack type byte");
+  }
+
+  const std::string& m_data;
+  std::size_t m_pos = 0;
+  Format m_format;
+};
+
+/** Text for an IDF field from a JSON value, numbers are written in shortest round trip form */
+boost::optional<std::string> toFieldString(const Json::Value& value) {
+  if (value.isString()) {
+    return value.asString();
+  } else if (value.isNull()) {
+    return std::string();
+  } else if (value.isInt64()) {
+    return std::to_string(value.asInt64());
+  } else if (value.isUInt64()) {
+    return std::to_string(value.asUInt64());
+  } else if (value.isDouble()) {
+    return fmt::format("{}", value.asDouble());
+  }
+  return boost::none;
+}
+
+/** Builds IdfObjects from the epJSON members of one object type, the inverse of ObjectTranslator */
+class ObjectReader
+{
+ public:
+  ObjectReader(const openstudio::IddObject& iddObject, const SchemaObject& schemaObject, std::map<std::string, std::string>& fieldNames)
+    : m_iddObject(iddObject), m_schemaObject(schemaObject), m_isFluidPropertiesName(iddObject.name().find("FluidProperties:Name") != std::string::npos) {
+
+    const auto& nonextensibleFields = iddObject.nonextensibleFields();
+    for (unsigned i = 0; i < nonextensibleFields.size(); ++i) {
+      m_fieldIndices.emplace(toJSONFieldName(fieldNames, nonextensibleFields[i].name()), i);
+    }
+
+    if (schemaObject.isArrayGroup) {
+      for (const auto& iddField : iddObject.extensibleGroup()) {
+        m_groupFieldNames.push_back(toJSONFieldName(fieldNames, iddField.name()));
+      }
+    } else if (!iddObject.extensibleGroup().empty()) {
+      // extensible fields are spelled out in legacy_idd > fields, at the index of the field in the IdfObject
+      for (auto i = nonextensibleFields.size(); i < schemaObject.legacyFieldNames.size(); ++i) {
+        m_fieldIndices.emplace(schemaObject.legacyFieldNames[i], static_cast<unsigned>(i));
+      }
+    }
+  }
+
+  boost::optional<openstudio::IdfObject> read(const std::string& name, const Json::Value& value) const {
+    if (!value.isObject()) {
+      LOG_FREE(LogLevel::Warn, "epJSONTranslator", "Skipping " << m_iddObject.name() << " '" << name << "', it is not a JSON object");
+      return boost::none;
+    }
+
+    openstudio::IdfObject result(m_iddObject);
+
+    if (m_iddObject.hasNameField()) {
+      const auto& fluidName = value["fluid_name"];
+      if (m_isFluidPropertiesName && fluidName.isString()) {
+        result.setName(fluidName.asString());
+      } else {
+        result.setName(name);
+      }
+    }
+
+    for (auto it = value.begin(); it != value.end(); ++it) {
+      const auto key = it.name();
+
+      if (m_schemaObject.isArrayGroup && key == m_schemaObject.groupName) {
+        readGroups(result, name, *it);
+        continue;
+      }
+
+      if (m_isFluidPropertiesName && key == "fluid_name") {
+        continue;
+      }
+
+      const auto index = m_fieldIndices.find(key);
+      if (index == m_fieldIndices.end()) {
+        LOG_FREE(LogLevel::Warn, "epJSONTranslator", "Ignoring unknown field '" << key << "' of " << m_iddObject.name() << " '" << name << "'");
+        continue;
+      }
+
+      const auto fieldString = toFieldString(*it);
+      if (!fieldString || !result.setString(index->second, *fieldString)) {
+        LOG_FREE(LogLevel::Warn, "epJSONTranslator", "Unable to set field '" << key << "' of " << m_iddObject.name() << " '" << name << "'");
+      }
+    }
+
+    return result;
+  }
+
+ private:
+  void readGroups(openstudio::IdfObject& result, const std::string& name, const Json::Value& groups) const {
+    if (!groups.isArray()) {
+      LOG_FREE(LogLevel::Warn, "epJSONTranslator",
+               "Ignoring '" << m_schemaObject.groupName << "' of " << m_iddObject.name() << " '" << name << "', it is not an array");
+      return;
+    }
+
+    for (const auto& group : groups) {
+      std::vector<std::string> values(m_groupFieldNames.size());
+      if (group.isObject()) {
+        for (auto it = group.begin(); it != group.end(); ++it) {
+          const auto key = it.name();
+          const auto position = std::find(m_groupFieldNames.cbegin(), m_groupFieldNames.cend(), key);
+          const auto fieldString = toFieldString(*it);
+          if (position == m_groupFieldNames.cend() || !fieldString) {
+            LOG_FREE(LogLevel::Warn, "epJSONTranslator",
+                     "Ignoring field '" << key << "' in '" << m_schemaObject.groupName << "' of " << m_iddObject.name() << " '" << name << "'");
+            continue;
+          }
+          values[position - m_groupFieldNames.cbegin()] = *fieldString;
+        }
+      }
+      if (result.pushExtensibleGroup(values).empty()) {
+        LOG_FREE(LogLevel::Warn, "epJSONTranslator",
+                 "Unable to add an entry of '" << m_schemaObject.groupName << "' to " << m_iddObject.name() << " '" << name << "'");
+      }
+    }
+  }
+
+  openstudio::IddObject m_iddObject;
+  const SchemaObject& m_schemaObject;
+  bool m_isFluidPropertiesName;
+  // JSON key => index of the field in the IdfObject
+  std::unordered_map<std::string, unsigned> m_fieldIndices;
+  // JSON keys of the fields of an array group entry, in extensible group order
+  std::vector<std::string> m_groupFieldNames;
+};
+
+boost::optional<openstudio::IdfFile> fromJSON(const Json::Value& root, const openstudio::path& schemaPath) {
+  if (!root.isObject()) {
+    LOG_FREE(LogLevel::Error, "epJSONTranslator", "The root of an epJSON document must be an object");
+    return boost::none;
+  }
+
+  openstudio::IdfFile result(openstudio::IddFileType::EnergyPlus);
+
+  const auto schema = loadSchemaFor(result, schemaPath);
+  if (!schema) {
+    return boost::none;
+  }
+
+  std::map<std::string, std::string> field_names;
+  std::vector<openstudio::IdfObject> objects;
+
+  for (auto typeIt = root.begin(); typeIt != root.end(); ++typeIt) {
+    const auto type_description = typeIt.name();
+
+    if (type_description == "Version") {
+      // the IdfFile already has the version object of its IDD
+      const auto& identifier = safeLookupValue(*typeIt, "Version 1", "version_identifier");
+      if (identifier.isString() && (identifier.asString() != versionIdentifier(result))) {
+        LOG_FREE(LogLevel::Warn, "epJSONTranslator",
+                 "epJSON document is version " << identifier.asString() << ", reading it with the " << versionIdentifier(result) << " IDD");
+      }
+      continue;
+    }
+
+    const auto iddObject = openstudio::IddFactory::instance().getObject(type_description);
+    if (!iddObject || !typeIt->isObject()) {
+      LOG_FREE(LogLevel::Warn, "epJSONTranslator", "Skipping unknown epJSON object type '" << type_description << "'");
+      continue;
+    }
+
+    static const SchemaObject missingSchemaObject;
+    const SchemaObject* schemaObject = schema->object(type_description);
+    if (schemaObject == nullptr) {
+      LOG_FREE(LogLevel::Error, "epJSONTranslator", "Unable to find epJSON schema object for patternProperties for " << type_description);
+      schemaObject = &missingSchemaObject;
+    }
+
+    auto names = typeIt->getMemberNames();
+    if (!iddObject->hasNameField()) {
+      // toJSON keys unnamed objects "<type> <n>", read them back in numeric rather than alphabetical order
+      std::stable_sort(names.begin(), names.end(),
+                       [](const std::string& lhs, const std::string& rhs) { return (lhs.size() < rhs.size()) || ((lhs.size() == rhs.size()) && (lhs < rhs)); });
+    }
+
+    const ObjectReader reader(*iddObject, *schemaObject, field_names);
+    for (const auto& name : names) {
+      if (auto object = reader.read(name, (*typeIt)[name])) {
+        objects.push_back(std::move(*object));
+      }
+    }
+  }
+
+  result.addObjects(objects);
+  return result;
+}
+
+boost::optional<openstudio::IdfFile> loadEpJSON(const openstudio::path& path, const openstudio::path& schemaPath) {
+  openstudio::filesystem::ifstream ifs(path, std::ios_base::binary);
+  if (!ifs.is_open()) {
+    LOG_FREE(LogLevel::Error, "epJSONTranslator", "Unable to open " << path);
+    return boost::none;
+  }
+
+  const auto extension = boost::to_lower_copy(openstudio::toString(path.extension()));
+
+  Json::Value root;
+  if (extension == ".cbor" || extension == ".msgpack") {
+    const std::string data{std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>()};
+    try {
+      root = BinaryJSONDecoder(data, (extension == ".cbor") ? BinaryJSONDecoder::Format::CBOR : BinaryJSONDecoder::Format::MessagePack).decode();
+    } catch (const std::exception& e) {
+      LOG_FREE(LogLevel::Error, "epJSONTranslator", "Unable to decode " << path << ": " << e.what());
+      return boost::none;
+    }
+  } else {
+    Json::CharReaderBuilder builder;
+    JSONCPP_STRING errs;
+    if (!Json::parseFromStream(builder, ifs, &root, &errs)) {
+      LOG_FREE(LogLevel::Error, "epJSONTranslator", "Unable to parse " << path << ": " << errs);
+      return boost::none;
+    }
+  }
+
+  return fromJSON(root, schemaPath);
+}
+
 }  // namespace openstudio::epJSON
@@ -29,11 +29,14 @@
 #ifndef EPJSON_TRANSLATOR_HPP
 #define EPJSON_TRANSLATOR_HPP
 
+#include <iosfwd>
 #include <string>
 #include "epJSONAPI.hpp"
 
 #include "../utilities/core/Filesystem.hpp"
 
+#include <boost/optional.hpp>
+
 namespace Json {
 class Value;
 }
@@ -56,6 +59,27 @@ EPJSON_API std::string toJSONString(const openstudio::IdfFile& inputFile, const
 EPJSON_API Json::Value toJSON(const openstudio::Workspace& workspace, const openstudio::path& schemaPath = openstudio::path());
 EPJSON_API std::string toJSONString(const openstudio::Workspace& workspace, const openstudio::path& schemaPath = openstudio::path());
 
+/** Writes the same document as toJSON straight to os without building a Json::Value, objects are translated one at a time.
+ *  Returns false if the schema cannot be loaded or the stream fails */
+EPJSON_API bool writeJSON(const openstudio::IdfFile& inputFile, std::ostream& os, const openstudio::path& schemaPath = openstudio::path());
+EPJSON_API bool writeJSON(const openstudio::Workspace& workspace, std::ostream& os, const openstudio::path& schemaPath = openstudio::path());
+
+/** Streams the epJSON to outputPath using writeJSON */
+EPJSON_API bool saveJSON(const openstudio::IdfFile& inputFile, const openstudio::path& outputPath,
+                         const openstudio::path& schemaPath = openstudio::path());
+EPJSON_API bool saveJSON(const openstudio::Workspace& workspace, const openstudio::path& outputPath,
+                         const openstudio::path& schemaPath = openstudio::path());
+
+/** Builds an EnergyPlus IdfFile straight from an epJSON document, the inverse of toJSON. Fields are placed by IDD field order,
+ *  objects are grouped by type. jsoncpp does not keep document order, so types come in sorted order, named objects are sorted
+ *  by name within their type and unnamed objects by the number in their "<type> <n>" key. Unknown object types and fields are skipped with a warning.
+ *  Returns boost::none if the root is not an object or the schema cannot be loaded */
+EPJSON_API boost::optional<openstudio::IdfFile> fromJSON(const Json::Value& root, const openstudio::path& schemaPath = openstudio::path());
+
+/** Loads an epJSON file with fromJSON. Files ending in .cbor or .msgpack are decoded as CBOR or MessagePack like EnergyPlus does,
+ *  anything else is parsed as JSON text */
+EPJSON_API boost::optional<openstudio::IdfFile> loadEpJSON(const openstudio::path& path, const openstudio::path& schemaPath = openstudio::path());
+
 }  // namespace openstudio::epJSON
 
 #endif
@@ -44,6 +44,7 @@
 #include "../../utilities/core/ApplicationPathHelpers.hpp"
 #include "../../utilities/core/PathHelpers.hpp"
 
+#include <utilities/idd/Building_FieldEnums.hxx>
 #include <utilities/idd/GroundHeatExchanger_ResponseFactors_FieldEnums.hxx>
 #include <utilities/idd/UnitarySystemPerformance_Multispeed_FieldEnums.hxx>
 #include <utilities/idd/IddEnums.hxx>
@@ -52,6 +53,8 @@
 #include <json/json.h>
 #include <resources.hxx>
 #include <algorithm>
+#include <sstream>
+#include <vector>
 
 openstudio::path setupIdftoEPJSONTest(const openstudio::path& location) {
   const auto basename = openstudio::toPath(openstudio::filesystem::basename(location));
@@ -392,6 +395,114 @@ TEST_F(epJSONFixture, toStringUilityWorksAsExpected) {
   EXPECT_EQ(str1, str2);
 }
 
+TEST_F(epJSONFixture, writeJSONMatchesToJSON) {
+
+  for (const auto* idfname : {"RefBldgMediumOfficeNew2004_Chicago.idf", "ASHRAE9012016_Hospital_Denver.idf"}) {
+    const auto setupIdf = setupIdftoEPJSONTest(completeIDFPath(idfname));
+    auto idf = openstudio::IdfFile::load(setupIdf);
+    ASSERT_TRUE(idf);
+
+    const auto expected = openstudio::epJSON::toJSON(*idf);
+    ASSERT_FALSE(expected.isNull());
+
+    std::stringstream ss;
+    ASSERT_TRUE(openstudio::epJSON::writeJSON(*idf, ss));
+    Json::Value streamed;
+    Json::CharReaderBuilder builder;
+    JSONCPP_STRING errs;
+    ASSERT_TRUE(Json::parseFromStream(builder, ss, &streamed, &errs)) << errs;
+    EXPECT_TRUE(expected == streamed) << idfname;
+
+    const auto outputLocation = setupIdf.parent_path() / openstudio::toPath("os-streamed.epJSON");
+    ASSERT_TRUE(openstudio::epJSON::saveJSON(*idf, outputLocation));
+    EXPECT_TRUE(expected == openstudio::epJSON::loadJSON(outputLocation)) << idfname;
+  }
+}
+
+TEST_F(epJSONFixture, writeJSONEscapesLikeJsoncpp) {
+  // UTF-8, a character outside the BMP, and malformed sequences in both a name (object key) and a string value
+  const std::string name = "Caf\xc3\xa9 \xf0\x9f\x98\x80 bad\xff truncated\xc3";
+  openstudio::IdfFile idf(openstudio::IddFileType::EnergyPlus);
+  openstudio::IdfObject building(openstudio::IddObjectType::Building);
+  EXPECT_TRUE(building.setName(name));
+  idf.addObject(building);
+  openstudio::IdfObject variable(openstudio::IddObjectType::Output_Variable);
+  EXPECT_TRUE(variable.setString(0, "Zone \xe2\x82\xac\x80"));
+  EXPECT_TRUE(variable.setString(1, "Zone Mean Air Temperature"));
+  idf.addObject(variable);
+
+  const auto expected = openstudio::epJSON::toJSON(idf);
+
+  std::stringstream ss;
+  ASSERT_TRUE(openstudio::epJSON::writeJSON(idf, ss));
+  const std::string streamedString = ss.str();
+  EXPECT_TRUE(std::all_of(streamedString.begin(), streamedString.end(), [](char c) { return static_cast<unsigned char>(c) < 0x80; }));
+  EXPECT_NE(std::string::npos, streamedString.find("Caf\\u00e9 \\ud83d\\ude00 bad\\ufffd truncated\\ufffd"));
+  EXPECT_NE(std::string::npos, streamedString.find("Zone \\u20ac\\ufffd"));
+
+  Json::Value streamed;
+  Json::CharReaderBuilder builder;
+  JSONCPP_STRING errs;
+  ASSERT_TRUE(Json::parseFromStream(builder, ss, &streamed, &errs)) << errs;
+  // malformed sequences read back as U+FFFD, so compare what jsoncpp writes for both documents
+  EXPECT_EQ(expected.toStyledString(), streamed.toStyledString());
+}
+
+TEST_F(epJSONFixture, fromJSONRoundTrip) {
+
+  for (const auto* idfname : {"RefBldgMediumOfficeNew2004_Chicago.idf", "ASHRAE9012016_Hospital_Denver.idf"}) {
+    const auto setupIdf = setupIdftoEPJSONTest(completeIDFPath(idfname));
+    auto idf = openstudio::IdfFile::load(setupIdf);
+    ASSERT_TRUE(idf);
+
+    const auto expected = openstudio::epJSON::toJSON(*idf);
+    ASSERT_FALSE(expected.isNull());
+
+    const auto readBack = openstudio::epJSON::fromJSON(expected);
+    ASSERT_TRUE(readBack) << idfname;
+    EXPECT_TRUE(expected == openstudio::epJSON::toJSON(*readBack)) << idfname;
+
+    const auto outputLocation = setupIdf.parent_path() / openstudio::toPath("os-read.epJSON");
+    ASSERT_TRUE(openstudio::epJSON::saveJSON(*idf, outputLocation));
+    const auto loaded = openstudio::epJSON::loadEpJSON(outputLocation);
+    ASSERT_TRUE(loaded) << idfname;
+    EXPECT_TRUE(expected == openstudio::epJSON::toJSON(*loaded)) << idfname;
+  }
+}
+
+TEST_F(epJSONFixture, loadEpJSON_BinaryFormats) {
+
+  const auto basePath = openstudio::toPath("epjson_tests") / openstudio::toPath("BinaryFormats");
+  openstudio::filesystem::create_directories(basePath);
+
+  const auto writeBytes = [&basePath](const std::string& fileName, const std::vector<unsigned char>& bytes) {
+    const auto path = basePath / openstudio::toPath(fileName);
+    openstudio::filesystem::ofstream ofs(path, std::ios_base::binary | std::ios_base::trunc);
+    ofs.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+    return path;
+  };
+
+  // {"Building": {"My Building": {"north_axis": 30}}}
+  const std::vector<unsigned char> cbor{0xa1, 0x68, 'B', 'u', 'i', 'l', 'd', 'i', 'n', 'g', 0xa1, 0x6b, 'M', 'y', ' ', 'B', 'u', 'i', 'l', 'd',
+                                        'i',  'n',  'g', 0xa1, 0x6a, 'n', 'o', 'r', 't', 'h', '_', 'a', 'x', 'i', 's', 0x18, 0x1e};
+  const std::vector<unsigned char> msgpack{0x81, 0xa8, 'B', 'u', 'i', 'l', 'd', 'i', 'n', 'g', 0x81, 0xab, 'M', 'y', ' ', 'B', 'u', 'i', 'l',
+                                           'd',  'i',  'n', 'g', 0x81, 0xaa, 'n', 'o', 'r', 't', 'h', '_', 'a', 'x', 'i', 's', 0x1e};
+
+  for (const auto& path : {writeBytes("test.cbor", cbor), writeBytes("test.msgpack", msgpack)}) {
+    const auto idf = openstudio::epJSON::loadEpJSON(path);
+    ASSERT_TRUE(idf) << path;
+    const auto buildings = idf->getObjectsByType(openstudio::IddObjectType::Building);
+    ASSERT_EQ(1u, buildings.size());
+    EXPECT_EQ("My Building", buildings[0].nameString());
+    ASSERT_TRUE(buildings[0].getDouble(openstudio::BuildingFields::NorthAxis));
+    EXPECT_DOUBLE_EQ(30.0, buildings[0].getDouble(openstudio::BuildingFields::NorthAxis).get());
+  }
+
+  // truncated documents are rejected
+  EXPECT_FALSE(openstudio::epJSON::loadEpJSON(writeBytes("truncated.cbor", std::vector<unsigned char>(cbor.begin(), cbor.end() - 1))));
+  EXPECT_FALSE(openstudio::epJSON::loadEpJSON(writeBytes("truncated.msgpack", std::vector<unsigned char>(msgpack.begin(), msgpack.end() - 1))));
+}
+
 TEST_F(epJSONFixture, canTranslateWorkspaceToJSON) {
   auto m = openstudio::model::exampleModel();
   openstudio::energyplus::ForwardTranslator ft;
@@ -458,3 +569,59 @@ TEST_F(epJSONFixture, Autosize_case_sensitiveness) {
   const auto& flow_ratio = json_perf["flow_ratios"][0];
   EXPECT_EQ("Autosize", flow_ratio["heating_speed_supply_air_flow_ratio"].asString());
 }
+
+TEST_F(epJSONFixture, CachedSchema_ReloadedWhenFileChanges) {
+
+  const auto writeSchema = [](const openstudio::path& path, const std::string& autoOption) {
+    std::ofstream ofs(openstudio::toString(path), std::ofstream::trunc);
+    ofs << fmt::format(R"json({{"properties": {{"UnitarySystemPerformance:Multispeed": {{
+  "patternProperties": {{"^.*\\S.*$": {{"properties": {{
+    "number_of_speeds_for_heating": {{"type": "number"}},
+    "number_of_speeds_for_cooling": {{"type": "number"}},
+    "single_mode_operation": {{"type": "string", "enum": ["", "Yes", "No"]}},
+    "no_load_supply_air_flow_rate_ratio": {{"type": "number"}},
+    "flow_ratios": {{"type": "array", "items": {{"properties": {{
+      "heating_speed_supply_air_flow_ratio": {{"anyOf": [{{"type": "number"}}, {{"type": "string", "enum": ["{0}"]}}]}},
+      "cooling_speed_supply_air_flow_ratio": {{"anyOf": [{{"type": "number"}}, {{"type": "string", "enum": ["{0}"]}}]}}
+    }}}}}}
+  }}}}}},
+  "legacy_idd": {{"fields": ["name", "number_of_speeds_for_heating", "number_of_speeds_for_cooling", "single_mode_operation",
+                              "no_load_supply_air_flow_rate_ratio"]}}
+}}}}}})json",
+                       autoOption);
+  };
+
+  const auto working_directory = openstudio::filesystem::complete(openstudio::toPath("epjson_tests") / openstudio::toPath("CachedSchema"));
+  openstudio::filesystem::create_directories(working_directory);
+  const auto schemaPath = working_directory / openstudio::toPath("test.schema.epJSON");
+  writeSchema(schemaPath, "Autosize");
+
+  openstudio::Workspace w(openstudio::StrictnessLevel::None, openstudio::IddFileType::EnergyPlus);
+  openstudio::WorkspaceObject wo = w.addObject(openstudio::IdfObject(openstudio::IddObjectType::UnitarySystemPerformance_Multispeed)).get();
+  wo.setName("Unitary Performance Multispeed");
+  EXPECT_TRUE(wo.setString(openstudio::UnitarySystemPerformance_MultispeedFields::SingleModeOperation, "yes"));
+  auto eg = wo.pushExtensibleGroup();
+  EXPECT_TRUE(eg.setString(openstudio::UnitarySystemPerformance_MultispeedExtensibleFields::HeatingSpeedSupplyAirFlowRatio, "autosize"));
+  EXPECT_TRUE(eg.setDouble(openstudio::UnitarySystemPerformance_MultispeedExtensibleFields::CoolingSpeedSupplyAirFlowRatio, 0.42));
+
+  // translate twice against the cached schema
+  for (int i = 0; i < 2; ++i) {
+    auto json = openstudio::epJSON::toJSON(w, schemaPath);
+    const Json::Value& json_perf = json["UnitarySystemPerformance:Multispeed"]["Unitary Performance Multispeed"];
+    EXPECT_EQ("Yes", json_perf["single_mode_operation"].asString());
+    ASSERT_EQ(1u, json_perf["flow_ratios"].size());
+    EXPECT_EQ("Autosize", json_perf["flow_ratios"][0]["heating_speed_supply_air_flow_ratio"].asString());
+    EXPECT_DOUBLE_EQ(0.42, json_perf["flow_ratios"][0]["cooling_speed_supply_air_flow_ratio"].asDouble());
+  }
+
+  // a changed schema file is parsed again
+  writeSchema(schemaPath, "Autocalculate");
+  auto json = openstudio::epJSON::toJSON(w, schemaPath);
+  const Json::Value& json_perf = json["UnitarySystemPerformance:Multispeed"]["Unitary Performance Multispeed"];
+  ASSERT_EQ(1u, json_perf["flow_ratios"].size());
+  EXPECT_EQ("Autocalculate", json_perf["flow_ratios"][0]["heating_speed_supply_air_flow_ratio"].asString());
+
+  // a missing schema gives a null result
+  openstudio::filesystem::remove(schemaPath);
+  EXPECT_TRUE(openstudio::epJSON::toJSON(w, schemaPath).isNull());
+}
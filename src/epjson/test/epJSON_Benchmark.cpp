@@ -0,0 +1,50 @@
+#include <benchmark/benchmark.h>
+
+#include "../epJSONTranslator.hpp"
+
+#include "../../utilities/core/ApplicationPathHelpers.hpp"
+#include "../../utilities/idf/IdfFile.hpp"
+
+#include <sstream>
+#include <stdexcept>
+
+using namespace openstudio;
+
+// Large EnergyPlus example files, also translated in epJSONTranslator_GTest
+static IdfFile loadExampleFile(const std::string& idfname) {
+  auto idf = IdfFile::load(getEnergyPlusDirectory() / toPath("ExampleFiles") / toPath(idfname));
+  if (!idf) {
+    throw std::runtime_error("Cannot load " + idfname);
+  }
+  return *idf;
+}
+
+static void BM_ToJSONString(benchmark::State& state, const std::string& idfname) {
+  IdfFile idf = loadExampleFile(idfname);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(epJSON::toJSONString(idf));
+  }
+}
+
+static void BM_WriteJSON(benchmark::State& state, const std::string& idfname) {
+  IdfFile idf = loadExampleFile(idfname);
+
+  for (auto _ : state) {
+    std::ostringstream ss;
+    epJSON::writeJSON(idf, ss);
+    benchmark::DoNotOptimize(ss.str());
+  }
+}
+
+BENCHMARK_CAPTURE(BM_ToJSONString, RefBldgMediumOfficeNew2004_Chicago, std::string("RefBldgMediumOfficeNew2004_Chicago.idf"));
+BENCHMARK_CAPTURE(BM_WriteJSON, RefBldgMediumOfficeNew2004_Chicago, std::string("RefBldgMediumOfficeNew2004_Chicago.idf"));
+
+BENCHMARK_CAPTURE(BM_ToJSONString, ASHRAE9012016_Hospital_Denver, std::string("ASHRAE9012016_Hospital_Denver.idf"));
+BENCHMARK_CAPTURE(BM_WriteJSON, ASHRAE9012016_Hospital_Denver, std::string("ASHRAE9012016_Hospital_Denver.idf"));
+
+BENCHMARK_CAPTURE(BM_ToJSONString, HospitalBaselineReheatReportEMS, std::string("HospitalBaselineReheatReportEMS.idf"));
+BENCHMARK_CAPTURE(BM_WriteJSON, HospitalBaselineReheatReportEMS, std::string("HospitalBaselineReheatReportEMS.idf"));
+
+BENCHMARK_CAPTURE(BM_ToJSONString, RefrigeratedWarehouse, std::string("RefrigeratedWarehouse.idf"));
+BENCHMARK_CAPTURE(BM_WriteJSON, RefrigeratedWarehouse, std::string("RefrigeratedWarehouse.idf"));
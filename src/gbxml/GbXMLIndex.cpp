@@ -0,0 +1,323 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2021, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "GbXMLIndex.hpp"
+
+#include <cctype>
+#include <cstdlib>
+
+namespace openstudio {
+namespace gbxml {
+
+  namespace {
+
+    /// reads a stream through a large buffer and keeps track of the byte offset
+    class BufferedReader
+    {
+     public:
+      explicit BufferedReader(std::istream& is) : m_is(is), m_buffer(1 << 20), m_pos(0), m_end(0), m_offset(0) {}
+
+      // returns the next byte or -1 at the end of the stream
+      int get() {
+        if (m_pos == m_end && !fill()) {
+          return -1;
+        }
+        ++m_offset;
+        return static_cast<unsigned char>(m_buffer[m_pos++]);
+      }
+
+      int peek() {
+        if (m_pos == m_end && !fill()) {
+          return -1;
+        }
+        return static_cast<unsigned char>(m_buffer[m_pos]);
+      }
+
+      // offset of the next byte returned by get
+      std::streamoff offset() const {
+        return m_offset;
+      }
+
+      // consumes bytes up to and including terminator, returns false if the stream ends first
+      bool skipUntil(const std::string& terminator) {
+        std::string window;
+        int c;
+        while ((c = get()) != -1) {
+          window += static_cast<char>(c);
+          if (window.size() > terminator.size()) {
+            window.erase(0, 1);
+          }
+          if (window == terminator) {
+            return true;
+          }
+        }
+        return false;
+      }
+
+     private:
+      bool fill() {
+        m_is.read(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+        m_pos = 0;
+        m_end = static_cast<size_t>(m_is.gcount());
+        return m_end > 0;
+      }
+
+      std::istream& m_is;
+      std::vector<char> m_buffer;
+      size_t m_pos;
+      size_t m_end;
+      std::streamoff m_offset;
+    };
+
+    bool isNameEnd(int c) {
+      return c == -1 || std::isspace(c) || c == '/' || c == '>' || c == '=';
+    }
+
+    // decodes the predefined and numeric character references pugixml decodes by default
+    std::string decodeAttribute(const std::string& value) {
+      if (value.find('&') == std::string::npos) {
+        return value;
+      }
+      std::string result;
+      result.reserve(value.size());
+      size_t i = 0;
+      while (i < value.size()) {
+        size_t semicolon = value.find(';', i);
+        if (value[i] != '&' || semicolon == std::string::npos) {
+          result += value[i++];
+          continue;
+        }
+        std::string ref = value.substr(i + 1, semicolon - i - 1);
+        if (ref == "amp") {
+          result += '&';
+        } else if (ref == "lt") {
+          result += '<';
+        } else if (ref == "gt") {
+          result += '>';
+        } else if (ref == "quot") {
+          result += '"';
+        } else if (ref == "apos") {
+          result += '\'';
+        } else if (ref.size() > 1 && ref[0] == '#') {
+          unsigned long code = (ref[1] == 'x') ? std::strtoul(ref.c_str() + 2, nullptr, 16) : std::strtoul(ref.c_str() + 1, nullptr, 10);
+          if (code > 0 && code < 0x80) {
+            result += static_cast<char>(code);
+          } else {
+            // not needed for ids in practice, keep the reference as is
+            result += '&' + ref + ';';
+          }
+        } else {
+          result += '&' + ref + ';';
+        }
+        i = semicolon + 1;
+      }
+      return result;
+    }
+
+  }  // namespace
+
+  GbXMLIndex::GbXMLIndex(std::istream& is) : m_valid(false), m_size(0) {
+    scan(is);
+  }
+
+  bool GbXMLIndex::valid() const {
+    return m_valid;
+  }
+
+  std::streamoff GbXMLIndex::size() const {
+    return m_size;
+  }
+
+  const std::vector<GbXMLIndex::Entry>& GbXMLIndex::entries() const {
+    return m_entries;
+  }
+
+  std::vector<GbXMLIndex::Entry> GbXMLIndex::entries(const std::string& name, const std::string& parentName) const {
+    std::vector<Entry> result;
+    for (const Entry& entry : m_entries) {
+      if (entry.name == name && entry.parentName == parentName) {
+        result.push_back(entry);
+      }
+    }
+    return result;
+  }
+
+  std::string GbXMLIndex::read(std::istream& is, const Entry& entry) {
+    std::string result(static_cast<size_t>(entry.length), '\0');
+    is.clear();
+    is.seekg(entry.offset);
+    is.read(&result[0], entry.length);
+    if (is.gcount() != entry.length) {
+      result.resize(static_cast<size_t>(is.gcount()));
+    }
+    return result;
+  }
+
+  void GbXMLIndex::scan(std::istream& is) {
+    BufferedReader reader(is);
+
+    // only UTF-8 and other ASCII compatible encodings can be scanned byte by byte
+    int first = reader.peek();
+    if (first == 0 || first == 0xFE || first == 0xFF) {
+      return;
+    }
+
+    // names of open elements and the index of their entry, or -1 if not indexed
+    std::vector<std::string> names;
+    std::vector<long> openEntries;
+    bool sawRoot = false;
+
+    int c;
+    while ((c = reader.get()) != -1) {
+      if (c != '<') {
+        continue;
+      }
+      std::streamoff start = reader.offset() - 1;
+
+      c = reader.get();
+      if (c == '?') {
+        if (!reader.skipUntil("?>")) {
+          return;
+        }
+      } else if (c == '!') {
+        if (reader.peek() == '-') {
+          reader.get();
+          if (reader.get() != '-' || !reader.skipUntil("-->")) {
+            return;
+          }
+        } else if (reader.peek() == '[') {
+          if (!reader.skipUntil("]]>")) {
+            return;
+          }
+        } else {
+          // DOCTYPE, may contain an internal subset in brackets
+          int depth = 0;
+          while ((c = reader.get()) != -1) {
+            if (c == '[') {
+              ++depth;
+            } else if (c == ']') {
+              --depth;
+            } else if (c == '>' && depth == 0) {
+              break;
+            }
+          }
+          if (c == -1) {
+            return;
+          }
+        }
+      } else if (c == '/') {
+        std::string name;
+        while ((c = reader.get()) != -1 && c != '>') {
+          if (!std::isspace(c)) {
+            name += static_cast<char>(c);
+          }
+        }
+        if (c == -1 || names.empty() || names.back() != name) {
+          return;
+        }
+        if (openEntries.back() >= 0) {
+          Entry& entry = m_entries[static_cast<size_t>(openEntries.back())];
+          entry.length = reader.offset() - entry.offset;
+        }
+        names.pop_back();
+        openEntries.pop_back();
+      } else if (c != -1) {
+        std::string name(1, static_cast<char>(c));
+        while (!isNameEnd(reader.peek())) {
+          name += static_cast<char>(reader.get());
+        }
+
+        bool selfClosing = false;
+        std::string attributeName;
+        std::string id;
+        while (true) {
+          c = reader.get();
+          if (c == -1) {
+            return;
+          } else if (c == '>') {
+            break;
+          } else if (c == '/') {
+            selfClosing = true;
+          } else if (std::isspace(c) || c == '=') {
+            continue;
+          } else if (c == '"' || c == '\'') {
+            int quote = c;
+            std::string value;
+            while ((c = reader.get()) != -1 && c != quote) {
+              value += static_cast<char>(c);
+            }
+            if (c == -1) {
+              return;
+            }
+            if (attributeName == "id") {
+              id = decodeAttribute(value);
+            }
+            attributeName.clear();
+            selfClosing = false;
+          } else {
+            attributeName.assign(1, static_cast<char>(c));
+            while (!isNameEnd(reader.peek())) {
+              attributeName += static_cast<char>(reader.get());
+            }
+            selfClosing = false;
+          }
+        }
+
+        if (names.empty()) {
+          if (sawRoot) {
+            // more than one root element
+            return;
+          }
+          sawRoot = true;
+        }
+
+        size_t depth = names.size();
+        bool indexed = (depth == 1) || (depth == 2 && names[1] == "Campus") || (depth == 3 && names[1] == "Campus" && names[2] == "Building");
+
+        long entryIndex = -1;
+        if (indexed) {
+          entryIndex = static_cast<long>(m_entries.size());
+          m_entries.push_back(Entry{name, id, names.back(), start, selfClosing ? reader.offset() - start : 0});
+        }
+
+        if (!selfClosing) {
+          names.push_back(name);
+          openEntries.push_back(entryIndex);
+        }
+      } else {
+        return;
+      }
+    }
+
+    m_size = reader.offset();
+    m_valid = sawRoot && names.empty();
+  }
+
+}  // namespace gbxml
+}  // namespace openstudio
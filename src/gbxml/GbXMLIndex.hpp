@@ -0,0 +1,89 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2021, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef GBXML_GBXMLINDEX_HPP
+#define GBXML_GBXMLINDEX_HPP
+
+#include "gbXMLAPI.hpp"
+
+#include <istream>
+#include <string>
+#include <vector>
+
+namespace openstudio {
+namespace gbxml {
+
+  /** GbXMLIndex records the byte range of the top level elements of a gbXML document without building a DOM.
+   *  Indexed elements are the children of the gbXML root (Material, Layer, Construction, Zone, Campus, ...), the
+   *  children of Campus (Building, Surface, ...) and the children of Building (BuildingStorey, Space, ...).
+   *  This lets ReverseTranslator parse the small part of the document that needs random access as a DOM and read
+   *  Surface elements, which make up most of large files, in chunks directly from the file. */
+  class GBXML_API GbXMLIndex
+  {
+   public:
+    struct Entry
+    {
+      std::string name;
+      std::string id;
+      std::string parentName;
+      // byte offset of the '<' of the start tag and byte length up to and including the end tag
+      std::streamoff offset;
+      std::streamoff length;
+    };
+
+    /// Scans the document in is, the stream is read to the end. Check valid() before use.
+    explicit GbXMLIndex(std::istream& is);
+
+    /// False if the document is not well formed enough to be indexed or uses an encoding that is not ASCII compatible
+    bool valid() const;
+
+    /// Total number of bytes scanned
+    std::streamoff size() const;
+
+    /// All indexed entries in document order
+    const std::vector<Entry>& entries() const;
+
+    /// Indexed entries with the given element name and parent element name, in document order
+    std::vector<Entry> entries(const std::string& name, const std::string& parentName) const;
+
+    /// Reads the bytes of entry from is
+    static std::string read(std::istream& is, const Entry& entry);
+
+   private:
+    void scan(std::istream& is);
+
+    bool m_valid;
+    std::streamoff m_size;
+    std::vector<Entry> m_entries;
+  };
+
+}  // namespace gbxml
+}  // namespace openstudio
+
+#endif  // GBXML_GBXMLINDEX_HPP
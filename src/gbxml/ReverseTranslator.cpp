@@ -87,7 +87,13 @@ namespace gbxml {
     return os;
   }
 
-  ReverseTranslator::ReverseTranslator() : m_nonBaseMultiplier(1.0), m_lengthMultiplier(1.0) {
+  ReverseTranslator::ReverseTranslator()
+    : m_nonBaseMultiplier(1.0),
+      m_lengthMultiplier(1.0),
+      m_streamSurfaces(false),
+      m_surfaceChunkSize(1000),
+      m_surfaceStream(nullptr),
+      m_surfaceEncoding(pugi::encoding_auto) {
     m_logSink.setLogLevel(Warn);
     m_logSink.setChannelRegex(boost::regex("openstudio\\.gbxml\\.ReverseTranslator"));
     m_logSink.setThreadId(std::this_thread::get_id());
@@ -104,25 +110,62 @@ namespace gbxml {
 
     m_idToObjectMap.clear();
 
+    m_streamedSurfaces.clear();
+    m_surfaceStream = nullptr;
+
     boost::optional<openstudio::model::Model> result;
 
     if (openstudio::filesystem::exists(path)) {
 
       openstudio::filesystem::ifstream file(path, std::ios_base::binary);
       if (file.is_open()) {
-        pugi::xml_document doc;
-        auto load_result = doc.load(file);
-        if (load_result) {
-          result = this->convert(doc.document_element());
+        boost::optional<GbXMLIndex> index;
+        if (m_streamSurfaces) {
+          index = GbXMLIndex(file);
+          if (!index->valid()) {
+            LOG(Warn, "Could not index '" << toString(path) << "', loading the whole document");
+            index.reset();
+          }
+          file.clear();
+          file.seekg(0);
+        }
+
+        if (index) {
+          result = this->convertStreaming(file, *index);
+        } else {
+          pugi::xml_document doc;
+          auto load_result = doc.load(file);
+          if (load_result) {
+            result = this->convert(doc.document_element());
+          }
         }
         file.close();
       }
       // JWD: Would be nice to add some error handling here
     }
 
+    m_streamedSurfaces.clear();
+    m_surfaceStream = nullptr;
+
     return result;
   }
 
+  void ReverseTranslator::setStreamSurfaces(bool streamSurfaces) {
+    m_streamSurfaces = streamSurfaces;
+  }
+
+  bool ReverseTranslator::streamSurfaces() const {
+    return m_streamSurfaces;
+  }
+
+  void ReverseTranslator::setSurfaceChunkSize(unsigned surfaceChunkSize) {
+    m_surfaceChunkSize = std::max(surfaceChunkSize, 1u);
+  }
+
+  unsigned ReverseTranslator::surfaceChunkSize() const {
+    return m_surfaceChunkSize;
+  }
+
   std::vector<LogMessage> ReverseTranslator::warnings() const {
     std::vector<LogMessage> result;
 
@@ -161,6 +204,87 @@ namespace gbxml {
     return translateGBXML(root);
   }
 
+  boost::optional<model::Model> ReverseTranslator::convertStreaming(std::istream& is, const GbXMLIndex& index) {
+    std::vector<GbXMLIndex::Entry> surfaces = index.entries("Surface", "Campus");
+
+    std::streamoff surfacesLength = 0;
+    for (const auto& surface : surfaces) {
+      surfacesLength += surface.length;
+    }
+
+    // copy everything except the Surface elements into the document that is parsed as a DOM
+    std::string skeleton;
+    skeleton.reserve(static_cast<size_t>(index.size() - surfacesLength));
+    std::vector<char> buffer(1 << 20);
+    std::streamoff pos = 0;
+    auto copyUntil = [&](std::streamoff end) {
+      is.clear();
+      is.seekg(pos);
+      while (pos < end) {
+        std::streamsize count = static_cast<std::streamsize>(std::min<std::streamoff>(end - pos, buffer.size()));
+        is.read(buffer.data(), count);
+        if (is.gcount() != count) {
+          break;
+        }
+        skeleton.append(buffer.data(), static_cast<size_t>(count));
+        pos += count;
+      }
+    };
+    for (const auto& surface : surfaces) {
+      copyUntil(surface.offset);
+      pos = surface.offset + surface.length;
+    }
+    copyUntil(index.size());
+
+    pugi::xml_document doc;
+    auto load_result = doc.load_buffer_inplace(&skeleton[0], skeleton.size());
+    if (!load_result) {
+      LOG(Error, "Could not parse gbXML document: " << load_result.description());
+      return boost::none;
+    }
+
+    m_streamedSurfaces = std::move(surfaces);
+    m_surfaceStream = &is;
+    m_surfaceEncoding = load_result.encoding;
+
+    return convert(doc.document_element());
+  }
+
+  void ReverseTranslator::translateStreamedSurfaces(openstudio::model::Model& model) {
+    if (!m_surfaceStream) {
+      return;
+    }
+
+    for (size_t begin = 0; begin < m_streamedSurfaces.size(); begin += m_surfaceChunkSize) {
+      size_t end = std::min(begin + m_surfaceChunkSize, m_streamedSurfaces.size());
+
+      std::string chunk;
+      for (size_t i = begin; i < end; ++i) {
+        chunk += GbXMLIndex::read(*m_surfaceStream, m_streamedSurfaces[i]);
+      }
+
+      pugi::xml_document chunkDoc;
+      auto load_result = chunkDoc.load_buffer_inplace(&chunk[0], chunk.size(), pugi::parse_default | pugi::parse_fragment,
+                                                      static_cast<pugi::xml_encoding>(m_surfaceEncoding));
+      if (!load_result) {
+        LOG(Error, "Could not parse surfaces " << begin << " to " << end - 1 << ": " << load_result.description());
+        continue;
+      }
+
+      for (auto& surfEl : chunkDoc.children("Surface")) {
+        try {
+          boost::optional<model::ModelObject> surface = translateSurface(surfEl, model);
+        } catch (const std::exception&) {
+          LOG(Error, "Could not translate surface " << surfEl);
+        }
+
+        if (m_progressBar) {
+          m_progressBar->setValue(m_progressBar->value() + 1);
+        }
+      }
+    }
+  }
+
   boost::optional<model::Model> ReverseTranslator::translateGBXML(const pugi::xml_node& root) {
     openstudio::model::Model model;
     model.setFastNaming(true);
@@ -350,7 +474,7 @@ namespace gbxml {
     if (m_progressBar) {
       m_progressBar->setWindowTitle(toString("Translating Surfaces"));
       m_progressBar->setMinimum(0);
-      m_progressBar->setMaximum((int)std::distance(surfaceElements.begin(), surfaceElements.end()));
+      m_progressBar->setMaximum((int)(std::distance(surfaceElements.begin(), surfaceElements.end()) + m_streamedSurfaces.size()));
       m_progressBar->setValue(0);
     }
 
@@ -366,6 +490,9 @@ namespace gbxml {
       }
     }
 
+    // Surface elements that were not loaded into the DOM
+    translateStreamedSurfaces(model);
+
     return facility;
   }
 
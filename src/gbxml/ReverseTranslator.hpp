@@ -33,6 +33,7 @@
 #define GBXML_REVERSETRANSLATOR_HPP
 
 #include "gbXMLAPI.hpp"
+#include "GbXMLIndex.hpp"
 
 #include "../utilities/core/Path.hpp"
 #include "../utilities/core/Optional.hpp"
@@ -67,6 +68,16 @@ namespace gbxml {
 
     boost::optional<openstudio::model::Model> loadModel(const openstudio::path& path, ProgressBar* progressBar = nullptr);
 
+    /** If true, loadModel first indexes the file and only parses the elements outside of Campus/Surface as a DOM,
+     *  Surface elements are then read from the file and translated in chunks. This bounds memory use for very large
+     *  files. The translated model is the same in both modes. Defaults to false. */
+    void setStreamSurfaces(bool streamSurfaces);
+    bool streamSurfaces() const;
+
+    /** Number of Surface elements parsed at a time if streamSurfaces is true. Defaults to 1000. */
+    void setSurfaceChunkSize(unsigned surfaceChunkSize);
+    unsigned surfaceChunkSize() const;
+
     /** Get warning messages generated by the last translation. */
     std::vector<LogMessage> warnings() const;
 
@@ -88,8 +99,19 @@ namespace gbxml {
 
     std::map<std::string, openstudio::model::ModelObject> m_idToObjectMap;
 
+    bool m_streamSurfaces;
+    unsigned m_surfaceChunkSize;
+
+    // Surface elements left out of the DOM when streaming surfaces, read from m_surfaceStream by translateStreamedSurfaces
+    std::vector<GbXMLIndex::Entry> m_streamedSurfaces;
+    std::istream* m_surfaceStream;
+    // pugi::xml_encoding of the document
+    int m_surfaceEncoding;
+
     // In ReverseTranslator.cpp
     boost::optional<openstudio::model::Model> convert(const pugi::xml_node& root);
+    boost::optional<openstudio::model::Model> convertStreaming(std::istream& is, const GbXMLIndex& index);
+    void translateStreamedSurfaces(openstudio::model::Model& model);
     boost::optional<openstudio::model::Model> translateGBXML(const pugi::xml_node& root);
     boost::optional<openstudio::model::ModelObject> translateCampus(const pugi::xml_node& element, openstudio::model::Model& model);
     boost::optional<openstudio::model::ModelObject> translateBuilding(const pugi::xml_node& element, openstudio::model::Model& model);
@@ -0,0 +1,112 @@
+#include <benchmark/benchmark.h>
+
+#include "../ReverseTranslator.hpp"
+
+#include "../../model/Model.hpp"
+#include "../../model/Surface.hpp"
+#include "../../model/Surface_Impl.hpp"
+
+#include "../../utilities/core/Filesystem.hpp"
+
+#include <fmt/format.h>
+
+using namespace openstudio;
+
+// Writes a gbXML campus of numSpaces 10 m x 10 m x 3 m boxes in a row, each with its own zone. Walls between
+// neighboring boxes are shared interior surfaces, every exterior wall has a window
+static openstudio::path generateGbXML(int numSpaces) {
+  openstudio::path p = openstudio::filesystem::temp_directory_path() / toPath(fmt::format("ReverseTranslator_Benchmark_{}.xml", numSpaces));
+  if (openstudio::filesystem::exists(p)) {
+    return p;
+  }
+
+  openstudio::filesystem::ofstream file(p);
+  auto polyLoop = [](const std::vector<std::array<double, 3>>& points) {
+    std::string result = "<PlanarGeometry><PolyLoop>";
+    for (const auto& point : points) {
+      result += fmt::format("<CartesianPoint><Coordinate>{}</Coordinate><Coordinate>{}</Coordinate><Coordinate>{}</Coordinate></CartesianPoint>",
+                            point[0], point[1], point[2]);
+    }
+    return result + "</PolyLoop></PlanarGeometry>";
+  };
+  auto surface = [&](const std::string& id, const std::string& type, const std::vector<std::string>& spaces, bool exposed,
+                     const std::vector<std::array<double, 3>>& points, const std::string& opening) {
+    std::string result = fmt::format(R"(<Surface id="{}" surfaceType="{}" constructionIdRef="{}" exposedToSun="{}"><Name>{}</Name>)", id, type,
+                                     exposed ? "construction-exterior" : "construction-interior", exposed ? "true" : "false", id);
+    for (const auto& space : spaces) {
+      result += fmt::format(R"(<AdjacentSpaceId spaceIdRef="{}"/>)", space);
+    }
+    return result + polyLoop(points) + opening + "</Surface>\n";
+  };
+
+  file << R"(<?xml version="1.0" encoding="UTF-8"?>)" << '\n';
+  file << R"(<gbXML xmlns="http://www.gbxml.org/schema" temperatureUnit="C" lengthUnit="Meters" areaUnit="SquareMeters" volumeUnit="CubicMeters" useSIUnitsForResults="true" version="6.01">)"
+       << '\n';
+  file << R"(<Material id="material-1"><Name>Material 1</Name><Thickness unit="Meters">0.1</Thickness><Conductivity unit="WPerMeterK">0.5</Conductivity><Density unit="KgPerCubicM">1000</Density><SpecificHeat unit="JPerKgK">1000</SpecificHeat></Material>)"
+       << '\n';
+  file << R"(<Layer id="layer-1"><MaterialId materialIdRef="material-1"/></Layer>)" << '\n';
+  file << R"(<Construction id="construction-exterior"><Name>Exterior</Name><LayerId layerIdRef="layer-1"/></Construction>)" << '\n';
+  file << R"(<Construction id="construction-interior"><Name>Interior</Name><LayerId layerIdRef="layer-1"/></Construction>)" << '\n';
+  for (int i = 0; i < numSpaces; ++i) {
+    file << fmt::format(R"(<Zone id="zone-{0}"><Name>Zone {0}</Name></Zone>)", i) << '\n';
+  }
+  file << R"(<Campus id="campus"><Building id="building" buildingType="Office"><Name>Building</Name>)" << '\n';
+  file << R"(<BuildingStorey id="story-1"><Name>Story 1</Name><Level>0</Level></BuildingStorey>)" << '\n';
+  for (int i = 0; i < numSpaces; ++i) {
+    file << fmt::format(R"(<Space id="space-{0}" zoneIdRef="zone-{0}" buildingStoreyIdRef="story-1"><Name>Space {0}</Name></Space>)", i) << '\n';
+  }
+  file << "</Building>\n";
+
+  for (int i = 0; i < numSpaces; ++i) {
+    double x0 = 10.0 * i;
+    double x1 = x0 + 10.0;
+    std::string space = fmt::format("space-{}", i);
+    std::string window = fmt::format(
+      R"(<Opening id="window-{}" openingType="FixedWindow">{}</Opening>)", i,
+      polyLoop({{x0 + 2.0, 0.0, 2.0}, {x0 + 2.0, 0.0, 1.0}, {x0 + 8.0, 0.0, 1.0}, {x0 + 8.0, 0.0, 2.0}}));
+    file << surface(fmt::format("floor-{}", i), "SlabOnGrade", {space}, false, {{x0, 0, 0}, {x0, 10, 0}, {x1, 10, 0}, {x1, 0, 0}}, "");
+    file << surface(fmt::format("roof-{}", i), "Roof", {space}, true, {{x0, 0, 3}, {x1, 0, 3}, {x1, 10, 3}, {x0, 10, 3}}, "");
+    file << surface(fmt::format("south-{}", i), "ExteriorWall", {space}, true, {{x0, 0, 3}, {x0, 0, 0}, {x1, 0, 0}, {x1, 0, 3}}, window);
+    file << surface(fmt::format("north-{}", i), "ExteriorWall", {space}, true, {{x1, 10, 3}, {x1, 10, 0}, {x0, 10, 0}, {x0, 10, 3}}, "");
+    if (i == 0) {
+      file << surface("west", "ExteriorWall", {space}, true, {{x0, 10, 3}, {x0, 10, 0}, {x0, 0, 0}, {x0, 0, 3}}, "");
+    }
+    if (i + 1 < numSpaces) {
+      file << surface(fmt::format("interior-{}", i), "InteriorWall", {space, fmt::format("space-{}", i + 1)}, false,
+                      {{x1, 0, 3}, {x1, 0, 0}, {x1, 10, 0}, {x1, 10, 3}}, "");
+    } else {
+      file << surface("east", "ExteriorWall", {space}, true, {{x1, 0, 3}, {x1, 0, 0}, {x1, 10, 0}, {x1, 10, 3}}, "");
+    }
+  }
+  file << "</Campus>\n</gbXML>\n";
+
+  return p;
+}
+
+static void BM_ReverseTranslator(benchmark::State& state, bool streamSurfaces) {
+  openstudio::path p = generateGbXML(static_cast<int>(state.range(0)));
+
+  for (auto _ : state) {
+    gbxml::ReverseTranslator reverseTranslator;
+    reverseTranslator.setStreamSurfaces(streamSurfaces);
+    boost::optional<model::Model> model = reverseTranslator.loadModel(p);
+    if (!model) {
+      state.SkipWithError("Could not translate generated gbXML");
+      break;
+    }
+    benchmark::DoNotOptimize(model->getConcreteModelObjects<model::Surface>().size());
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+static void BM_ReverseTranslatorDOM(benchmark::State& state) {
+  BM_ReverseTranslator(state, false);
+}
+
+static void BM_ReverseTranslatorStreamSurfaces(benchmark::State& state) {
+  BM_ReverseTranslator(state, true);
+}
+
+BENCHMARK(BM_ReverseTranslatorDOM)->Unit(benchmark::kMillisecond)->RangeMultiplier(4)->Range(16, 1024)->Complexity();
+BENCHMARK(BM_ReverseTranslatorStreamSurfaces)->Unit(benchmark::kMillisecond)->RangeMultiplier(4)->Range(16, 1024)->Complexity();
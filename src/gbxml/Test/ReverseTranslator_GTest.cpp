@@ -31,6 +31,7 @@
 #include "gbXMLFixture.hpp"
 
 #include "../ReverseTranslator.hpp"
+#include "../GbXMLIndex.hpp"
 #include "../ForwardTranslator.hpp"
 
 #include "../../energyplus/ForwardTranslator.hpp"
@@ -66,6 +67,7 @@
 
 #include <resources.hxx>
 
+#include <algorithm>
 #include <sstream>
 
 using namespace openstudio::energyplus;
@@ -590,3 +592,80 @@ TEST_F(gbXMLFixture, ReverseTranslator_3997_WindowScaling) {
     EXPECT_EQ("Outdoors", _surf->outsideBoundaryCondition());
   }
 }
+
+TEST_F(gbXMLFixture, ReverseTranslator_StreamSurfaces) {
+  for (const std::string& fileName : {"gbxml/TestCube.xml", "gbxml/TwoStoryOffice_Trane.xml"}) {
+    openstudio::path inputPath = resourcesPath() / openstudio::toPath(fileName);
+
+    openstudio::gbxml::ReverseTranslator reverseTranslator;
+    boost::optional<openstudio::model::Model> model = reverseTranslator.loadModel(inputPath);
+    ASSERT_TRUE(model);
+
+    openstudio::gbxml::ReverseTranslator streamingTranslator;
+    EXPECT_FALSE(streamingTranslator.streamSurfaces());
+    streamingTranslator.setStreamSurfaces(true);
+    EXPECT_TRUE(streamingTranslator.streamSurfaces());
+    // use a chunk size that does not divide the number of surfaces
+    streamingTranslator.setSurfaceChunkSize(7);
+    EXPECT_EQ(7u, streamingTranslator.surfaceChunkSize());
+    boost::optional<openstudio::model::Model> streamedModel = streamingTranslator.loadModel(inputPath);
+    ASSERT_TRUE(streamedModel);
+
+    EXPECT_EQ(model->getConcreteModelObjects<Space>().size(), streamedModel->getConcreteModelObjects<Space>().size()) << fileName;
+    EXPECT_EQ(model->getConcreteModelObjects<ThermalZone>().size(), streamedModel->getConcreteModelObjects<ThermalZone>().size()) << fileName;
+    EXPECT_EQ(model->getConcreteModelObjects<SubSurface>().size(), streamedModel->getConcreteModelObjects<SubSurface>().size()) << fileName;
+    EXPECT_EQ(model->getConcreteModelObjects<ShadingSurface>().size(), streamedModel->getConcreteModelObjects<ShadingSurface>().size()) << fileName;
+
+    std::vector<Surface> surfaces = model->getConcreteModelObjects<Surface>();
+    ASSERT_EQ(surfaces.size(), streamedModel->getConcreteModelObjects<Surface>().size()) << fileName;
+    EXPECT_EQ(reverseTranslator.errors().size(), streamingTranslator.errors().size()) << fileName;
+    EXPECT_EQ(reverseTranslator.warnings().size(), streamingTranslator.warnings().size()) << fileName;
+
+    for (const Surface& surface : surfaces) {
+      boost::optional<Surface> streamedSurface = streamedModel->getModelObjectByName<Surface>(surface.nameString());
+      ASSERT_TRUE(streamedSurface) << surface.nameString();
+      EXPECT_EQ(surface.surfaceType(), streamedSurface->surfaceType());
+      EXPECT_EQ(surface.outsideBoundaryCondition(), streamedSurface->outsideBoundaryCondition());
+      EXPECT_EQ(surface.vertices(), streamedSurface->vertices());
+      ASSERT_EQ(surface.space().is_initialized(), streamedSurface->space().is_initialized());
+      if (surface.space()) {
+        EXPECT_EQ(surface.space()->nameString(), streamedSurface->space()->nameString());
+      }
+      ASSERT_EQ(surface.construction().is_initialized(), streamedSurface->construction().is_initialized());
+      if (surface.construction()) {
+        EXPECT_EQ(surface.construction()->nameString(), streamedSurface->construction()->nameString());
+      }
+      EXPECT_EQ(surface.subSurfaces().size(), streamedSurface->subSurfaces().size());
+      ASSERT_TRUE(streamedSurface->additionalProperties().getFeatureAsString("gbXMLId"));
+      EXPECT_EQ(surface.additionalProperties().getFeatureAsString("gbXMLId").get(),
+                streamedSurface->additionalProperties().getFeatureAsString("gbXMLId").get());
+    }
+  }
+}
+
+TEST_F(gbXMLFixture, GbXMLIndex) {
+  openstudio::path inputPath = resourcesPath() / openstudio::toPath("gbxml/TestCube.xml");
+  openstudio::filesystem::ifstream file(inputPath, std::ios_base::binary);
+  ASSERT_TRUE(file.is_open());
+
+  openstudio::gbxml::GbXMLIndex index(file);
+  ASSERT_TRUE(index.valid());
+  EXPECT_EQ(static_cast<std::streamoff>(openstudio::filesystem::file_size(inputPath)), index.size());
+
+  EXPECT_EQ(52u, index.entries("Surface", "Campus").size());
+  EXPECT_EQ(12u, index.entries("Space", "Building").size());
+  EXPECT_EQ(6u, index.entries("Construction", "gbXML").size());
+  EXPECT_EQ(3u, index.entries("Material", "gbXML").size());
+  EXPECT_EQ(1u, index.entries("Zone", "gbXML").size());
+
+  std::vector<openstudio::gbxml::GbXMLIndex::Entry> spaces = index.entries("Space", "Building");
+  auto space = std::find_if(spaces.begin(), spaces.end(), [](const auto& entry) { return entry.id == "aim0046"; });
+  ASSERT_NE(spaces.end(), space);
+  EXPECT_EQ("Space", space->name);
+  std::string text = openstudio::gbxml::GbXMLIndex::read(file, *space);
+  EXPECT_EQ(0u, text.find("<Space"));
+  EXPECT_EQ(text.size() - 8, text.rfind("</Space>"));
+
+  std::stringstream malformed("<gbXML><Campus><Surface id=\"a\"></Campus></gbXML>");
+  EXPECT_FALSE(openstudio::gbxml::GbXMLIndex(malformed).valid());
+}
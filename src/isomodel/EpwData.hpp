@@ -39,6 +39,7 @@
 #include "../utilities/core/Path.hpp"
 #include "../utilities/data/Matrix.hpp"
 #include "../utilities/data/Vector.hpp"
+#include "../utilities/filetypes/EpwFile.hpp"
 
 namespace openstudio {
 namespace isomodel {
@@ -54,14 +55,21 @@ namespace isomodel {
   class EpwData
   {
    public:
+    /// Loads the weather file at t_path, throws if the file cannot be read
     EpwData(const openstudio::path& t_path);
 
+    /// Extracts the columns used by the ISO model from an already loaded EpwFile
+    EpwData(EpwFile& epwFile);
+
     std::string location() const {
       return m_location;
     }
     std::string stationid() const {
       return m_stationid;
     }
+    std::string checksum() const {
+      return m_checksum;
+    }
     int timezone() const {
       return m_timezone;
     }
@@ -79,10 +87,8 @@ namespace isomodel {
     void toISOData(Matrix& _msolar, Matrix& _mhdbt, Matrix& _mhEgh, Vector& _mEgh, Vector& _mdbt, Vector& _mwind) const;
 
    protected:
-    void loadData(const openstudio::path& t_path);
-    void parseHeader(const std::string& line);
-    void parseData(const std::string& line, size_t row);
-    std::string m_location, m_stationid;
+    void loadData(EpwFile& epwFile);
+    std::string m_location, m_stationid, m_checksum;
     int m_timezone;
     double m_latitude, m_longitude;
     std::vector<std::vector<double>> m_data;
@@ -80,8 +80,12 @@ namespace isomodel {
     double totalEnergyUse() const;
   };
 
+  class SimModelBatch;
+
   class ISOMODEL_API SimModel
   {
+    friend class SimModelBatch;
+
    public:
     void setPop(std::shared_ptr<Population> value) {
       pop = value;
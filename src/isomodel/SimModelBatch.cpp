@@ -0,0 +1,623 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2021, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "SimModelBatch.hpp"
+#include "SimModelConstants.hpp"
+
+#include "../utilities/data/EndUses.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace openstudio {
+namespace isomodel {
+
+  namespace {
+
+    constexpr size_t numMonths = SimModelBatchResults::numMonths;
+    constexpr size_t numSurfaces = SimModelBatch::numSurfaces;
+
+    /// same semantics as isomodel::div, division by zero returns the largest double
+    inline double divide(double numerator, double denominator) {
+      if (denominator == 0) {
+        return std::numeric_limits<double>::max();
+      }
+      return numerator / denominator;
+    }
+
+    /// weather derived quantities that are shared by all variants of a batch
+    struct BatchWeather
+    {
+      double mdbt[numMonths];
+      double mwind[numMonths];
+      double hrsSunDownMo[numMonths];
+      double I_sol[numMonths][numSurfaces];
+    };
+
+    BatchWeather computeBatchWeather(const WeatherData& weather) {
+      BatchWeather result;
+      const Matrix& m_mhEgh = weather.mhEgh();
+      for (size_t i = 0; i < numMonths; ++i) {
+        result.mdbt[i] = weather.mdbt()[i];
+        result.mwind[i] = weather.mwind()[i];
+
+        // see SimModel::solarRadiationBreakdown
+        double sunUp = 0;
+        double sunDown = 0;
+        for (int j = 0; j < 24; j++) {
+          if (m_mhEgh(i, j) != 0) {
+            sunUp = j;
+            break;
+          }
+        }
+        for (int j = 23; j >= 0; j--) {
+          if (m_mhEgh(i, j) != 0) {
+            sunDown = j;
+            break;
+          }
+        }
+        double fracSunUp = (sunDown - sunUp + 1) / 24.0;
+        double fracSunDown = 1.0 - fracSunUp;
+        result.hrsSunDownMo[i] = fracSunDown * hoursInMonth[i];
+
+        // see SimModel::solarHeatGain
+        for (size_t c = 0; c < numSurfaces - 1; ++c) {
+          result.I_sol[i][c] = weather.msolar()(i, c);
+        }
+        result.I_sol[i][numSurfaces - 1] = weather.mEgh()[i];
+      }
+      return result;
+    }
+
+    /// settled zone temperature of one heating or cooling setpoint schedule, see SimModel::interiorTemp
+    void settledTemperatures(double tset_ctrl, double tset_unocc, const double (&v_ti)[5], double tau, double& T_wk_nt, double& T_wke_avg) {
+      // the external temperature and gain offsets are currently zero in SimModel::interiorTemp
+      const double Te = 0;
+      const double dT = 0;
+
+      double M_Ta[4];
+      double Tstart = tset_ctrl;
+      for (size_t i = 0; i < 4; i++) {
+        Tstart = M_Ta[i] = (Tstart - Te - dT) * exp(-1 * v_ti[i] / tau) + Te + dT;
+      }
+
+      double M_Taa[5];
+      M_Taa[0] = 0;
+      for (size_t i = 1; i < 5; i++) {
+        M_Taa[i] = std::max(M_Ta[i - 1], tset_unocc);
+      }
+
+      double M_Tb[5];
+      for (size_t i = 0; i < 5; i++) {
+        double v_T_avg = tau / v_ti[i] * (M_Taa[i] - Te - dT) * (1 - exp(-1 * v_ti[i] / tau)) + Te + dT;
+        M_Tb[i] = std::max(v_T_avg, tset_unocc);
+      }
+
+      double thisSum = 0;
+      for (double T : M_Tb) {
+        thisSum += T;
+      }
+      T_wke_avg = thisSum / 5;
+      T_wk_nt = M_Tb[1];
+    }
+
+  }  // namespace
+
+  ISOResults SimModelBatchResults::isoResults(size_t variant) const {
+    ISOResults result;
+    for (size_t month = 0; month < numMonths; ++month) {
+      EndUses endUses;
+      endUses.addEndUse(value(variant, month, ElectricHeating), EndUseFuelType::Electricity, EndUseCategoryType::Heating);
+      endUses.addEndUse(value(variant, month, ElectricCooling), EndUseFuelType::Electricity, EndUseCategoryType::Cooling);
+      endUses.addEndUse(value(variant, month, ElectricInteriorLights), EndUseFuelType::Electricity, EndUseCategoryType::InteriorLights);
+      endUses.addEndUse(value(variant, month, ElectricExteriorLights), EndUseFuelType::Electricity, EndUseCategoryType::ExteriorLights);
+      endUses.addEndUse(value(variant, month, ElectricFans), EndUseFuelType::Electricity, EndUseCategoryType::Fans);
+      endUses.addEndUse(value(variant, month, ElectricPumps), EndUseFuelType::Electricity, EndUseCategoryType::Pumps);
+      endUses.addEndUse(value(variant, month, ElectricInteriorEquipment), EndUseFuelType::Electricity, EndUseCategoryType::InteriorEquipment);
+      endUses.addEndUse(value(variant, month, ElectricWaterSystems), EndUseFuelType::Electricity, EndUseCategoryType::WaterSystems);
+      endUses.addEndUse(value(variant, month, GasHeating), EndUseFuelType::Gas, EndUseCategoryType::Heating);
+      endUses.addEndUse(value(variant, month, GasCooling), EndUseFuelType::Gas, EndUseCategoryType::Cooling);
+      endUses.addEndUse(value(variant, month, GasInteriorEquipment), EndUseFuelType::Gas, EndUseCategoryType::InteriorEquipment);
+      endUses.addEndUse(value(variant, month, GasWaterSystems), EndUseFuelType::Gas, EndUseCategoryType::WaterSystems);
+      result.monthlyResults.push_back(endUses);
+    }
+    return result;
+  }
+
+  SimModelBatch::SimModelBatch(std::shared_ptr<WeatherData> weather) : m_weather(weather) {}
+
+  std::vector<std::vector<double>*> SimModelBatch::scalarInputs() {
+    return {&terrain,
+            &hoursStart,
+            &hoursEnd,
+            &daysStart,
+            &daysEnd,
+            &densityOccupied,
+            &densityUnoccupied,
+            &heatGainPerPerson,
+            &lightingPowerDensityOccupied,
+            &lightingPowerDensityUnoccupied,
+            &lightingDimmingFraction,
+            &lightingExteriorEnergy,
+            &lightingOccupancySensor,
+            &constantIllumination,
+            &electricApplianceHeatGainOccupied,
+            &electricApplianceHeatGainUnoccupied,
+            &gasApplianceHeatGainOccupied,
+            &gasApplianceHeatGainUnoccupied,
+            &buildingEnergyManagement,
+            &floorArea,
+            &windowShadingDevice,
+            &interiorHeatCapacity,
+            &wallHeatCapacity,
+            &buildingHeight,
+            &infiltrationRate,
+            &heatingTemperatureSetPointOccupied,
+            &heatingTemperatureSetPointUnoccupied,
+            &heatingHvacLossFactor,
+            &heatingHotcoldWasteFactor,
+            &heatingEfficiency,
+            &heatingEnergyType,
+            &heatingPumpControlReduction,
+            &hotWaterDemand,
+            &hotWaterDistributionEfficiency,
+            &hotWaterSystemEfficiency,
+            &hotWaterEnergyType,
+            &coolingTemperatureSetPointOccupied,
+            &coolingTemperatureSetPointUnoccupied,
+            &coolingCop,
+            &coolingPartialLoadValue,
+            &coolingHvacLossFactor,
+            &coolingPumpControlReduction,
+            &ventilationSupplyRate,
+            &ventilationSupplyDifference,
+            &ventilationHeatRecoveryEfficiency,
+            &ventilationExhaustAirRecirculated,
+            &ventilationType,
+            &ventilationFanPower,
+            &ventilationFanControlFactor};
+  }
+
+  std::vector<std::vector<double>*> SimModelBatch::surfaceInputs() {
+    return {&wallArea,
+            &windowArea,
+            &wallUniform,
+            &windowUniform,
+            &wallThermalEmissivity,
+            &wallSolarAbsorbtion,
+            &windowNormalIncidenceSolarEnergyTransmittance,
+            &windowShadingCorrectionFactor};
+  }
+
+  void SimModelBatch::resize(size_t size) {
+    for (std::vector<double>* input : scalarInputs()) {
+      input->resize(size, 0.0);
+    }
+    for (std::vector<double>* input : surfaceInputs()) {
+      input->resize(size * numSurfaces, 0.0);
+    }
+    m_size = size;
+  }
+
+  void SimModelBatch::reserve(size_t size) {
+    for (std::vector<double>* input : scalarInputs()) {
+      input->reserve(size);
+    }
+    for (std::vector<double>* input : surfaceInputs()) {
+      input->reserve(size * numSurfaces);
+    }
+  }
+
+  size_t SimModelBatch::addVariant(const SimModel& simModel) {
+    std::shared_ptr<WeatherData> weather = simModel.location->weather();
+    if (!m_weather) {
+      m_weather = weather;
+    } else if (weather != m_weather) {
+      LOG_AND_THROW("All variants of a SimModelBatch must share the same WeatherData");
+    }
+
+    size_t i = m_size;
+    resize(m_size + 1);
+
+    terrain[i] = simModel.location->terrain();
+
+    hoursStart[i] = simModel.pop->hoursStart();
+    hoursEnd[i] = simModel.pop->hoursEnd();
+    daysStart[i] = simModel.pop->daysStart();
+    daysEnd[i] = simModel.pop->daysEnd();
+    densityOccupied[i] = simModel.pop->densityOccupied();
+    densityUnoccupied[i] = simModel.pop->densityUnoccupied();
+    heatGainPerPerson[i] = simModel.pop->heatGainPerPerson();
+
+    lightingPowerDensityOccupied[i] = simModel.lights->powerDensityOccupied();
+    lightingPowerDensityUnoccupied[i] = simModel.lights->powerDensityUnoccupied();
+    lightingDimmingFraction[i] = simModel.lights->dimmingFraction();
+    lightingExteriorEnergy[i] = simModel.lights->exteriorEnergy();
+
+    lightingOccupancySensor[i] = simModel.building->lightingOccupancySensor();
+    constantIllumination[i] = simModel.building->constantIllumination();
+    electricApplianceHeatGainOccupied[i] = simModel.building->electricApplianceHeatGainOccupied();
+    electricApplianceHeatGainUnoccupied[i] = simModel.building->electricApplianceHeatGainUnoccupied();
+    gasApplianceHeatGainOccupied[i] = simModel.building->gasApplianceHeatGainOccupied();
+    gasApplianceHeatGainUnoccupied[i] = simModel.building->gasApplianceHeatGainUnoccupied();
+    buildingEnergyManagement[i] = simModel.building->buildingEnergyManagement();
+
+    const Structure& structure = *simModel.structure;
+    floorArea[i] = structure.floorArea();
+    windowShadingDevice[i] = structure.windowShadingDevice();
+    interiorHeatCapacity[i] = structure.interiorHeatCapacity();
+    wallHeatCapacity[i] = structure.wallHeatCapacity();
+    buildingHeight[i] = structure.buildingHeight();
+    infiltrationRate[i] = structure.infiltrationRate();
+    for (size_t k = 0; k < numSurfaces; ++k) {
+      size_t j = i * numSurfaces + k;
+      wallArea[j] = structure.wallArea()[k];
+      windowArea[j] = structure.windowArea()[k];
+      wallUniform[j] = structure.wallUniform()[k];
+      windowUniform[j] = structure.windowUniform()[k];
+      wallThermalEmissivity[j] = structure.wallThermalEmissivity()[k];
+      wallSolarAbsorbtion[j] = structure.wallSolarAbsorbtion()[k];
+      windowNormalIncidenceSolarEnergyTransmittance[j] = structure.windowNormalIncidenceSolarEnergyTransmittance()[k];
+      windowShadingCorrectionFactor[j] = structure.windowShadingCorrectionFactor()[k];
+    }
+
+    heatingTemperatureSetPointOccupied[i] = simModel.heating->temperatureSetPointOccupied();
+    heatingTemperatureSetPointUnoccupied[i] = simModel.heating->temperatureSetPointUnoccupied();
+    heatingHvacLossFactor[i] = simModel.heating->hvacLossFactor();
+    heatingHotcoldWasteFactor[i] = simModel.heating->hotcoldWasteFactor();
+    heatingEfficiency[i] = simModel.heating->efficiency();
+    heatingEnergyType[i] = simModel.heating->energyType();
+    heatingPumpControlReduction[i] = simModel.heating->pumpControlReduction();
+    hotWaterDemand[i] = simModel.heating->hotWaterDemand();
+    hotWaterDistributionEfficiency[i] = simModel.heating->hotWaterDistributionEfficiency();
+    hotWaterSystemEfficiency[i] = simModel.heating->hotWaterSystemEfficiency();
+    hotWaterEnergyType[i] = simModel.heating->hotWaterEnergyType();
+
+    coolingTemperatureSetPointOccupied[i] = simModel.cooling->temperatureSetPointOccupied();
+    coolingTemperatureSetPointUnoccupied[i] = simModel.cooling->temperatureSetPointUnoccupied();
+    coolingCop[i] = simModel.cooling->cop();
+    coolingPartialLoadValue[i] = simModel.cooling->partialLoadValue();
+    coolingHvacLossFactor[i] = simModel.cooling->hvacLossFactor();
+    coolingPumpControlReduction[i] = simModel.cooling->pumpControlReduction();
+
+    ventilationSupplyRate[i] = simModel.ventilation->supplyRate();
+    ventilationSupplyDifference[i] = simModel.ventilation->supplyDifference();
+    ventilationHeatRecoveryEfficiency[i] = simModel.ventilation->heatRecoveryEfficiency();
+    ventilationExhaustAirRecirculated[i] = simModel.ventilation->exhaustAirRecirculated();
+    ventilationType[i] = simModel.ventilation->type();
+    ventilationFanPower[i] = simModel.ventilation->fanPower();
+    ventilationFanControlFactor[i] = simModel.ventilation->fanControlFactor();
+
+    return i;
+  }
+
+  // Each step below evaluates the same expressions in the same order as the SimModel function named
+  // in its comment, so that results are identical. Quantities SimModel computes but never uses
+  // (weekend and night gains feeding zero temperature offsets) are skipped.
+  SimModelBatchResults SimModelBatch::simulate() const {
+    if (!m_weather) {
+      LOG_AND_THROW("Cannot simulate a SimModelBatch without WeatherData");
+    }
+
+    const BatchWeather w = computeBatchWeather(*m_weather);
+
+    SimModelBatchResults results;
+    results.numVariants = m_size;
+    results.values.resize(m_size * numMonths * SimModelBatchResults::NumEndUses);
+
+    constexpr double DBL_MIN_ = std::numeric_limits<double>::min();
+
+    for (size_t v = 0; v < m_size; ++v) {
+      const double* v_wall_A = &wallArea[v * numSurfaces];
+      const double* v_win_A = &windowArea[v * numSurfaces];
+      const double* v_wall_U = &wallUniform[v * numSurfaces];
+      const double* v_win_U = &windowUniform[v * numSurfaces];
+      const double* v_wall_emiss = &wallThermalEmissivity[v * numSurfaces];
+      const double* v_wall_alpha_sc = &wallSolarAbsorbtion[v * numSurfaces];
+      const double* v_g_gln = &windowNormalIncidenceSolarEnergyTransmittance[v * numSurfaces];
+      const double* v_win_SCF = &windowShadingCorrectionFactor[v * numSurfaces];
+      const double A_floor = floorArea[v];
+
+      // scheduleAndOccupancy
+      double hoursOccupiedPerDay = hoursEnd[v] - hoursStart[v];
+      if (hoursOccupiedPerDay < 0) {
+        hoursOccupiedPerDay += 24;
+      }
+      double daysOccupiedPerWeek = daysEnd[v] - daysStart[v] + 1;
+      if (daysOccupiedPerWeek < 0) {
+        daysOccupiedPerWeek += 7;
+      }
+      double hoursOccupiedDuringWeek = hoursOccupiedPerDay * daysOccupiedPerWeek;
+      double frac_hrs_wk_day = hoursOccupiedDuringWeek / hoursInWeek;
+      double hoursUnoccupiedPerDay = 24 - hoursOccupiedPerDay;
+      double hoursUnoccupiedDuringWeek = (daysOccupiedPerWeek - 1) * hoursUnoccupiedPerDay;
+      double frac_hrs_wk_nt = hoursUnoccupiedDuringWeek / hoursInWeek;
+      double totalWeekendHours = hoursInWeek - hoursOccupiedDuringWeek - hoursUnoccupiedDuringWeek;
+      double frac_hrs_wke_tot = totalWeekendHours / hoursInWeek;
+
+      // lightingEnergyUse
+      double n_day_start = 7;
+      double n_day_end = 19;
+      double n_weeks = 50;
+      double t_lt_D = (std::min(n_day_end, hoursEnd[v]) - std::max(hoursStart[v], n_day_start)) * (daysEnd[v] + 1 - daysStart[v] + 1) * n_weeks;
+      double t_lt_N = (std::max(n_day_start - hoursStart[v], 0.0) + std::max(hoursEnd[v] - n_day_end, 0.0)) * (daysEnd[v] + 1 - daysStart[v] + 1) * n_weeks;
+      double Q_illum_occ = A_floor * lightingPowerDensityOccupied[v] * constantIllumination[v] * lightingOccupancySensor[v]
+                           * (t_lt_D * lightingDimmingFraction[v] + t_lt_N) / 1000.0;
+      double t_unocc = hoursInYear - t_lt_D - t_lt_N;
+      double Q_illum_unocc = A_floor * lightingPowerDensityUnoccupied[v] * t_unocc / 1000.0;
+      double Q_illum_tot_yr = Q_illum_occ + Q_illum_unocc;
+      double exteriorLighting = lightingExteriorEnergy[v] / 1000.0;
+
+      // envelopCalculations
+      double H_D = 0;
+      for (size_t k = 0; k < numSurfaces; ++k) {
+        H_D += v_wall_A[k] * v_wall_U[k] + v_win_A[k] * v_win_U[k];
+      }
+      double H_tr = H_D + 0 + 0 + 0;
+
+      // windowSolarGain
+      double n_win_SDF_table[] = {0.5, 0.35, 1.0};
+      int n_win_SDF_table_index = std::min(2, std::max(static_cast<int>(windowShadingDevice[v]) - 1, 0));
+      double v_win_F_shgl = n_win_SDF_table[n_win_SDF_table_index] * 1.0;
+      double v_win_ff = 1.0 - 0.25;
+      double n_R_sc_ext = 0.04;
+      double v_win_A_sol[numSurfaces];
+      double v_win_hr[numSurfaces];
+      double v_wall_A_sol[numSurfaces];
+      for (size_t k = 0; k < numSurfaces; ++k) {
+        double v_g_gl = v_g_gln[k] * 0.9;
+        v_win_A_sol[k] = v_win_F_shgl * v_g_gl * v_win_ff * v_win_A[k];
+        v_win_hr[k] = v_wall_emiss[k] * 5.0;
+        v_wall_A_sol[k] = v_wall_alpha_sc[k] * n_R_sc_ext * v_wall_U[k] * v_wall_A[k];
+      }
+
+      // solarHeatGain
+      double n_v_env_form_factors[] = {0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 1};
+      double v_wall_phi_r[numSurfaces];
+      for (size_t k = 0; k < numSurfaces; ++k) {
+        v_wall_phi_r[k] = n_R_sc_ext * v_wall_U[k] * v_wall_A[k] * v_win_hr[k] * 11.0;
+      }
+      double v_E_sol[numMonths];
+      for (size_t i = 0; i < numMonths; ++i) {
+        double v_win_phi_sol = 0;
+        double v_wall_phi_sol = 0;
+        for (size_t k = 0; k < numSurfaces; ++k) {
+          v_win_phi_sol += v_win_SCF[k] * 1.0 * v_win_A_sol[k] * w.I_sol[i][k];
+        }
+        for (size_t k = 0; k < numSurfaces; ++k) {
+          v_wall_phi_sol += v_wall_A_sol[k] * w.I_sol[i][k] - v_wall_phi_r[k] * n_v_env_form_factors[k];
+        }
+        v_E_sol[i] = (v_win_phi_sol + v_wall_phi_sol) * megasecondsInMonth[i];
+      }
+
+      // heatGainsAndLosses and internalHeatGain
+      double phi_int_occ = heatGainPerPerson[v] / densityOccupied[v];
+      double phi_int_unocc = heatGainPerPerson[v] / densityUnoccupied[v];
+      double phi_int_avg = frac_hrs_wk_day * phi_int_occ + (1 - frac_hrs_wk_day) * phi_int_unocc;
+      double phi_plug_occ = electricApplianceHeatGainOccupied[v] + gasApplianceHeatGainOccupied[v];
+      double phi_plug_unocc = electricApplianceHeatGainUnoccupied[v] + gasApplianceHeatGainUnoccupied[v];
+      double phi_plug_avg = phi_plug_occ * frac_hrs_wk_day + phi_plug_unocc * (1 - frac_hrs_wk_day);
+      double phi_illum_avg = Q_illum_tot_yr / A_floor / hoursInYear * 1000;
+      double phi_I_tot = phi_int_avg * A_floor + phi_plug_avg * A_floor + phi_illum_avg * A_floor;
+
+      // interiorTemp, the settled temperatures do not vary by month
+      double T_adj = 0;
+      switch (static_cast<int>(buildingEnergyManagement[v])) {
+        case 1:
+          T_adj = 0.0;
+          break;
+        case 2:
+          T_adj = 0.5;
+          break;
+        case 3:
+          T_adj = 1.0;
+          break;
+      }
+      double ht_tset_ctrl = heatingTemperatureSetPointOccupied[v] - T_adj;
+      double cl_tset_ctrl = coolingTemperatureSetPointOccupied[v] + T_adj;
+      double sum_wall_A = 0;
+      for (size_t k = 0; k < numSurfaces; ++k) {
+        sum_wall_A += v_wall_A[k];
+      }
+      double Cm = interiorHeatCapacity[v] * A_floor + wallHeatCapacity[v] * sum_wall_A;
+      double H_tot = H_tr + 0.0;
+      double tau = Cm / H_tot / 3600.0;
+      const double v_ti[5] = {hoursUnoccupiedPerDay, hoursOccupiedPerDay, hoursUnoccupiedPerDay, hoursOccupiedPerDay, hoursUnoccupiedPerDay};
+
+      double Th_wk_nt = 0;
+      double Th_wke_avg = 0;
+      settledTemperatures(ht_tset_ctrl, heatingTemperatureSetPointUnoccupied[v], v_ti, tau, Th_wk_nt, Th_wke_avg);
+      double Tc_wk_nt = 0;
+      double Tc_wke_avg = 0;
+      settledTemperatures(cl_tset_ctrl, coolingTemperatureSetPointUnoccupied[v], v_ti, tau, Tc_wk_nt, Tc_wke_avg);
+
+      double Th_wk_avg = ht_tset_ctrl * frac_hrs_wk_day + Th_wk_nt * frac_hrs_wk_nt + Th_wke_avg * frac_hrs_wke_tot;
+      double Tc_wk_avg = cl_tset_ctrl * frac_hrs_wk_day + Tc_wk_nt * frac_hrs_wk_nt + Tc_wke_avg * frac_hrs_wke_tot;
+      const double Th_avg = std::min(Th_wk_avg, ht_tset_ctrl);
+      const double Tc_avg = std::min(Tc_wk_avg, cl_tset_ctrl);
+
+      // ventilationCalc
+      double vent_zone_height = std::max(0.1, buildingHeight[v]);
+      double qv_supp = ventilationSupplyRate[v] / A_floor / 3.6;
+      double qv_ext = -(qv_supp - ventilationSupplyDifference[v] / A_floor / 3.6);
+      double qv_diff = qv_supp + qv_ext + 0;
+      double vent_outdoor_frac = 1 - ventilationExhaustAirRecirculated[v];
+      double sum_win_A = 0;
+      for (size_t k = 0; k < numSurfaces; ++k) {
+        sum_win_A += v_win_A[k];
+      }
+      double tot_env_A = sum_wall_A + sum_win_A;
+      double v_Q75pa = infiltrationRate[v];
+      if (v_Q75pa == 0) v_Q75pa = 0.00000000001;
+      double v_Q4pa = v_Q75pa * tot_env_A / A_floor * (std::pow((4.0 / 75.0), 0.65));
+      double h_stack = 0.7 * vent_zone_height;
+      double stackCoeff = 0.0146 * v_Q4pa;
+      double windCoeff = 0.75 * terrain[v];
+      double qv_inf_offset = std::max(0.0, -qv_diff);
+      double qv_mve = ventilationType[v] == 3 ? 0 : (frac_hrs_wk_day * qv_supp * vent_outdoor_frac * (1 - ventilationHeatRecoveryEfficiency[v]));
+
+      // heatingAndCooling
+      double a_H = 1 + tau / 15;
+      double T_sup_ht = heatingTemperatureSetPointOccupied[v] + 7.0;
+      double T_sup_cl = coolingTemperatureSetPointOccupied[v] - 7.0;
+      double n_rhoC_a = 1.22521 * 0.001012;
+      double fanFactor = ventilationFanPower[v] * ventilationFanControlFactor[v];
+      double supplyFlow = ventilationSupplyRate[v] * frac_hrs_wk_day;
+
+      double v_Qneed_ht[numMonths];
+      double v_Qneed_cl[numMonths];
+      double v_Qfan_tot[numMonths];
+      double Qneed_ht_yr = 0;
+      double Qneed_cl_yr = 0;
+      for (size_t i = 0; i < numMonths; ++i) {
+        double stack_ht = std::max(std::pow(::fabs(w.mdbt[i] - Th_avg) * h_stack, 0.667) * stackCoeff, 0.001);
+        double stack_cl = std::max(std::pow(::fabs(w.mdbt[i] - Tc_avg) * h_stack, 0.667) * stackCoeff, 0.001);
+        double wind = std::pow(w.mwind[i] * w.mwind[i] * windCoeff, 0.667) * v_Q4pa * 0.0769;
+        double sw_ht = std::max(stack_ht, wind) + divide(stack_ht * wind * 0.14, v_Q4pa);
+        double sw_cl = std::max(stack_cl, wind) + divide(stack_cl * wind * 0.14, v_Q4pa);
+        double Hve_ht = (sw_ht + qv_inf_offset + qv_mve) * 1200.0 / 3600.0;
+        double Hve_cl = (sw_cl + qv_inf_offset + qv_mve) * 1200.0 / 3600.0;
+
+        double tot_mo_ht_gain = megasecondsInMonth[i] * phi_I_tot + v_E_sol[i];
+
+        double QT_ht = (Th_avg - w.mdbt[i]) * megasecondsInMonth[i] * H_tr;
+        double QV_ht = Hve_ht * A_floor * (Th_avg - w.mdbt[i]) * megasecondsInMonth[i];
+        double Qtot_ht = QT_ht + QV_ht;
+        double gamma_ht = divide(tot_mo_ht_gain, Qtot_ht + DBL_MIN_);
+        double eta_g_ht =
+          gamma_ht > 0 ? (1 - std::pow(gamma_ht, a_H)) / (1 - std::pow(gamma_ht, (a_H + 1))) : 1 / (gamma_ht + DBL_MIN_);
+        v_Qneed_ht[i] = Qtot_ht - eta_g_ht * tot_mo_ht_gain;
+        Qneed_ht_yr += v_Qneed_ht[i];
+
+        double QT_cl = (Tc_avg - w.mdbt[i]) * H_tr * megasecondsInMonth[i];
+        double QV_cl = Hve_cl * A_floor * (Tc_avg - w.mdbt[i]) * megasecondsInMonth[i];
+        double Qtot_cl = QT_cl + QV_cl;
+        double gamma_cl = divide(Qtot_cl, tot_mo_ht_gain + DBL_MIN_);
+        double eta_g_cl = gamma_cl > 0.0 ? (1.0 - std::pow(gamma_cl, a_H)) / (1.0 - std::pow(gamma_cl, (a_H + 1.0))) : 1.0;
+        v_Qneed_cl[i] = tot_mo_ht_gain - eta_g_cl * Qtot_cl;
+        Qneed_cl_yr += v_Qneed_cl[i];
+
+        double Vair_ht = divide(v_Qneed_ht[i], (T_sup_ht - Th_avg) * n_rhoC_a + DBL_MIN_);
+        double Vair_cl = divide(v_Qneed_cl[i], (Tc_avg - T_sup_cl) * n_rhoC_a + DBL_MIN_);
+        double Vair_tot = std::max(Vair_ht + Vair_cl, megasecondsInMonth[i] * supplyFlow / 1000);
+        v_Qfan_tot[i] = divide(divide(Vair_tot * fanFactor, A_floor), 3600);
+      }
+
+      // hvac, district heating and cooling are not modeled and contribute zero
+      double IEER = coolingCop[v] * coolingPartialLoadValue[v];
+      double f_dem_ht = std::max(Qneed_ht_yr / (Qneed_cl_yr + Qneed_ht_yr), 0.1);
+      double f_dem_cl = std::max((1.0 - f_dem_ht), 0.1);
+      double eta_dist_ht = 1.0 / (1.0 + heatingHvacLossFactor[v] + heatingHotcoldWasteFactor[v] / f_dem_ht);
+      double eta_dist_cl = 1.0 / (1.0 + coolingHvacLossFactor[v] + heatingHotcoldWasteFactor[v] / f_dem_cl);
+      const double v_Qcl_DC_elec = 0.0 * (1 - 0.0) / (5.5 * 0.9);
+      const double v_Qcl_DC_abs = 0.0 * (1 - 0.0) / 1.0;
+      const double v_Qht_DH_total = 0.0 * (1 - 0.0) / (0.87 * 0.9);
+
+      // pump
+      double Q_pumps_yr = 0;
+      for (double Ms : megasecondsInMonth) {
+        Q_pumps_yr += Ms * 0.25;
+      }
+      double frac_ht_total = 0;
+      double frac_cl_total = 0;
+      double frac_total = 0;
+      for (size_t i = 0; i < numMonths; ++i) {
+        frac_ht_total += divide(v_Qneed_ht[i], v_Qneed_ht[i] + v_Qneed_cl[i]);
+        frac_cl_total += divide(v_Qneed_cl[i], v_Qneed_ht[i] + v_Qneed_cl[i]);
+        frac_total += divide(v_Qneed_ht[i] + v_Qneed_cl[i], Qneed_ht_yr + Qneed_cl_yr);
+      }
+      double Q_pumps_ht = Q_pumps_yr * heatingPumpControlReduction[v] * A_floor;
+      double Q_pumps_cl = Q_pumps_yr * coolingPumpControlReduction[v] * A_floor;
+      double Q_pumps_tot = Q_pumps_ht + Q_pumps_cl;
+
+      // heatedWater
+      double Q_dhw_yr = hotWaterDemand[v] * (60.0 - 20.0) * 4.18;
+
+      // outputGeneration
+      double E_plug_elec =
+        electricApplianceHeatGainOccupied[v] * frac_hrs_wk_day + electricApplianceHeatGainUnoccupied[v] * (1.0 - frac_hrs_wk_day);
+      double E_plug_gas = gasApplianceHeatGainOccupied[v] * frac_hrs_wk_day + gasApplianceHeatGainUnoccupied[v] * (1.0 - frac_hrs_wk_day);
+
+      double* out = &results.values[v * numMonths * SimModelBatchResults::NumEndUses];
+      for (size_t i = 0; i < numMonths; ++i, out += SimModelBatchResults::NumEndUses) {
+        double Qloss_ht_dist = divide(v_Qneed_ht[i] * (1 - eta_dist_ht), eta_dist_ht);
+        double Qloss_cl_dist = divide(v_Qneed_cl[i] * (1 - eta_dist_cl), eta_dist_cl);
+        double Qht_sys = divide(Qloss_ht_dist + v_Qneed_ht[i], heatingEfficiency[v] + DBL_MIN_);
+        double Qcl_sys = divide(Qloss_cl_dist + v_Qneed_cl[i], IEER + DBL_MIN_);
+        double Qcl_elec_tot = Qcl_sys + v_Qcl_DC_elec;
+        double Qcl_gas_tot = v_Qcl_DC_abs;
+        double Qelec_ht = 0;
+        double Qgas_ht = 0;
+        if (heatingEnergyType[v] == 1) {
+          Qelec_ht = Qht_sys;
+          Qgas_ht = v_Qht_DH_total;
+        } else {
+          Qgas_ht = Qht_sys + v_Qht_DH_total;
+        }
+
+        double Q_pump_tot = 0;
+        if (Q_pumps_ht == 0 || Q_pumps_cl == 0) {
+          double Q_pumps_ht_mo = divide(divide(v_Qneed_ht[i], v_Qneed_ht[i] + v_Qneed_cl[i]) * Q_pumps_ht, frac_ht_total);
+          double Q_pumps_cl_mo = divide(divide(v_Qneed_cl[i], v_Qneed_ht[i] + v_Qneed_cl[i]) * Q_pumps_cl, frac_cl_total);
+          Q_pump_tot = Q_pumps_ht_mo + Q_pumps_cl_mo;
+        } else {
+          Q_pump_tot = divide(divide(v_Qneed_ht[i] + v_Qneed_cl[i], Qneed_ht_yr + Qneed_cl_yr) * Q_pumps_tot, frac_total);
+        }
+
+        double Qe_demand = divide(divide(daysInMonth[i] * Q_dhw_yr, daysInYear), hotWaterDistributionEfficiency[v]);
+        double Q_dhw_need = std::max(divide(divide(Qe_demand, kWh2MJ) - 0.0, hotWaterSystemEfficiency[v]), 0.0);
+        double Q_dhw_elec = 0;
+        double Q_dhw_gas = 0;
+        if (hotWaterEnergyType[v] == 1) {
+          Q_dhw_elec = Q_dhw_need;
+        } else {
+          Q_dhw_gas = Q_dhw_need;
+        }
+
+        out[SimModelBatchResults::ElectricHeating] = divide(divide(Qelec_ht, A_floor), kWh2MJ);
+        out[SimModelBatchResults::ElectricCooling] = divide(divide(Qcl_elec_tot, A_floor), kWh2MJ);
+        out[SimModelBatchResults::ElectricInteriorLights] = divide(monthFractionOfYear[i] * Q_illum_tot_yr, A_floor);
+        out[SimModelBatchResults::ElectricExteriorLights] = divide(w.hrsSunDownMo[i] * exteriorLighting, A_floor);
+        out[SimModelBatchResults::ElectricFans] = v_Qfan_tot[i];
+        out[SimModelBatchResults::ElectricPumps] = divide(divide(Q_pump_tot, A_floor), kWh2MJ);
+        out[SimModelBatchResults::ElectricInteriorEquipment] = divide(hoursInMonth[i] * E_plug_elec, 1000.0);
+        out[SimModelBatchResults::ElectricWaterSystems] = divide(Q_dhw_elec, A_floor);
+        out[SimModelBatchResults::GasHeating] = divide(divide(Qgas_ht, A_floor), kWh2MJ);
+        out[SimModelBatchResults::GasCooling] = divide(divide(Qcl_gas_tot, A_floor), kWh2MJ);
+        out[SimModelBatchResults::GasInteriorEquipment] = divide(hoursInMonth[i] * E_plug_gas, 1000.0);
+        out[SimModelBatchResults::GasWaterSystems] = divide(Q_dhw_gas, A_floor);
+      }
+    }
+
+    return results;
+  }
+
+}  // namespace isomodel
+}  // namespace openstudio
@@ -0,0 +1,204 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2021, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef ISOMODEL_SIMMODELBATCH_HPP
+#define ISOMODEL_SIMMODELBATCH_HPP
+
+#include "ISOModelAPI.hpp"
+
+#include "SimModel.hpp"
+#include "WeatherData.hpp"
+
+#include "../utilities/core/Logger.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace openstudio {
+namespace isomodel {
+
+  /** Monthly results of a SimModelBatch run, stored contiguously as value(variant, month, endUse).
+   *  Values are the same end use intensities SimModel::simulate() reports. */
+  struct ISOMODEL_API SimModelBatchResults
+  {
+    /// End uses in the order SimModel::simulate() adds them to each month's EndUses
+    enum EndUse
+    {
+      ElectricHeating = 0,
+      ElectricCooling,
+      ElectricInteriorLights,
+      ElectricExteriorLights,
+      ElectricFans,
+      ElectricPumps,
+      ElectricInteriorEquipment,
+      ElectricWaterSystems,
+      GasHeating,
+      GasCooling,
+      GasInteriorEquipment,
+      GasWaterSystems,
+      NumEndUses
+    };
+
+    static constexpr size_t numMonths = 12;
+
+    size_t numVariants = 0;
+    std::vector<double> values;
+
+    double value(size_t variant, size_t month, EndUse endUse) const {
+      return values[(variant * numMonths + month) * NumEndUses + endUse];
+    }
+
+    /// Converts the results of one variant to the ISOResults SimModel::simulate() returns
+    ISOResults isoResults(size_t variant) const;
+  };
+
+  /** SimModelBatch runs the ISO 13790 monthly calculation of SimModel for many variants that share
+   *  the same weather data. Inputs are stored as a structure of arrays with one entry per variant,
+   *  the envelope inputs hold numSurfaces consecutive values per variant in the order
+   *  [S, SE, E, NE, N, NW, W, SW, roof/skylight]. All variants are evaluated in a single pass over
+   *  these arrays without allocating intermediate vectors, weather derived quantities are computed
+   *  once per batch. Results match SimModel::simulate() for each variant. */
+  class ISOMODEL_API SimModelBatch
+  {
+   public:
+    static constexpr size_t numSurfaces = 9;
+
+    explicit SimModelBatch(std::shared_ptr<WeatherData> weather = std::shared_ptr<WeatherData>());
+
+    std::shared_ptr<WeatherData> weather() const {
+      return m_weather;
+    }
+    void setWeatherData(std::shared_ptr<WeatherData> value) {
+      m_weather = value;
+    }
+
+    /// Number of variants
+    size_t size() const {
+      return m_size;
+    }
+
+    /// Resizes all input arrays, new variants are zero initialized
+    void resize(size_t size);
+
+    void reserve(size_t size);
+
+    /// Appends the inputs of simModel as a new variant and returns its index. The weather of the
+    /// batch is taken from the first variant if not set, all variants must share the same weather.
+    size_t addVariant(const SimModel& simModel);
+
+    /// Runs all variants
+    SimModelBatchResults simulate() const;
+
+    // Location
+    std::vector<double> terrain;
+
+    // Population
+    std::vector<double> hoursStart;
+    std::vector<double> hoursEnd;
+    std::vector<double> daysStart;
+    std::vector<double> daysEnd;
+    std::vector<double> densityOccupied;
+    std::vector<double> densityUnoccupied;
+    std::vector<double> heatGainPerPerson;
+
+    // Lighting
+    std::vector<double> lightingPowerDensityOccupied;
+    std::vector<double> lightingPowerDensityUnoccupied;
+    std::vector<double> lightingDimmingFraction;
+    std::vector<double> lightingExteriorEnergy;
+
+    // Building
+    std::vector<double> lightingOccupancySensor;
+    std::vector<double> constantIllumination;
+    std::vector<double> electricApplianceHeatGainOccupied;
+    std::vector<double> electricApplianceHeatGainUnoccupied;
+    std::vector<double> gasApplianceHeatGainOccupied;
+    std::vector<double> gasApplianceHeatGainUnoccupied;
+    std::vector<double> buildingEnergyManagement;
+
+    // Structure, vector inputs have numSurfaces values per variant
+    std::vector<double> floorArea;
+    std::vector<double> wallArea;
+    std::vector<double> windowArea;
+    std::vector<double> wallUniform;
+    std::vector<double> windowUniform;
+    std::vector<double> wallThermalEmissivity;
+    std::vector<double> wallSolarAbsorbtion;
+    std::vector<double> windowShadingDevice;
+    std::vector<double> windowNormalIncidenceSolarEnergyTransmittance;
+    std::vector<double> windowShadingCorrectionFactor;
+    std::vector<double> interiorHeatCapacity;
+    std::vector<double> wallHeatCapacity;
+    std::vector<double> buildingHeight;
+    std::vector<double> infiltrationRate;
+
+    // Heating
+    std::vector<double> heatingTemperatureSetPointOccupied;
+    std::vector<double> heatingTemperatureSetPointUnoccupied;
+    std::vector<double> heatingHvacLossFactor;
+    std::vector<double> heatingHotcoldWasteFactor;
+    std::vector<double> heatingEfficiency;
+    std::vector<double> heatingEnergyType;
+    std::vector<double> heatingPumpControlReduction;
+    std::vector<double> hotWaterDemand;
+    std::vector<double> hotWaterDistributionEfficiency;
+    std::vector<double> hotWaterSystemEfficiency;
+    std::vector<double> hotWaterEnergyType;
+
+    // Cooling
+    std::vector<double> coolingTemperatureSetPointOccupied;
+    std::vector<double> coolingTemperatureSetPointUnoccupied;
+    std::vector<double> coolingCop;
+    std::vector<double> coolingPartialLoadValue;
+    std::vector<double> coolingHvacLossFactor;
+    std::vector<double> coolingPumpControlReduction;
+
+    // Ventilation
+    std::vector<double> ventilationSupplyRate;
+    std::vector<double> ventilationSupplyDifference;
+    std::vector<double> ventilationHeatRecoveryEfficiency;
+    std::vector<double> ventilationExhaustAirRecirculated;
+    std::vector<double> ventilationType;
+    std::vector<double> ventilationFanPower;
+    std::vector<double> ventilationFanControlFactor;
+
+   private:
+    REGISTER_LOGGER("openstudio.isomodel.SimModelBatch");
+
+    std::vector<std::vector<double>*> scalarInputs();
+    std::vector<std::vector<double>*> surfaceInputs();
+
+    std::shared_ptr<WeatherData> m_weather;
+    size_t m_size = 0;
+  };
+
+}  // namespace isomodel
+}  // namespace openstudio
+
+#endif  // ISOMODEL_SIMMODELBATCH_HPP
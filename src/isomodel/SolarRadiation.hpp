@@ -43,6 +43,7 @@ namespace isomodel {
   class SolarRadiation
   {
    public:
+    /// wdata is referenced, not copied, and must outlive this object
     SolarRadiation(const TimeFrame& frame, const EpwData& wdata, double tilt = 3.141592653589);
     ~SolarRadiation(void);
 
@@ -87,7 +88,7 @@ namespace isomodel {
 
    protected:
     openstudio::isomodel::TimeFrame m_frame;
-    openstudio::isomodel::EpwData m_weatherData;
+    const openstudio::isomodel::EpwData& m_weatherData;
     void calculateSurfaceSolarRadiation();
     void calculateAverages();
     void calculateMonthAvg(int midx, int cnt);
@@ -0,0 +1,94 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2021, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include "ISOModelFixture.hpp"
+#include "../SimModel.hpp"
+#include "../SimModelBatch.hpp"
+#include "../UserModel.hpp"
+#include <resources.hxx>
+
+using namespace openstudio::isomodel;
+using namespace openstudio;
+
+namespace {
+
+void expectSameResults(const ISOResults& expected, const SimModelBatchResults& batchResults, size_t variant) {
+  ISOResults results = batchResults.isoResults(variant);
+  ASSERT_EQ(expected.monthlyResults.size(), results.monthlyResults.size());
+  for (size_t month = 0; month < expected.monthlyResults.size(); ++month) {
+    for (const EndUseFuelType& fuelType : EndUses::fuelTypes()) {
+      for (const EndUseCategoryType& category : EndUses::categories()) {
+        EXPECT_DOUBLE_EQ(expected.monthlyResults[month].getEndUse(fuelType, category), results.monthlyResults[month].getEndUse(fuelType, category))
+          << "variant " << variant << ", month " << month << ", " << fuelType.valueName() << " " << category.valueName();
+      }
+    }
+  }
+}
+
+}  // namespace
+
+TEST_F(ISOModelFixture, SimModelBatch) {
+  UserModel userModel;
+  userModel.load(resourcesPath() / openstudio::toPath("isomodel/exampleModel.ISO"));
+  ASSERT_TRUE(userModel.valid());
+
+  std::vector<ISOResults> expected;
+  SimModelBatch batch;
+
+  expected.push_back(userModel.toSimModel().simulate());
+  EXPECT_EQ(0u, batch.addVariant(userModel.toSimModel()));
+
+  userModel.setWallUvalueS(0.5 * userModel.wallUvalueS());
+  userModel.setWindowUvalueN(2.0 * userModel.windowUvalueN());
+  userModel.setFloorArea(1.5 * userModel.floorArea());
+  expected.push_back(userModel.toSimModel().simulate());
+  EXPECT_EQ(1u, batch.addVariant(userModel.toSimModel()));
+
+  userModel.setHeatingOccupiedSetpoint(userModel.heatingOccupiedSetpoint() + 2.0);
+  userModel.setCoolingOccupiedSetpoint(userModel.coolingOccupiedSetpoint() - 2.0);
+  userModel.setBuildingOccupancyFrom(6);
+  userModel.setBuildingOccupancyTo(20);
+  userModel.setHeatingEnergyCarrier(1);
+  userModel.setDhwEnergyCarrier(1);
+  expected.push_back(userModel.toSimModel().simulate());
+  EXPECT_EQ(2u, batch.addVariant(userModel.toSimModel()));
+
+  ASSERT_EQ(3u, batch.size());
+  EXPECT_TRUE(batch.weather());
+
+  SimModelBatchResults results = batch.simulate();
+  ASSERT_EQ(3u, results.numVariants);
+  for (size_t variant = 0; variant < expected.size(); ++variant) {
+    expectSameResults(expected[variant], results, variant);
+  }
+
+  EXPECT_DOUBLE_EQ(0.34017664200890202, results.value(0, 0, SimModelBatchResults::ElectricCooling));
+  EXPECT_DOUBLE_EQ(expected[0].totalEnergyUse(), results.isoResults(0).totalEnergyUse());
+}
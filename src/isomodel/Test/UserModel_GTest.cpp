@@ -1087,3 +1087,31 @@ TEST_F(ISOModelFixture, UserModel) {
     EXPECT_DOUBLE_EQ(mwindExp[v], mwind[r]);
   }
 }
+
+TEST_F(ISOModelFixture, UserModel_SharedWeatherData) {
+  path p = resourcesPath() / openstudio::toPath("isomodel/exampleModel.ISO");
+
+  UserModel userModel1;
+  userModel1.load(p);
+  ASSERT_TRUE(userModel1.valid());
+
+  UserModel userModel2;
+  userModel2.load(p);
+  ASSERT_TRUE(userModel2.valid());
+
+  // both models use the same weather file, it is only parsed once
+  std::shared_ptr<WeatherData> weather1 = userModel1.loadWeather();
+  std::shared_ptr<WeatherData> weather2 = userModel2.loadWeather();
+  ASSERT_TRUE(weather1);
+  EXPECT_EQ(weather1, weather2);
+  EXPECT_EQ(weather1, WeatherData::fromEpwFile(resourcesPath() / openstudio::toPath("isomodel/weather.epw")));
+
+  WeatherData::clearCache();
+  std::shared_ptr<WeatherData> weather3 = userModel1.loadWeather();
+  ASSERT_TRUE(weather3);
+  EXPECT_NE(weather1, weather3);
+  for (int r = 0; r < 12; r++) {
+    EXPECT_DOUBLE_EQ(weather1->mdbt()[r], weather3->mdbt()[r]);
+    EXPECT_DOUBLE_EQ(weather1->mEgh()[r], weather3->mEgh()[r]);
+  }
+}
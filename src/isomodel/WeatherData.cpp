@@ -28,11 +28,85 @@
 ***********************************************************************************************************************/
 
 #include "WeatherData.hpp"
+#include "EpwData.hpp"
+
+#include "../utilities/core/Checksum.hpp"
+#include "../utilities/core/Filesystem.hpp"
+
+#include <map>
+#include <mutex>
+#include <utility>
 
 namespace openstudio {
 namespace isomodel {
 
-  // nothing to see here
+  namespace {
+
+    struct WeatherDataCache
+    {
+      std::mutex mutex;
+      // keyed by canonical path and checksum of the EPW file
+      std::map<std::pair<std::string, std::string>, std::shared_ptr<WeatherData>> entries;
+    };
+
+    WeatherDataCache& weatherDataCache() {
+      static WeatherDataCache cache;
+      return cache;
+    }
+
+  }  // namespace
+
+  std::shared_ptr<WeatherData> WeatherData::fromEpwFile(const openstudio::path& epwPath) {
+    std::string canonicalPath = openstudio::toString(openstudio::filesystem::canonical(epwPath));
+    std::pair<std::string, std::string> key(canonicalPath, openstudio::checksum(epwPath));
+
+    WeatherDataCache& cache = weatherDataCache();
+    {
+      std::lock_guard<std::mutex> lock(cache.mutex);
+      auto it = cache.entries.find(key);
+      if (it != cache.entries.end()) {
+        return it->second;
+      }
+    }
+
+    // parse outside of the lock so that different weather files can be loaded concurrently
+    EpwData edata(epwPath);
+
+    Matrix _msolar(12, 8, 0);
+    Matrix _mhdbt(12, 24, 0);
+    Matrix _mhEgh(12, 24, 0);
+    Vector _mEgh(12);
+    Vector _mdbt(12);
+    Vector _mwind(12);
+
+    edata.toISOData(_msolar, _mhdbt, _mhEgh, _mEgh, _mdbt, _mwind);
+
+    std::shared_ptr<WeatherData> wdata(new WeatherData);
+    wdata->setMdbt(_mdbt);
+    wdata->setMEgh(_mEgh);
+    wdata->setMhdbt(_mhdbt);
+    wdata->setMhEgh(_mhEgh);
+    wdata->setMsolar(_msolar);
+    wdata->setMwind(_mwind);
+
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    // drop entries for older contents of the same file
+    for (auto it = cache.entries.begin(); it != cache.entries.end();) {
+      if (it->first.first == canonicalPath && it->first.second != key.second) {
+        it = cache.entries.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    // another thread may have loaded the same file in the meantime, keep the first instance
+    return cache.entries.emplace(key, wdata).first->second;
+  }
+
+  void WeatherData::clearCache() {
+    WeatherDataCache& cache = weatherDataCache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    cache.entries.clear();
+  }
 
-}
+}  // namespace isomodel
 }  // namespace openstudio
@@ -33,6 +33,9 @@
 #include "ISOModelAPI.hpp"
 #include "../utilities/data/Vector.hpp"
 #include "../utilities/data/Matrix.hpp"
+#include "../utilities/core/Path.hpp"
+
+#include <memory>
 
 namespace openstudio {
 namespace isomodel {
@@ -40,6 +43,19 @@ namespace isomodel {
   class ISOMODEL_API WeatherData
   {
    public:
+    /**
+   * Returns the weather data derived from the EPW file at epwPath. Results are cached for the whole process
+   * keyed by the canonical path and checksum of the file, so models sharing a weather file share one instance
+   * and the file is only parsed again if its contents change. The returned object is shared, copy it before
+   * modifying. Throws if the file cannot be read.
+   */
+    static std::shared_ptr<WeatherData> fromEpwFile(const openstudio::path& epwPath);
+
+    /**
+   * Clears the cache used by fromEpwFile
+   */
+    static void clearCache();
+
     /**
    * mean monthly Global Horizontal Radiation (W/m2)
    */
@@ -133,6 +133,13 @@ namespace model {
       return boost::none;
     }
 
+    void HVACComponent_Impl::populateCaches() const {
+      ParentObject_Impl::populateCaches();
+      airLoopHVAC();
+      airLoopHVACOutdoorAirSystem();
+      plantLoop();
+    }
+
     bool HVACComponent_Impl::removeFromLoop(const HVACComponent& systemStartComponent, const HVACComponent& systemEndComponent,
                                             unsigned componentInletPort, unsigned componentOutletPort) {
       auto _model = model();
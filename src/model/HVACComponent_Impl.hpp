@@ -118,6 +118,8 @@ namespace model {
       friend class Model_Impl;
       friend class AirLoopHVAC_Impl;
 
+      virtual void populateCaches() const override;
+
       mutable boost::optional<AirLoopHVAC> m_airLoopHVAC;
       mutable boost::optional<PlantLoop> m_plantLoop;
       mutable boost::optional<AirLoopHVACOutdoorAirSystem> m_airLoopHVACOutdoorAirSystem;
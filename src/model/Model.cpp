@@ -35,6 +35,8 @@
 #include "Connection.hpp"
 #include "ModelObject.hpp"
 #include "ModelObject_Impl.hpp"
+#include "PlanarSurface.hpp"
+#include "PlanarSurface_Impl.hpp"
 #include "ResourceObject.hpp"
 #include "ResourceObject_Impl.hpp"
 
@@ -48,6 +50,8 @@
 #include "../utilities/core/Assert.hpp"
 #include "../utilities/core/PathHelpers.hpp"
 
+#include "../utilities/geometry/PolygonBuffer.hpp"
+
 #include "../utilities/idd/IddEnums.hpp"
 #include "../utilities/idd/IddObject_Impl.hpp"
 #include "../utilities/idd/IddField_Impl.hpp"
@@ -183,6 +187,14 @@ namespace model {
       return result;
     }
 
+    bool Model_Impl::canCreateObjectConcurrently(const IdfObject& object) const {
+      // RenderingColor picks missing colors with rand(), keep the sequence the same as a serial load
+      if (object.iddObject().type() == IddObjectType::OS_Rendering_Color) {
+        return false;
+      }
+      return Workspace_Impl::canCreateObjectConcurrently(object);
+    }
+
     std::shared_ptr<openstudio::detail::WorkspaceObject_Impl>
       Model_Impl::createObject(const std::shared_ptr<openstudio::detail::WorkspaceObject_Impl>& originalObjectImplPtr, bool keepHandle) {
 
@@ -917,6 +929,19 @@ namespace model {
       }
     }
 
+    void Model_Impl::populateCaches() const {
+      building();
+      foundationKivaSettings();
+      outputControlFiles();
+      outputTableSummaryReports();
+      lifeCycleCostParameters();
+      performancePrecisionTradeoffs();
+      runPeriod();
+      yearDescription();
+      weatherFile();
+      Workspace_Impl::populateCaches();
+    }
+
     void Model_Impl::clearCachedData() {
       Handle dummy;
       clearCachedBuilding(dummy);
@@ -1048,11 +1073,11 @@ namespace model {
     if (OptionalIdfObject vo = idfFile.versionObject()) {
       objectImplPtrs.push_back(getImpl<detail::Model_Impl>()->createObject(*vo, true));
     }
-    for (const IdfObject& idfObject : idfFile.objects()) {
-      objectImplPtrs.push_back(getImpl<detail::Model_Impl>()->createObject(idfObject, true));
-      LOG(Trace, "idfObject: " << toString(idfObject.handle()));
-      LOG(Trace, "objectImplPtr: " << toString(objectImplPtrs.back()->handle()));
+    openstudio::detail::WorkspaceObject_ImplPtrVector newObjectImplPtrs = getImpl<detail::Model_Impl>()->createObjects(idfFile.objects(), true);
+    for (const auto& objectImplPtr : newObjectImplPtrs) {
+      LOG(Trace, "objectImplPtr: " << toString(objectImplPtr->handle()));
     }
+    objectImplPtrs.insert(objectImplPtrs.end(), newObjectImplPtrs.begin(), newObjectImplPtrs.end());
     // add Object_ImplPtrs to Workspace_Impl
     getImpl<detail::Model_Impl>()->addObjects(objectImplPtrs);
     // watch loaded components
@@ -1076,9 +1101,9 @@ namespace model {
     getImpl<detail::Model_Impl>()->createComponentWatchers();
   }
 
-  boost::optional<Model> Model::load(const path& osmPath) {
+  // Model from an osm loaded by IdfFile, also loads the workflow.osw in the model's companion folder
+  static boost::optional<Model> modelFromOsm(const boost::optional<IdfFile>& oIdfFile, const path& osmPath) {
     OptionalModel result;
-    OptionalIdfFile oIdfFile = IdfFile::load(osmPath, IddFileType::OpenStudio);
     if (oIdfFile) {
       try {
         result = Model(*oIdfFile);
@@ -1087,7 +1112,6 @@ namespace model {
     }
 
     if (result) {
-      // Load the workflow.osw in the model's companion folder
       path workflowJSONPath = getCompanionFolder(osmPath) / toPath("workflow.osw");
       if (exists(workflowJSONPath)) {
         boost::optional<WorkflowJSON> workflowJSON = WorkflowJSON::load(workflowJSONPath);
@@ -1100,6 +1124,18 @@ namespace model {
     return result;
   }
 
+  boost::optional<Model> Model::load(const path& osmPath) {
+    return modelFromOsm(IdfFile::load(osmPath, IddFileType::OpenStudio), osmPath);
+  }
+
+  boost::optional<Model> Model::loadBinary(const path& osmPath) {
+    OptionalIdfFile oIdfFile = IdfFile::loadBinary(osmPath);
+    if (oIdfFile && (oIdfFile->iddFileType() != IddFileType::OpenStudio)) {
+      oIdfFile.reset();
+    }
+    return modelFromOsm(oIdfFile, osmPath);
+  }
+
   boost::optional<Model> Model::load(const path& osmPath, const path& workflowJSONPath) {
     OptionalModel result = load(osmPath);
     if (result) {
@@ -1299,6 +1335,17 @@ namespace model {
     return getImpl<detail::Model_Impl>()->purgeUnusedResourceObjects(iddObjectType);
   }
 
+  std::vector<PlanarSurface> Model::planarSurfaceVertices(PolygonBuffer& polygons) const {
+    std::vector<PlanarSurface> result = getModelObjects<PlanarSurface>();
+    polygons.clear();
+    // most surfaces are triangles or quadrilaterals
+    polygons.reserve(result.size(), 4 * result.size());
+    for (const PlanarSurface& planarSurface : result) {
+      polygons.addPolygon(planarSurface.vertices());
+    }
+    return result;
+  }
+
   void Model::addVersionObject() {
     getUniqueModelObject<Version>();
   }
@@ -2549,9 +2596,9 @@ namespace model {
                                                                                                            bool keepHandle) const {
     auto typeToCreate = obj.iddObject().type();
     std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> result;
-    auto it = m_newMap.find(typeToCreate);
-    if (it != m_newMap.end()) {
-      result = it->second(model, obj, keepHandle);
+    auto index = static_cast<size_t>(typeToCreate.value());
+    if ((index < m_newMap.size()) && m_newMap[index]) {
+      result = m_newMap[index](model, obj, keepHandle);
     }
     return result;
   }
@@ -2561,17 +2608,22 @@ namespace model {
                                                     bool keepHandle) const {
     auto typeToCreate = obj->iddObject().type();
     std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> result;
-    auto it = m_copyMap.find(typeToCreate);
-    if (it != m_copyMap.end()) {
-      result = it->second(model, obj, keepHandle);
+    auto index = static_cast<size_t>(typeToCreate.value());
+    if ((index < m_copyMap.size()) && m_copyMap[index]) {
+      result = m_copyMap[index](model, obj, keepHandle);
     }
     return result;
   }
 
   detail::Model_Impl::ModelObjectCreator::ModelObjectCreator() {
-#define REGISTER_CONSTRUCTOR(_className)                                                                                           \
-  m_newMap[_className::iddObjectType()] = [](openstudio::model::detail::Model_Impl* m, const IdfObject& object, bool keepHandle) { \
-    return std::make_shared<_className##_Impl>(object, m, keepHandle);                                                             \
+    // IddObjectType values are contiguous, so the constructors can be looked up by index
+    const auto numTypes = static_cast<size_t>(*IddObjectType::getValues().rbegin()) + 1;
+    m_newMap.resize(numTypes);
+    m_copyMap.resize(numTypes);
+
+#define REGISTER_CONSTRUCTOR(_className)                                                                                                   \
+  m_newMap[_className::iddObjectType().value()] = [](openstudio::model::detail::Model_Impl* m, const IdfObject& object, bool keepHandle) { \
+    return std::make_shared<_className##_Impl>(object, m, keepHandle);                                                                     \
   };
 
     REGISTER_CONSTRUCTOR(AdditionalProperties);
@@ -3087,10 +3139,11 @@ namespace model {
     REGISTER_CONSTRUCTOR(ZoneVentilationWindandStackOpenArea);
 
 #define REGISTER_COPYCONSTRUCTORS(_className)                                                                                          \
-  m_copyMap[_className::iddObjectType()] = [](openstudio::model::detail::Model_Impl* m,                                                \
-                                              const std::shared_ptr<openstudio::detail::WorkspaceObject_Impl>& ptr, bool keepHandle) { \
-    if (dynamic_pointer_cast<_className##_Impl>(ptr)) {                                                                                \
-      return std::make_shared<_className##_Impl>(*dynamic_pointer_cast<_className##_Impl>(ptr), m, keepHandle);                        \
+  m_copyMap[_className::iddObjectType().value()] = [](openstudio::model::detail::Model_Impl* m,                                        \
+                                                      const std::shared_ptr<openstudio::detail::WorkspaceObject_Impl>& ptr,            \
+                                                      bool keepHandle) {                                                               \
+    if (auto impl = cachedDynamicPointerCast<_className##_Impl>(ptr)) {                                                                \
+      return std::make_shared<_className##_Impl>(*impl, m, keepHandle);                                                                \
     } else {                                                                                                                           \
       OS_ASSERT(!dynamic_pointer_cast<openstudio::model::detail::ModelObject_Impl>(ptr));                                              \
       return std::make_shared<_className##_Impl>(*ptr, m, keepHandle);                                                                 \
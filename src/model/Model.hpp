@@ -46,6 +46,7 @@ class Date;
 class MonthOfYear;
 class DayOfWeek;
 class NthDayOfWeekInMonth;
+class PolygonBuffer;
 
 namespace model {
 
@@ -63,6 +64,7 @@ namespace model {
   class OutputControlFiles;
   class OutputTableSummaryReports;
   class PerformancePrecisionTradeoffs;
+  class PlanarSurface;
 
   namespace detail {
     class Model_Impl;
@@ -295,12 +297,30 @@ namespace model {
     template <typename T>
     std::vector<T> getModelObjects(bool sorted = false) const {
       std::vector<T> result;
-      std::vector<WorkspaceObject> objects = this->objects(sorted);
-      result.reserve(objects.size());
-      for (std::vector<WorkspaceObject>::const_iterator it = objects.begin(), itend = objects.end(); it < itend; ++it) {
-        std::shared_ptr<typename T::ImplType> p = it->getImpl<typename T::ImplType>();
-        if (p) {
-          result.push_back(T(p));
+      if (sorted) {
+        std::vector<WorkspaceObject> objects = this->objects(sorted);
+        result.reserve(objects.size());
+        for (std::vector<WorkspaceObject>::const_iterator it = objects.begin(), itend = objects.end(); it < itend; ++it) {
+          std::shared_ptr<typename T::ImplType> p = it->getImpl<typename T::ImplType>();
+          if (p) {
+            result.push_back(T(p));
+          }
+        }
+        return result;
+      }
+
+      for (const WorkspaceObjectImplRange& objectsOfType : this->objectImplsByType()) {
+        // all objects of one IddObjectType share an implementation class, so types unrelated to T
+        // are skipped after looking at their first object
+        if (!cachedDynamicPointerCast<typename T::ImplType>(*objectsOfType.begin())) {
+          continue;
+        }
+        result.reserve(result.size() + objectsOfType.size());
+        for (const auto& objectImplPtr : objectsOfType) {
+          std::shared_ptr<typename T::ImplType> p = cachedDynamicPointerCast<typename T::ImplType>(objectImplPtr);
+          if (p) {
+            result.push_back(T(p));
+          }
         }
       }
       return result;
@@ -312,9 +332,10 @@ namespace model {
     template <typename T>
     std::vector<T> getConcreteModelObjects() const {
       std::vector<T> result;
-      std::vector<WorkspaceObject> objects = this->getObjectsByType(T::iddObjectType());
-      for (std::vector<WorkspaceObject>::const_iterator it = objects.begin(), itend = objects.end(); it < itend; ++it) {
-        std::shared_ptr<typename T::ImplType> p = it->getImpl<typename T::ImplType>();
+      WorkspaceObjectImplRange objects = this->objectImplsByType(T::iddObjectType());
+      result.reserve(objects.size());
+      for (const auto& objectImplPtr : objects) {
+        std::shared_ptr<typename T::ImplType> p = cachedDynamicPointerCast<typename T::ImplType>(objectImplPtr);
         if (p) {
           result.push_back(T(p));
         }
@@ -417,12 +438,22 @@ namespace model {
     /** Load Model and WorkflowJSON from files, fails if either osm or workflowJSON cannot be loaded. */
     static boost::optional<Model> load(const path& osmPath, const path& workflowJSONPath);
 
+    /** Load Model from a binary snapshot saved by Workspace::saveBinary, attempts to load WorkflowJSON from standard path.
+     *  Fails if the snapshot was not written from a Model or was written with a different IDD version. */
+    static boost::optional<Model> loadBinary(const path& osmPath);
+
     /// Equality test, tests if this Model shares the same implementation object with other.
     bool operator==(const Model& other) const;
 
     /** Get all model objects. If sorted, then the objects are returned in the preferred order. */
     std::vector<ModelObject> modelObjects(bool sorted = false) const;
 
+    /** Replaces the contents of polygons with the vertices of every PlanarSurface in the model and returns those
+     *  surfaces, polygon i of polygons holds the vertices of the i-th returned surface. Pass polygons to the batched
+     *  functions in utilities/geometry/PolygonBuffer.hpp to get areas, normals, centroids and planes of all surfaces
+     *  at once. */
+    std::vector<PlanarSurface> planarSurfaceVertices(PolygonBuffer& polygons) const;
+
     // DLM@20110614: looks like this is returning a ComponentData, not a primary object?
     /** Inserts Component into Model and returns the primary object, if possible. */
     boost::optional<ComponentData> insertComponent(const Component& component);
@@ -138,6 +138,9 @@
 // Ignore rawImpl, should that even be in the public interface?
 %ignore openstudio::model::Model::rawImpl;
 
+// PolygonBuffer is not wrapped, the batched geometry functions are for C++ callers
+%ignore openstudio::model::Model::planarSurfaceVertices;
+
 namespace openstudio {
 namespace model {
 
@@ -225,6 +225,9 @@ namespace model {
       virtual std::shared_ptr<openstudio::detail::WorkspaceObject_Impl>
         createObject(const std::shared_ptr<openstudio::detail::WorkspaceObject_Impl>& originalObjectImplPtr, bool keepHandle) override;
 
+      // Also creates RenderingColor objects serially
+      virtual bool canCreateObjectConcurrently(const IdfObject& object) const override;
+
       /// Set the WorkflowJSON
       bool setWorkflowJSON(const WorkflowJSON& workflowJSON);
 
@@ -278,6 +281,9 @@ namespace model {
 
       void applySizingValues();
 
+     protected:
+      virtual void populateCaches() const override;
+
      private:
       // explicitly unimplemented copy constructor
       // ETH@20120116 This causes a build error on Windows since there is already a copy constructor
@@ -324,10 +330,11 @@ namespace model {
       typedef std::function<std::shared_ptr<openstudio::detail::WorkspaceObject_Impl>(
         Model_Impl*, const std::shared_ptr<openstudio::detail::WorkspaceObject_Impl>&, bool)>
         CopyConstructorFunction;
-      typedef std::map<IddObjectType, CopyConstructorFunction> CopyConstructorMap;
+      // indexed by IddObjectType::value(), empty functions for types without a ModelObject
+      typedef std::vector<CopyConstructorFunction> CopyConstructorMap;
 
       typedef std::function<std::shared_ptr<openstudio::detail::WorkspaceObject_Impl>(Model_Impl*, const IdfObject&, bool)> NewConstructorFunction;
-      typedef std::map<IddObjectType, NewConstructorFunction> NewConstructorMap;
+      typedef std::vector<NewConstructorFunction> NewConstructorMap;
 
       // The purpose of ModelObjectCreator is to support static initialization of two large maps.
       // One is a map from IddObjectType to a function that creates a new ModelObject instance,
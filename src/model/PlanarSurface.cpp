@@ -280,8 +280,11 @@ namespace model {
     Vector3d PlanarSurface_Impl::outwardNormal() const {
       if (!m_cachedOutwardNormal) {
         Point3dVector vertices = this->vertices();
-        m_cachedOutwardNormal = getOutwardNormal(vertices);
-        if (!m_cachedOutwardNormal) {
+        // only assigned on success, a failed computation must not write to the cache
+        boost::optional<Vector3d> normal = getOutwardNormal(vertices);
+        if (normal) {
+          m_cachedOutwardNormal = normal;
+        } else {
           std::string surfaceNameMsg;
           boost::optional<std::string> name = this->name();
           if (name) {
@@ -598,6 +601,24 @@ namespace model {
       return result;
     }
 
+    void PlanarSurface_Impl::populateCaches() const {
+      ParentObject_Impl::populateCaches();
+      vertices();
+      // degenerate surfaces throw, nothing is cached for them and every call throws again
+      try {
+        plane();
+      } catch (const std::exception&) {
+      }
+      try {
+        outwardNormal();
+      } catch (const std::exception&) {
+      }
+      try {
+        triangulation();
+      } catch (const std::exception&) {
+      }
+    }
+
     void PlanarSurface_Impl::clearCachedVariables() {
       m_cachedVertices.reset();
       m_cachedPlane.reset();
@@ -129,6 +129,11 @@ namespace model {
       return siteTransformation() * boundingBox();
     }
 
+    void PlanarSurfaceGroup_Impl::populateCaches() const {
+      ParentObject_Impl::populateCaches();
+      transformation();
+    }
+
     void PlanarSurfaceGroup_Impl::clearCachedVariables() {
       m_cachedTransformation.reset();
     }
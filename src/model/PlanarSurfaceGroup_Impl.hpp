@@ -123,6 +123,9 @@ namespace model {
       openstudio::BoundingBox boundingBoxSiteCoordinates() const;
 
       //@}
+     protected:
+      virtual void populateCaches() const override;
+
       //private slots:
      private:
       void clearCachedVariables();
@@ -168,6 +168,8 @@ namespace model {
      protected:
       boost::optional<ModelObject> spaceAsModelObject() const;
 
+      virtual void populateCaches() const override;
+
       //private slots:
      private:
       void clearCachedVariables();
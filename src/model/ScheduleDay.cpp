@@ -390,6 +390,12 @@ namespace model {
       return true;
     }
 
+    void ScheduleDay_Impl::populateCaches() const {
+      ScheduleBase_Impl::populateCaches();
+      times();
+      values();
+    }
+
     void ScheduleDay_Impl::clearCachedVariables() {
       m_cachedTimes.reset();
       m_cachedValues.reset();
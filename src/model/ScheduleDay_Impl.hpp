@@ -128,6 +128,8 @@ namespace model {
 
       virtual bool okToResetScheduleTypeLimits() const override;
 
+      virtual void populateCaches() const override;
+
       //private slots:
      private:
       void clearCachedVariables();
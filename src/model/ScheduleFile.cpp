@@ -223,10 +223,15 @@ namespace model {
     }
 
     boost::optional<CSVFile> ScheduleFile_Impl::csvFile() const {
-      boost::optional<CSVFile> csvFile;
+      // only parse what EnergyPlus reads: the rows below rowstoSkipatTop of the (1-based) columnNumber
+      int column = columnNumber();
+      int rowsToSkip = rowstoSkipatTop();
+      if ((column < 1) || (rowsToSkip < 0)) {
+        LOG(Error, "Invalid 'Column Number' (=" << column << ") or 'Rows to Skip at Top' (=" << rowsToSkip << ") for " << briefDescription());
+        return boost::none;
+      }
       ExternalFile externalFile = this->externalFile();
-      csvFile = CSVFile::load(externalFile.filePath());
-      return csvFile;
+      return CSVFile::load(externalFile.filePath(), static_cast<unsigned>(rowsToSkip), {static_cast<unsigned>(column - 1)});
     }
 
     /* FIXME!
@@ -237,10 +242,10 @@ namespace model {
 
     boost::optional<CSVFile> csvFile;
     ExternalFile externalFile = this->externalFile();
-    csvFile = CSVFile::load(externalFile.filePath());
+    csvFile = CSVFile::load(externalFile.filePath(), rowstoSkipatTop(), {0, columnIndex});
 
     std::vector<DateTime> dateTimes = csvFile->getColumnAsDateTimes(0);
-    std::vector<double> values = csvFile->getColumnAsDoubleVector(columnIndex);
+    std::vector<double> values = csvFile->getColumnAsDoubleVector(1);
     Vector vectorValues(values.size());
     unsigned i = 0;
     for (double value : values) {
@@ -262,6 +267,7 @@ namespace model {
     // need to ensure that first column is dateTimes
     // need to ensure that length of timeSeries equals length of dateTimes
 
+    // the whole file is needed here since it is written back out
     boost::optional<CSVFile> csvFile;
     ExternalFile externalFile = this->externalFile();
     csvFile = CSVFile::load(externalFile.filePath());
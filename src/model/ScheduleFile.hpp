@@ -97,6 +97,8 @@ namespace model {
 
     /* FIXME! openstudio::TimeSeries timeSeries(unsigned columnIndex) const;*/
 
+    /** Returns the values EnergyPlus will read from the external file, i.e. the rows below rowstoSkipatTop() of
+     *  columnNumber(), as a single column CSVFile. Only that column is parsed. */
     boost::optional<CSVFile> csvFile() const;
 
     //@}
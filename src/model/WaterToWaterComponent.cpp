@@ -252,6 +252,12 @@ namespace model {
       return boost::none;
     }
 
+    void WaterToWaterComponent_Impl::populateCaches() const {
+      HVACComponent_Impl::populateCaches();
+      secondaryPlantLoop();
+      tertiaryPlantLoop();
+    }
+
     boost::optional<PlantLoop> WaterToWaterComponent_Impl::secondaryPlantLoop() const {
       if (m_secondaryPlantLoop) {
         return m_secondaryPlantLoop;
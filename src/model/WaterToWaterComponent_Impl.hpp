@@ -122,6 +122,8 @@ namespace model {
      protected:
       friend class Model_Impl;
 
+      virtual void populateCaches() const override;
+
       mutable boost::optional<PlantLoop> m_secondaryPlantLoop;
       mutable boost::optional<PlantLoop> m_tertiaryPlantLoop;
 
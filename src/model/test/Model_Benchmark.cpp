@@ -2,15 +2,27 @@
 
 #include "../Model.hpp"
 
+#include "../AirLoopHVAC.hpp"
+#include "../AirTerminalSingleDuctConstantVolumeNoReheat.hpp"
 #include "../BoilerHotWater.hpp"
 #include "../ChillerElectricEIR.hpp"
+#include "../CoilHeatingElectric.hpp"
 #include "../CoilHeatingWater.hpp"
+#include "../FanConstantVolume.hpp"
+#include "../HVACComponent.hpp"
+#include "../HVACComponent_Impl.hpp"
+#include "../ModelObject_Impl.hpp"
 #include "../Node.hpp"
+#include "../ParentObject.hpp"
+#include "../ParentObject_Impl.hpp"
 #include "../PlantLoop.hpp"
 #include "../PumpVariableSpeed.hpp"
 #include "../Schedule.hpp"
 #include "../ScheduleConstant.hpp"
 #include "../SetpointManagerScheduled.hpp"
+#include "../ThermalZone.hpp"
+
+#include "../../osversion/VersionTranslator.hpp"
 
 #include "../../utilities/idd/IddEnums.hpp"
 #include <utilities/idd/IddEnums.hxx>
@@ -19,6 +31,9 @@
 #include "../../utilities/core/FileLogSink.hpp"
 
 #include <fmt/format.h>
+#include <resources.hxx>
+
+#include <stdexcept>
 
 //#include <iostream>
 
@@ -90,6 +105,111 @@ static void BM_SetUpPlantLoop(benchmark::State& state) {
   state.SetComplexityN(state.range(0));
 }
 
+// A large model (about 4000 objects), version translated once and saved in both forms
+static Model largeModel() {
+  static const Model model = []() {
+    osversion::VersionTranslator translator;
+    boost::optional<Model> result = translator.loadModel(resourcesPath() / toPath("model/15023_Model12.osm"));
+    if (!result) {
+      throw std::runtime_error("Cannot load 15023_Model12.osm");
+    }
+    return *result;
+  }();
+  return model;
+}
+
+static path largeModelPath(bool binary) {
+  return openstudio::filesystem::temp_directory_path() / toPath(binary ? "Model_Benchmark_15023_Model12.osmb" : "Model_Benchmark_15023_Model12.osm");
+}
+
+static void BM_SaveText(benchmark::State& state) {
+  Model m = largeModel();
+
+  for (auto _ : state) {
+    m.save(largeModelPath(false), true);
+  }
+}
+
+static void BM_SaveBinary(benchmark::State& state) {
+  Model m = largeModel();
+
+  for (auto _ : state) {
+    m.saveBinary(largeModelPath(true), true);
+  }
+}
+
+static void BM_LoadText(benchmark::State& state) {
+  largeModel().save(largeModelPath(false), true);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(Model::load(largeModelPath(false)));
+  }
+}
+
+static void BM_LoadBinary(benchmark::State& state) {
+  largeModel().saveBinary(largeModelPath(true), true);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(Model::loadBinary(largeModelPath(true)));
+  }
+}
+
+static void BM_CloneModel(benchmark::State& state) {
+  Model m = largeModel();
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(m.clone());
+  }
+}
+
+// Clone an air loop serving N zones into an empty model
+static void BM_CloneAirLoopHVAC(benchmark::State& state) {
+  Model m;
+  Schedule alwaysOn = m.alwaysOnDiscreteSchedule();
+  AirLoopHVAC airLoop(m);
+  Node supplyOutletNode = airLoop.supplyOutletNode();
+  FanConstantVolume fan(m, alwaysOn);
+  fan.addToNode(supplyOutletNode);
+  CoilHeatingElectric coil(m, alwaysOn);
+  coil.addToNode(supplyOutletNode);
+  for (auto i = 0; i < state.range(0); ++i) {
+    ThermalZone zone(m);
+    AirTerminalSingleDuctConstantVolumeNoReheat terminal(m, alwaysOn);
+    airLoop.addBranchForZone(zone, terminal);
+  }
+
+  for (auto _ : state) {
+    Model target;
+    benchmark::DoNotOptimize(airLoop.clone(target));
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+// Downcasts of every object in a large model, which holds far more concrete impl classes than a small cache table
+static void BM_GetModelObjectsByBaseClass(benchmark::State& state) {
+  Model m = largeModel();
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(m.getModelObjects<ModelObject>());
+    benchmark::DoNotOptimize(m.getModelObjects<ParentObject>());
+    benchmark::DoNotOptimize(m.getModelObjects<HVACComponent>());
+  }
+}
+
+static void BM_GetImplByBaseClass(benchmark::State& state) {
+  Model m = largeModel();
+  std::vector<WorkspaceObject> objects = m.objects();
+
+  for (auto _ : state) {
+    for (const WorkspaceObject& object : objects) {
+      benchmark::DoNotOptimize(object.getImpl<model::detail::ModelObject_Impl>());
+      benchmark::DoNotOptimize(object.getImpl<model::detail::ParentObject_Impl>());
+      benchmark::DoNotOptimize(object.getImpl<model::detail::HVACComponent_Impl>());
+    }
+  }
+}
+
 // Regular run, with n=512
 /*
 BENCHMARK(BM_WorkspaceSetNameWithChecks)->Unit(benchmark::kMillisecond)->Arg(512);
@@ -105,3 +225,17 @@ BENCHMARK(BM_AddObjects)->Unit(benchmark::kMillisecond)->RangeMultiplier(2)->Ran
 // 128 takes 14secs,  512 takes about 300 seconds, 1024 takes 20 minutes. By interpolation, 4096 would take 636 minutes, 8192 = 2567 minutes = 42 h
 // 'y[ms] = 1.156580334046908*x**2 + -72.31709114930806*x + 1397.3555792110117'
 BENCHMARK(BM_SetUpPlantLoop)->Unit(benchmark::kMillisecond)->RangeMultiplier(2)->Range(1, 512)->Complexity();
+
+// Text vs binary snapshot save and load of a large model
+BENCHMARK(BM_SaveText)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_SaveBinary)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_LoadText)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_LoadBinary)->Unit(benchmark::kMillisecond);
+
+// Whole model and subset clones
+BENCHMARK(BM_CloneModel)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_CloneAirLoopHVAC)->Unit(benchmark::kMillisecond)->RangeMultiplier(4)->Range(1, 256)->Complexity();
+
+// Impl downcasts across many concrete types
+BENCHMARK(BM_GetModelObjectsByBaseClass)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_GetImplByBaseClass)->Unit(benchmark::kMillisecond);
@@ -81,11 +81,15 @@
 #include "../../utilities/idf/Workspace.hpp"
 #include "../../utilities/idf/WorkspaceObject.hpp"
 #include "../../utilities/idf/ValidityReport.hpp"
+#include "../../utilities/geometry/Point3d.hpp"
 
 #include <utilities/idd/IddEnums.hxx>
 
 #include <boost/algorithm/string/case_conv.hpp>
 
+#include <sstream>
+#include <thread>
+
 using namespace openstudio::model;
 using namespace openstudio;
 /*
@@ -522,6 +526,33 @@ TEST_F(ExampleModelFixture, ExampleModel_ReloadTwoTimes) {
   }
 }
 
+TEST_F(ExampleModelFixture, ExampleModel_SaveBinary) {
+  Model model = exampleModel();
+
+  openstudio::path path = toPath("./ExampleModel_SaveBinary.osmb");
+  addPathToCleanUp(path);
+  EXPECT_TRUE(model.saveBinary(path, true));
+  EXPECT_FALSE(model.saveBinary(path, false));
+
+  boost::optional<Model> model2 = Model::loadBinary(path);
+  ASSERT_TRUE(model2);
+  EXPECT_EQ(model.numObjects(), model2->numObjects());
+
+  // the snapshot round trips exactly to the text form
+  std::stringstream text;
+  model.toIdfFile().print(text);
+  std::stringstream text2;
+  model2->toIdfFile().print(text2);
+  EXPECT_EQ(text.str(), text2.str());
+
+  // snapshots of EnergyPlus workspaces are not models
+  openstudio::path idfPath = toPath("./ExampleModel_SaveBinary_EnergyPlus.osmb");
+  addPathToCleanUp(idfPath);
+  EXPECT_TRUE(Workspace(StrictnessLevel::Draft, IddFileType::EnergyPlus).saveBinary(idfPath, true));
+  EXPECT_TRUE(Workspace::loadBinary(idfPath));
+  EXPECT_FALSE(Model::loadBinary(idfPath));
+}
+
 TEST_F(ModelFixture, Model_building) {
   Model model;
 
@@ -542,6 +573,41 @@ TEST_F(ModelFixture, Model_building) {
   EXPECT_FALSE(building);
 }
 
+TEST_F(ModelFixture, Model_Freeze) {
+  Model model = exampleModel();
+  Model frozen = model.freeze().cast<Model>();
+  EXPECT_TRUE(frozen.isFrozen());
+  EXPECT_TRUE(frozen.building());
+
+  std::vector<Surface> surfaces = frozen.getConcreteModelObjects<Surface>();
+  ASSERT_FALSE(surfaces.empty());
+  std::vector<Point3d> reversed = surfaces[0].vertices();
+  std::reverse(reversed.begin(), reversed.end());
+  EXPECT_FALSE(surfaces[0].setVertices(reversed));
+  EXPECT_NE(reversed, surfaces[0].vertices());
+
+  // geometry was cached by freeze, concurrent queries only read it
+  std::vector<double> expected;
+  for (const Surface& surface : surfaces) {
+    expected.push_back(surface.grossArea() + surface.tilt() + surface.vertices().size());
+  }
+  std::vector<std::vector<double>> results(4);
+  std::vector<std::thread> threads;
+  for (auto& result : results) {
+    threads.emplace_back([&frozen, &result]() {
+      for (const Surface& surface : frozen.getConcreteModelObjects<Surface>()) {
+        result.push_back(surface.grossArea() + surface.tilt() + surface.vertices().size());
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (const auto& result : results) {
+    EXPECT_EQ(expected, result);
+  }
+}
+
 TEST_F(ModelFixture, MatchSurfaces) {
   std::stringstream testOSMString;
   testOSMString << "OS:Version,  \n\
@@ -30,9 +30,14 @@
 #include <gtest/gtest.h>
 
 #include "ModelFixture.hpp"
+#include "../Model.hpp"
 #include "../PlanarSurface.hpp"
 #include "../PlanarSurface_Impl.hpp"
 
+#include "../../utilities/geometry/Geometry.hpp"
+#include "../../utilities/geometry/Plane.hpp"
+#include "../../utilities/geometry/Point3d.hpp"
+#include "../../utilities/geometry/PolygonBuffer.hpp"
 #include "../../utilities/units/QuantityFactory.hpp"
 #include "../../utilities/units/QuantityConverter.hpp"
 
@@ -85,3 +90,40 @@ TEST_F(ModelFixture, PlanarSurface_FilmResistanceConversions) {
   EXPECT_EQ("s^3*K/kg", qc->standardUnitsString());
   EXPECT_NEAR(qc->value(), PlanarSurface::filmResistance(FilmResistanceType::MovingAir_7p5mph), 1.0E-8);
 }
+
+TEST_F(ModelFixture, PlanarSurface_PlanarSurfaceVertices) {
+  Model model = exampleModel();
+
+  PolygonBuffer polygons;
+  polygons.addPolygon({Point3d(0, 0, 0), Point3d(1, 0, 0), Point3d(1, 1, 0)});
+  std::vector<PlanarSurface> planarSurfaces = model.planarSurfaceVertices(polygons);
+  ASSERT_FALSE(planarSurfaces.empty());
+  EXPECT_EQ(model.getModelObjects<PlanarSurface>().size(), planarSurfaces.size());
+  ASSERT_EQ(planarSurfaces.size(), polygons.numPolygons());
+
+  std::vector<PolygonProperties> properties = getPolygonProperties(polygons);
+  ASSERT_EQ(planarSurfaces.size(), properties.size());
+  for (size_t i = 0; i < planarSurfaces.size(); ++i) {
+    const PlanarSurface& planarSurface = planarSurfaces[i];
+    EXPECT_EQ(planarSurface.vertices(), polygons.polygon(i));
+
+    ASSERT_TRUE(properties[i].area);
+    EXPECT_DOUBLE_EQ(planarSurface.grossArea(), properties[i].area.get());
+
+    ASSERT_TRUE(properties[i].outwardNormal);
+    EXPECT_DOUBLE_EQ(planarSurface.outwardNormal().x(), properties[i].outwardNormal->x());
+    EXPECT_DOUBLE_EQ(planarSurface.outwardNormal().y(), properties[i].outwardNormal->y());
+    EXPECT_DOUBLE_EQ(planarSurface.outwardNormal().z(), properties[i].outwardNormal->z());
+
+    ASSERT_TRUE(properties[i].centroid);
+    EXPECT_NEAR(0.0, getDistance(planarSurface.centroid(), properties[i].centroid.get()), 1.0e-9);
+
+    ASSERT_TRUE(properties[i].plane);
+    EXPECT_TRUE(planarSurface.plane().equal(properties[i].plane.get(), 1.0e-9));
+  }
+
+  model = Model();
+  planarSurfaces = model.planarSurfaceVertices(polygons);
+  EXPECT_TRUE(planarSurfaces.empty());
+  EXPECT_EQ(0u, polygons.numPolygons());
+}
@@ -299,6 +299,16 @@ TEST_F(ModelFixture, ScheduleFile) {
   schedule2.setRowstoSkipatTop(1);
   EXPECT_EQ(1, schedule2.rowstoSkipatTop());
 
+  // only the schedule's own column is read, without the header row
+  boost::optional<CSVFile> csvFile = schedule2.csvFile();
+  ASSERT_TRUE(csvFile);
+  EXPECT_EQ(1u, csvFile->numColumns());
+  EXPECT_EQ(8760u, csvFile->numRows());
+  std::vector<double> values = csvFile->getColumnAsDoubleVector(0);
+  ASSERT_EQ(8760u, values.size());
+  EXPECT_DOUBLE_EQ(8759.0, values.front());
+  EXPECT_DOUBLE_EQ(0.0, values.back());
+
   ScheduleFile schedule3(*externalfile);
   EXPECT_EQ(3u, model.getConcreteModelObjects<ScheduleFile>().size());
   EXPECT_EQ(3u, externalfile->scheduleFiles().size());
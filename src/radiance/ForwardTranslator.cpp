@@ -75,6 +75,7 @@
 #include "../utilities/core/Assert.hpp"
 #include "../utilities/core/PathHelpers.hpp"
 #include "../utilities/core/FilesystemHelpers.hpp"
+#include "../utilities/core/ParallelFor.hpp"
 #include "../utilities/time/DateTime.hpp"
 #include "../utilities/geometry/Geometry.hpp"
 #include "../utilities/geometry/Transformation.hpp"
@@ -84,6 +85,7 @@
 #include "../utilities/bcl/LocalBCL.hpp"
 
 #include <thread>
+#include <type_traits>
 
 #include <boost/lexical_cast.hpp>
 #include <boost/algorithm/string/regex.hpp>
@@ -92,6 +94,8 @@
 #include <radiance/embedded_files.hxx>
 
 #include <cstring>
+#include <cstdio>
+#include <charconv>
 #include <cmath>
 #include <sstream>
 #include <iterator>
@@ -124,6 +128,21 @@ namespace radiance {
 
   // internal method used to format doubles as strings
   std::string formatString(double t_d, unsigned t_prec) {
+    // same digits as std::fixed with std::setprecision(t_prec), without constructing a stream for every number
+    char buffer[64];
+#if defined(__cpp_lib_to_chars)
+    std::to_chars_result toChars = std::to_chars(buffer, buffer + sizeof(buffer), t_d, std::chars_format::fixed, static_cast<int>(t_prec));
+    if (toChars.ec == std::errc()) {
+      return std::string(buffer, toChars.ptr);
+    }
+#else
+    int n = std::snprintf(buffer, sizeof(buffer), "%.*f", static_cast<int>(t_prec), t_d);
+    if (n >= 0 && n < static_cast<int>(sizeof(buffer))) {
+      return std::string(buffer, n);
+    }
+#endif
+
+    // very large values do not fit in the buffer
     std::stringstream ss;
     ss << std::setprecision(t_prec) << std::noshowpoint << std::fixed << t_d;
     std::string s = ss.str();
@@ -153,18 +172,30 @@ namespace radiance {
   // internal method used to format all other types as strings
   template <typename T>
   std::string formatString(const T& t) {
-    return boost::lexical_cast<std::string>(t);
+    if constexpr (std::is_integral_v<T>) {
+      return std::to_string(t);
+    } else {
+      return boost::lexical_cast<std::string>(t);
+    }
   }
 
   // basic constructor
   ForwardTranslator::ForwardTranslator()
-    : m_windowGroupId(1)  // m_windowGroupId is reserved for uncontrolled
-  {
+    : m_windowGroupId(1),  // m_windowGroupId is reserved for uncontrolled
+      m_numberOfThreads(0) {
     m_logSink.setLogLevel(Warn);
     m_logSink.setChannelRegex(boost::regex("openstudio\\.radiance\\.ForwardTranslator"));
     m_logSink.setThreadId(std::this_thread::get_id());
   }
 
+  void ForwardTranslator::setNumberOfThreads(unsigned numberOfThreads) {
+    m_numberOfThreads = numberOfThreads;
+  }
+
+  unsigned ForwardTranslator::numberOfThreads() const {
+    return m_numberOfThreads;
+  }
+
   std::vector<openstudio::path> ForwardTranslator::translateModel(const openstudio::path& outPath, const openstudio::model::Model& model) {
     m_model = model.clone(true).cast<openstudio::model::Model>();
 
@@ -472,7 +503,8 @@ namespace radiance {
     return result;
   }
 
-  openstudio::Point3dVectorVector ForwardTranslator::getPolygons(const openstudio::model::Surface& surface) {
+  // subtracts subsurfaces from the surface polygon without logging, safe to call from a worker thread
+  openstudio::Point3dVectorVector surfacePolygons(const openstudio::model::Surface& surface) {
     openstudio::Point3dVectorVector result;
 
     Transformation buildingTransformation;
@@ -507,11 +539,6 @@ namespace radiance {
     // perform the subtraction
     std::vector<std::vector<Point3d>> faceResult = openstudio::subtract(surfaceFaceVertices, holes, 0.01);
 
-    if (faceResult.empty()) {
-      // DLM: is this an error (fail simulation) or a warning?  Should we attempt to put the whole surface in here?
-      LOG(Warn, "Failed to create surface polygons for Surface '" << surface.nameString() << "'");
-    }
-
     // convert to absolute coordinates
     for (const Point3dVector& face : faceResult) {
       Point3dVector worldFace = buildingTransformation * spaceTransformation * alignFace * face;
@@ -522,6 +549,17 @@ namespace radiance {
     return result;
   }
 
+  openstudio::Point3dVectorVector ForwardTranslator::getPolygons(const openstudio::model::Surface& surface) {
+    openstudio::Point3dVectorVector result = surfacePolygons(surface);
+
+    if (result.empty()) {
+      // DLM: is this an error (fail simulation) or a warning?  Should we attempt to put the whole surface in here?
+      LOG(Warn, "Failed to create surface polygons for Surface '" << surface.nameString() << "'");
+    }
+
+    return result;
+  }
+
   openstudio::Point3dVector ForwardTranslator::getPolygon(const openstudio::model::SubSurface& subSurface) {
     Transformation buildingTransformation;
     OptionalBuilding building = subSurface.model().getOptionalUniqueModelObject<Building>();
@@ -1016,103 +1054,265 @@ namespace radiance {
     }
   }
 
-  void ForwardTranslator::buildingSpaces(const openstudio::path& t_radDir, const std::vector<openstudio::model::Space>& t_spaces,
-                                         std::vector<openstudio::path>& t_outfiles) {
-    std::vector<std::string> space_names;
+  ForwardTranslator::SpaceGeometry ForwardTranslator::buildSpaceGeometry(const openstudio::model::Space& space) {
+    SpaceGeometry result;
 
-    for (const auto& space : t_spaces) {
-      std::string space_name = cleanName(space.name().get());
+    // loop over surfaces in space
 
-      space_names.push_back(space_name);
-      LOG(Debug, "Processing space: " << space_name);
+    result.surfaces = space.surfaces();
+    result.surfaceGeometry.resize(result.surfaces.size());
 
-      // split model into zone-based Radiance .rad files
-      m_radSpaces[space_name] = "#\n# geometry file for space: " + space_name + "\n#\n\n";
+    for (size_t surfaceIndex = 0; surfaceIndex < result.surfaces.size(); ++surfaceIndex) {
+      const auto& surface = result.surfaces[surfaceIndex];
+      std::string& geometry = result.surfaceGeometry[surfaceIndex];
 
-      // loop over surfaces in space
+      // skip if air wall
+      if (surface.isAirWall()) {
+        continue;
+      }
 
-      std::vector<openstudio::model::Surface> surfaces = space.surfaces();
+      std::string surface_name = cleanName(surface.name().get());
 
-      for (const auto& surface : surfaces) {
+      // add surface to space geometry
+      geometry += "# surface: " + surface_name + "\n";
 
-        // skip if air wall
-        if (surface.isAirWall()) {
+      // set construction of surface
+      std::string constructionName = surface.getString(2).get();
+      geometry += "# construction: " + constructionName + "\n";
+
+      // get reflectances
+      double interiorVisibleReflectance = 0.5;  // default for space surfaces
+      if (surface.interiorVisibleAbsorptance()) {
+        double interiorVisibleAbsorptance = surface.interiorVisibleAbsorptance().get();
+        interiorVisibleReflectance = 1.0 - interiorVisibleAbsorptance;
+      }
+      double exteriorVisibleReflectance = 0.25;  // default for space surfaces (exterior)
+      if (surface.exteriorVisibleAbsorptance()) {
+        double exteriorVisibleAbsorptance = surface.exteriorVisibleAbsorptance().get();
+        exteriorVisibleReflectance = 1.0 - exteriorVisibleAbsorptance;
+      }
+
+      // create polygon object
+      openstudio::Point3dVectorVector polygons = surfacePolygons(surface);
+      if (polygons.empty()) {
+        result.messages.emplace_back(Warn, "Failed to create surface polygons for Surface '" + surface.nameString() + "'");
+      }
+      for (const openstudio::Point3dVector& polygon : polygons) {
+
+        if (!surface.adjacentSurface()) {
+          // 2-sided material
+
+          // header
+          geometry += "# reflectance (int) = " + formatString(interiorVisibleReflectance, 3)
+                      + "\n# reflectance (ext) = " + formatString(exteriorVisibleReflectance, 3) + "\n";
+
+          // material definition
+
+          //interior
+          result.materials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3) + "\n0\n0\n5\n"
+                                  + formatString(interiorVisibleReflectance, 3) + " " + formatString(interiorVisibleReflectance, 3) + " "
+                                  + formatString(interiorVisibleReflectance, 3) + " 0 0\n\n");
+          //exterior
+          result.materials.insert("void plastic refl_" + formatString(exteriorVisibleReflectance, 3) + "\n0\n0\n5\n"
+                                  + formatString(exteriorVisibleReflectance, 3) + " " + formatString(exteriorVisibleReflectance, 3) + " "
+                                  + formatString(exteriorVisibleReflectance, 3) + " 0 0\n\n");
+          // mixfunc
+          result.mixMaterials.insert("void mixfunc reflBACK_" + formatString(interiorVisibleReflectance, 3) + "_reflFRONT_"
+                                     + formatString(exteriorVisibleReflectance, 3) + "\n4 " + "refl_" + formatString(exteriorVisibleReflectance, 3)
+                                     + " " + "refl_" + formatString(interiorVisibleReflectance, 3) + " if(Rdot,1,0) .\n0\n0\n\n");
+
+          // polygon reference
+          geometry += "reflBACK_" + formatString(interiorVisibleReflectance, 3) + "_reflFRONT_"
+                      + formatString(exteriorVisibleReflectance, 3) + " polygon " + surface_name + "\n0\n0\n"
+                      + formatString(polygon.size() * 3) + "\n";
+        } else {
+          // interior-only material
+
+          // header
+          geometry += "# reflectance: " + formatString(interiorVisibleReflectance, 3) + "\n";
+
+          // material definition
+          result.materials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3) + "\n0\n0\n5\n"
+                                  + formatString(interiorVisibleReflectance, 3) + " " + formatString(interiorVisibleReflectance, 3) + " "
+                                  + formatString(interiorVisibleReflectance, 3) + " 0 0\n");
+
+          // polygon reference
+          geometry += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon " + surface_name + "\n0\n0\n"
+                      + formatString(polygon.size() * 3) + "\n";
+        };
+
+        // add polygon vertices
+        for (const auto& vertex : polygon) {
+          geometry += formatString(vertex.x()) + " " + formatString(vertex.y()) + " " + formatString(vertex.z()) + "\n";
+        }
+        geometry += "\n";
+      }
+    }  // end surfaces
+
+    // get shading surfaces
+
+    std::vector<openstudio::model::ShadingSurfaceGroup> shadingSurfaceGroups = space.shadingSurfaceGroups();
+    for (const auto& shadingSurfaceGroup : shadingSurfaceGroups) {
+      std::vector<openstudio::model::ShadingSurface> shadingSurfaces = shadingSurfaceGroup.shadingSurfaces();
+      for (const auto& shadingSurface : shadingSurfaces) {
+        std::string shadingSurface_name = cleanName(shadingSurface.name().get());
+
+        // add surface to zone geometry
+        result.otherGeometry += "# surface: " + shadingSurface_name + "\n";
+
+        // set construction of space shadingSurface
+        std::string constructionName = shadingSurface.getString(2).get();
+        result.otherGeometry += "# construction: " + constructionName + "\n";
+
+        // get reflectance
+        double interiorVisibleReflectance = 0.25;  // default for space shading surfaces
+        if (shadingSurface.interiorVisibleAbsorptance()) {
+          double interiorVisibleAbsorptance = shadingSurface.interiorVisibleAbsorptance().get();
+          interiorVisibleReflectance = 1.0 - interiorVisibleAbsorptance;
+        }
+        double exteriorVisibleReflectance = 0.25;  // default for space shading surfaces
+        if (shadingSurface.exteriorVisibleAbsorptance()) {
+          double exteriorVisibleAbsorptance = shadingSurface.exteriorVisibleAbsorptance().get();
+          exteriorVisibleReflectance = 1.0 - exteriorVisibleAbsorptance;
+        }
+
+        // write (two-sided) material
+        // exterior reflectance for front side
+        result.materials.insert("void plastic refl_" + formatString(exteriorVisibleReflectance, 3) + "\n0\n0\n5\n"
+                                + formatString(exteriorVisibleReflectance, 3) + " " + formatString(exteriorVisibleReflectance, 3) + " "
+                                + formatString(exteriorVisibleReflectance, 3) + " 0 0\n\n");
+
+        // interior reflectance for back side
+        result.materials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3) + "\n0\n0\n5\n"
+                                + formatString(interiorVisibleReflectance, 3) + " " + formatString(interiorVisibleReflectance, 3) + " "
+                                + formatString(interiorVisibleReflectance, 3) + " 0 0\n\n");
+
+        // mixfunc
+        result.mixMaterials.insert("void mixfunc reflBACK_" + formatString(interiorVisibleReflectance, 3) + "_reflFRONT_"
+                                   + formatString(exteriorVisibleReflectance, 3) + "\n4 " + "refl_" + formatString(exteriorVisibleReflectance, 3)
+                                   + " " + "refl_" + formatString(interiorVisibleReflectance, 3) + " if(Rdot,1,0) .\n0\n0\n\n");
+
+        // polygon header
+        result.otherGeometry += "# exterior visible reflectance: " + formatString(exteriorVisibleReflectance, 3) + "\n";
+        result.otherGeometry += "# interior visible reflectance: " + formatString(interiorVisibleReflectance, 3) + "\n";
+
+        // get / write surface polygon
+
+        openstudio::Point3dVector polygon = openstudio::radiance::ForwardTranslator::getPolygon(shadingSurface);
+        result.otherGeometry += "reflBACK_" + formatString(interiorVisibleReflectance, 3) + "_reflFRONT_"
+                                + formatString(exteriorVisibleReflectance, 3) + " polygon " + shadingSurface_name + "\n0\n0\n"
+                                + formatString(polygon.size() * 3) + "\n";
+
+        for (const auto& vertex : polygon) {
+          result.otherGeometry += "" + formatString(vertex.x()) + " " + formatString(vertex.y()) + " " + formatString(vertex.z()) + "\n";
+        }
+        result.otherGeometry += "\n";
+      }
+    }  // end shading surfaces
+
+    //get the interior partition surfaces
+
+    std::vector<openstudio::model::InteriorPartitionSurfaceGroup> interiorPartitionSurfaceGroups = space.interiorPartitionSurfaceGroups();
+    for (const auto& interiorPartitionSurfaceGroup : interiorPartitionSurfaceGroups) {
+      std::vector<openstudio::model::InteriorPartitionSurface> interiorPartitionSurfaces =
+        interiorPartitionSurfaceGroup.interiorPartitionSurfaces();
+      for (const auto& interiorPartitionSurface : interiorPartitionSurfaces) {
+
+        // get nice name
+
+        std::string interiorPartitionSurface_name = cleanName(interiorPartitionSurface.name().get());
+
+        // check for construction
+
+        boost::optional<model::ConstructionBase> construction = interiorPartitionSurface.construction();
+        if (!construction) {
+          result.messages.emplace_back(Warn, "InteriorPartitionSurface " + interiorPartitionSurface.name().get()
+                                             + " is not associated with a Construction, it will not be translated.");
           continue;
         }
 
-        std::string surface_name = cleanName(surface.name().get());
+        // add surface to zone geometry
 
-        // add surface to space geometry
-        m_radSpaces[space_name] += "# surface: " + surface_name + "\n";
+        result.otherGeometry += "# surface: " + interiorPartitionSurface_name + "\n";
 
-        // set construction of surface
-        std::string constructionName = surface.getString(2).get();
-        m_radSpaces[space_name] += "# construction: " + constructionName + "\n";
+        // set construction of interiorPartitionSurface
+        std::string constructionName = interiorPartitionSurface.getString(1).get();
+        result.otherGeometry += "# construction: " + constructionName + "\n";
 
-        // get reflectances
-        double interiorVisibleReflectance = 0.5;  // default for space surfaces
-        if (surface.interiorVisibleAbsorptance()) {
-          double interiorVisibleAbsorptance = surface.interiorVisibleAbsorptance().get();
+        // get reflectance
+        double interiorVisibleReflectance = 0.5;  // set some default
+        if (interiorPartitionSurface.interiorVisibleAbsorptance()) {
+          double interiorVisibleAbsorptance = interiorPartitionSurface.interiorVisibleAbsorptance().get();
           interiorVisibleReflectance = 1.0 - interiorVisibleAbsorptance;
         }
-        double exteriorVisibleReflectance = 0.25;  // default for space surfaces (exterior)
-        if (surface.exteriorVisibleAbsorptance()) {
-          double exteriorVisibleAbsorptance = surface.exteriorVisibleAbsorptance().get();
+
+        double exteriorVisibleReflectance = 0.5;  // set some default
+        if (interiorPartitionSurface.exteriorVisibleAbsorptance()) {
+          double exteriorVisibleAbsorptance = interiorPartitionSurface.exteriorVisibleAbsorptance().get();
           exteriorVisibleReflectance = 1.0 - exteriorVisibleAbsorptance;
         }
 
-        // create polygon object
-        openstudio::Point3dVectorVector polygons = openstudio::radiance::ForwardTranslator::getPolygons(surface);
-        for (const openstudio::Point3dVector& polygon : polygons) {
+        // write material
+        result.materials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3) + "\n0\n0\n5\n"
+                                + formatString(interiorVisibleReflectance, 3) + " " + formatString(interiorVisibleReflectance, 3) + " "
+                                + formatString(interiorVisibleReflectance, 3) + " 0 0\n\n");
+        // polygon header
+        result.otherGeometry += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
+        result.otherGeometry += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance) + "\n";
+        // get / write surface polygon
+
+        openstudio::Point3dVector polygon = openstudio::radiance::ForwardTranslator::getPolygon(interiorPartitionSurface);
+        result.otherGeometry += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon " + interiorPartitionSurface_name + "\n0\n0\n"
+                                + formatString(polygon.size() * 3) + "\n";
+        for (const auto& vertex : polygon) {
+          result.otherGeometry += formatString(vertex.x()) + " " + formatString(vertex.y()) + " " + formatString(vertex.z()) + "\n\n";
+        }
+      }
+    }  // end interior partitions
+
+    return result;
+  }
 
-          if (!surface.adjacentSurface()) {
-            // 2-sided material
+  void ForwardTranslator::buildingSpaces(const openstudio::path& t_radDir, const std::vector<openstudio::model::Space>& t_spaces,
+                                         std::vector<openstudio::path>& t_outfiles) {
+    std::vector<std::string> space_names;
 
-            // header
-            m_radSpaces[space_name] += "# reflectance (int) = " + formatString(interiorVisibleReflectance, 3)
-                                       + "\n# reflectance (ext) = " + formatString(exteriorVisibleReflectance, 3) + "\n";
+    // geometry that does not depend on window group assignment is built in parallel, one task per space,
+    // then merged below in space order so the scene is the same as a serial export
+    // Model caches its Building on first access, fill that cache here so workers only ever read it
+    m_model.building();
+    std::vector<SpaceGeometry> spaceGeometries(t_spaces.size());
+    parallelFor(t_spaces.size(), m_numberOfThreads, [&](size_t i) { spaceGeometries[i] = buildSpaceGeometry(t_spaces[i]); });
 
-            // material definition
+    for (size_t spaceIndex = 0; spaceIndex < t_spaces.size(); ++spaceIndex) {
+      const auto& space = t_spaces[spaceIndex];
+      const SpaceGeometry& spaceGeometry = spaceGeometries[spaceIndex];
+      std::string space_name = cleanName(space.name().get());
 
-            //interior
-            m_radMaterials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3) + "\n0\n0\n5\n"
-                                  + formatString(interiorVisibleReflectance, 3) + " " + formatString(interiorVisibleReflectance, 3) + " "
-                                  + formatString(interiorVisibleReflectance, 3) + " 0 0\n\n");
-            //exterior
-            m_radMaterials.insert("void plastic refl_" + formatString(exteriorVisibleReflectance, 3) + "\n0\n0\n5\n"
-                                  + formatString(exteriorVisibleReflectance, 3) + " " + formatString(exteriorVisibleReflectance, 3) + " "
-                                  + formatString(exteriorVisibleReflectance, 3) + " 0 0\n\n");
-            // mixfunc
-            m_radMixMaterials.insert("void mixfunc reflBACK_" + formatString(interiorVisibleReflectance, 3) + "_reflFRONT_"
-                                     + formatString(exteriorVisibleReflectance, 3) + "\n4 " + "refl_" + formatString(exteriorVisibleReflectance, 3)
-                                     + " " + "refl_" + formatString(interiorVisibleReflectance, 3) + " if(Rdot,1,0) .\n0\n0\n\n");
+      space_names.push_back(space_name);
+      LOG(Debug, "Processing space: " << space_name);
+      for (const auto& message : spaceGeometry.messages) {
+        LOG(message.first, message.second);
+      }
 
-            // polygon reference
-            m_radSpaces[space_name] += "reflBACK_" + formatString(interiorVisibleReflectance, 3) + "_reflFRONT_"
-                                       + formatString(exteriorVisibleReflectance, 3) + " polygon " + surface_name + "\n0\n0\n"
-                                       + formatString(polygon.size() * 3) + "\n";
-          } else {
-            // interior-only material
+      // split model into zone-based Radiance .rad files
+      m_radSpaces[space_name] = "#\n# geometry file for space: " + space_name + "\n#\n\n";
+      m_radMaterials.insert(spaceGeometry.materials.begin(), spaceGeometry.materials.end());
+      m_radMixMaterials.insert(spaceGeometry.mixMaterials.begin(), spaceGeometry.mixMaterials.end());
 
-            // header
-            m_radSpaces[space_name] += "# reflectance: " + formatString(interiorVisibleReflectance, 3) + "\n";
+      // loop over surfaces in space
 
-            // material definition
-            m_radMaterials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3) + "\n0\n0\n5\n"
-                                  + formatString(interiorVisibleReflectance, 3) + " " + formatString(interiorVisibleReflectance, 3) + " "
-                                  + formatString(interiorVisibleReflectance, 3) + " 0 0\n");
+      const std::vector<openstudio::model::Surface>& surfaces = spaceGeometry.surfaces;
 
-            // polygon reference
-            m_radSpaces[space_name] += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon " + surface_name + "\n0\n0\n"
-                                       + formatString(polygon.size() * 3) + "\n";
-          };
+      for (size_t surfaceIndex = 0; surfaceIndex < surfaces.size(); ++surfaceIndex) {
+        const auto& surface = surfaces[surfaceIndex];
 
-          // add polygon vertices
-          for (const auto& vertex : polygon) {
-            m_radSpaces[space_name] += formatString(vertex.x()) + " " + formatString(vertex.y()) + " " + formatString(vertex.z()) + "\n";
-          }
-          m_radSpaces[space_name] += "\n";
+        // skip if air wall
+        if (surface.isAirWall()) {
+          continue;
         }
+
+        m_radSpaces[space_name] += spaceGeometry.surfaceGeometry[surfaceIndex];
         // end(surface)
 
         // get sub surfaces
@@ -1686,126 +1886,8 @@ namespace radiance {
 
       }  // end surfaces
 
-      // get shading surfaces
-
-      std::vector<openstudio::model::ShadingSurfaceGroup> shadingSurfaceGroups = space.shadingSurfaceGroups();
-      for (const auto& shadingSurfaceGroup : shadingSurfaceGroups) {
-        std::vector<openstudio::model::ShadingSurface> shadingSurfaces = shadingSurfaceGroup.shadingSurfaces();
-        for (const auto& shadingSurface : shadingSurfaces) {
-          std::string shadingSurface_name = cleanName(shadingSurface.name().get());
-
-          // add surface to zone geometry
-          m_radSpaces[space_name] += "# surface: " + shadingSurface_name + "\n";
-
-          // set construction of space shadingSurface
-          std::string constructionName = shadingSurface.getString(2).get();
-          m_radSpaces[space_name] += "# construction: " + constructionName + "\n";
-
-          // get reflectance
-          double interiorVisibleReflectance = 0.25;  // default for space shading surfaces
-          if (shadingSurface.interiorVisibleAbsorptance()) {
-            double interiorVisibleAbsorptance = shadingSurface.interiorVisibleAbsorptance().get();
-            interiorVisibleReflectance = 1.0 - interiorVisibleAbsorptance;
-          }
-          double exteriorVisibleReflectance = 0.25;  // default for space shading surfaces
-          if (shadingSurface.exteriorVisibleAbsorptance()) {
-            double exteriorVisibleAbsorptance = shadingSurface.exteriorVisibleAbsorptance().get();
-            exteriorVisibleReflectance = 1.0 - exteriorVisibleAbsorptance;
-          }
-
-          // write (two-sided) material
-          // exterior reflectance for front side
-          m_radMaterials.insert("void plastic refl_" + formatString(exteriorVisibleReflectance, 3) + "\n0\n0\n5\n"
-                                + formatString(exteriorVisibleReflectance, 3) + " " + formatString(exteriorVisibleReflectance, 3) + " "
-                                + formatString(exteriorVisibleReflectance, 3) + " 0 0\n\n");
-
-          // interior reflectance for back side
-          m_radMaterials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3) + "\n0\n0\n5\n"
-                                + formatString(interiorVisibleReflectance, 3) + " " + formatString(interiorVisibleReflectance, 3) + " "
-                                + formatString(interiorVisibleReflectance, 3) + " 0 0\n\n");
-
-          // mixfunc
-          m_radMixMaterials.insert("void mixfunc reflBACK_" + formatString(interiorVisibleReflectance, 3) + "_reflFRONT_"
-                                   + formatString(exteriorVisibleReflectance, 3) + "\n4 " + "refl_" + formatString(exteriorVisibleReflectance, 3)
-                                   + " " + "refl_" + formatString(interiorVisibleReflectance, 3) + " if(Rdot,1,0) .\n0\n0\n\n");
-
-          // polygon header
-          m_radSpaces[space_name] += "# exterior visible reflectance: " + formatString(exteriorVisibleReflectance, 3) + "\n";
-          m_radSpaces[space_name] += "# interior visible reflectance: " + formatString(interiorVisibleReflectance, 3) + "\n";
-
-          // get / write surface polygon
-
-          openstudio::Point3dVector polygon = openstudio::radiance::ForwardTranslator::getPolygon(shadingSurface);
-          m_radSpaces[space_name] += "reflBACK_" + formatString(interiorVisibleReflectance, 3) + "_reflFRONT_"
-                                     + formatString(exteriorVisibleReflectance, 3) + " polygon " + shadingSurface_name + "\n0\n0\n"
-                                     + formatString(polygon.size() * 3) + "\n";
-
-          for (const auto& vertex : polygon) {
-            m_radSpaces[space_name] += "" + formatString(vertex.x()) + " " + formatString(vertex.y()) + " " + formatString(vertex.z()) + "\n";
-          }
-          m_radSpaces[space_name] += "\n";
-        }
-      }  // end shading surfaces
-
-      //get the interior partition surfaces
-
-      std::vector<openstudio::model::InteriorPartitionSurfaceGroup> interiorPartitionSurfaceGroups = space.interiorPartitionSurfaceGroups();
-      for (const auto& interiorPartitionSurfaceGroup : interiorPartitionSurfaceGroups) {
-        std::vector<openstudio::model::InteriorPartitionSurface> interiorPartitionSurfaces =
-          interiorPartitionSurfaceGroup.interiorPartitionSurfaces();
-        for (const auto& interiorPartitionSurface : interiorPartitionSurfaces) {
-
-          // get nice name
-
-          std::string interiorPartitionSurface_name = cleanName(interiorPartitionSurface.name().get());
-
-          // check for construction
-
-          boost::optional<model::ConstructionBase> construction = interiorPartitionSurface.construction();
-          if (!construction) {
-            LOG(Warn, "InteriorPartitionSurface " << interiorPartitionSurface.name().get()
-                                                  << " is not associated with a Construction, it will not be translated.");
-            continue;
-          }
-
-          // add surface to zone geometry
-
-          m_radSpaces[space_name] += "# surface: " + interiorPartitionSurface_name + "\n";
-
-          // set construction of interiorPartitionSurface
-          std::string constructionName = interiorPartitionSurface.getString(1).get();
-          m_radSpaces[space_name] += "# construction: " + constructionName + "\n";
-
-          // get reflectance
-          double interiorVisibleReflectance = 0.5;  // set some default
-          if (interiorPartitionSurface.interiorVisibleAbsorptance()) {
-            double interiorVisibleAbsorptance = interiorPartitionSurface.interiorVisibleAbsorptance().get();
-            interiorVisibleReflectance = 1.0 - interiorVisibleAbsorptance;
-          }
-
-          double exteriorVisibleReflectance = 0.5;  // set some default
-          if (interiorPartitionSurface.exteriorVisibleAbsorptance()) {
-            double exteriorVisibleAbsorptance = interiorPartitionSurface.exteriorVisibleAbsorptance().get();
-            exteriorVisibleReflectance = 1.0 - exteriorVisibleAbsorptance;
-          }
-
-          // write material
-          m_radMaterials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3) + "\n0\n0\n5\n"
-                                + formatString(interiorVisibleReflectance, 3) + " " + formatString(interiorVisibleReflectance, 3) + " "
-                                + formatString(interiorVisibleReflectance, 3) + " 0 0\n\n");
-          // polygon header
-          m_radSpaces[space_name] += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
-          m_radSpaces[space_name] += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance) + "\n";
-          // get / write surface polygon
-
-          openstudio::Point3dVector polygon = openstudio::radiance::ForwardTranslator::getPolygon(interiorPartitionSurface);
-          m_radSpaces[space_name] += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon " + interiorPartitionSurface_name + "\n0\n0\n"
-                                     + formatString(polygon.size() * 3) + "\n";
-          for (const auto& vertex : polygon) {
-            m_radSpaces[space_name] += formatString(vertex.x()) + " " + formatString(vertex.y()) + " " + formatString(vertex.z()) + "\n\n";
-          }
-        }
-      }  // end interior partitions
+      // shading surfaces and interior partitions
+      m_radSpaces[space_name] += spaceGeometry.otherGeometry;
 
       // get luminaires
       ///  \todo fully implement once luminaires are fully supported in model
@@ -67,6 +67,13 @@ namespace radiance {
      */
     std::vector<openstudio::path> translateModel(const openstudio::path& outPath, const openstudio::model::Model& model);
 
+    /** Sets the number of threads used to build space geometry, 0 (the default) uses all hardware threads.
+     *  The translated scene does not depend on the number of threads. */
+    void setNumberOfThreads(unsigned numberOfThreads);
+
+    /** Get the number of threads used to build space geometry. */
+    unsigned numberOfThreads() const;
+
     /** Get warning messages generated by the last translation.
      */
     std::vector<LogMessage> warnings() const;
@@ -173,6 +180,25 @@ namespace radiance {
     void buildingSpaces(const openstudio::path& t_radDir, const std::vector<openstudio::model::Space>& t_spaces,
                         std::vector<openstudio::path>& t_outpaths);
 
+    // opaque surface, shading and interior partition geometry for one space, these do not depend on
+    // window group assignment so they can be built off the main thread and merged in space order
+    struct SpaceGeometry
+    {
+      std::vector<openstudio::model::Surface> surfaces;
+      // one entry per surface, empty for air walls
+      std::vector<std::string> surfaceGeometry;
+      // shading surfaces followed by interior partitions
+      std::string otherGeometry;
+      std::set<std::string> materials;
+      std::set<std::string> mixMaterials;
+      // log messages are replayed on the translating thread so the log sink sees them
+      std::vector<std::pair<LogLevel, std::string>> messages;
+    };
+
+    static SpaceGeometry buildSpaceGeometry(const openstudio::model::Space& space);
+
+    unsigned m_numberOfThreads;
+
     // get a bsdf possibly from the BCL
     boost::optional<openstudio::path> getBSDF(double vlt, double vltSpecular, const std::string& shadeType);
     boost::optional<std::string> getBSDF(openstudio::LocalBCL& bcl, double vlt, double vltSpecular, const std::string& shadeType,
@@ -53,9 +53,15 @@
 #include "../../utilities/geometry/Point3d.hpp"
 #include "../../utilities/geometry/Geometry.hpp"
 #include "../../utilities/core/Logger.hpp"
+#include "../../utilities/core/PathHelpers.hpp"
 #include <utilities/idd/BuildingSurface_Detailed_FieldEnums.hxx>
 #include <utilities/idd/FenestrationSurface_Detailed_FieldEnums.hxx>
 
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <sstream>
+
 using namespace openstudio;
 using namespace openstudio::model;
 using namespace openstudio::radiance;
@@ -340,3 +346,45 @@ TEST(Radiance, ForwardTranslator_formatString) {
   EXPECT_EQ("0.4", formatString(0.4412345, 1));
   EXPECT_EQ("0.44", formatString(0.4412345, 2));
 }
+
+TEST(Radiance, ForwardTranslator_formatString_MatchesStream) {
+  for (double d : {0.0, -0.0, 0.5, 1.5, 2.5, 0.0005, -12.3456789, 1.0e-20, 1.0e20, 1.0e300}) {
+    for (unsigned prec : {0u, 2u, 3u, 15u}) {
+      std::stringstream ss;
+      ss << std::setprecision(prec) << std::noshowpoint << std::fixed << d;
+      EXPECT_EQ(ss.str(), formatString(d, prec));
+    }
+  }
+}
+
+TEST(Radiance, ForwardTranslator_ExampleModel_NumberOfThreads) {
+  Model model = exampleModel();
+
+  auto readFile = [](const path& p) {
+    std::ifstream file(toString(p), std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+  };
+
+  openstudio::path serialPath = toPath("./ForwardTranslator_ExampleModel_Serial");
+  openstudio::filesystem::remove_all(serialPath);
+  ForwardTranslator serial;
+  serial.setNumberOfThreads(1);
+  EXPECT_EQ(1u, serial.numberOfThreads());
+  std::vector<path> serialPaths = serial.translateModel(serialPath, model);
+  ASSERT_FALSE(serialPaths.empty());
+
+  openstudio::path parallelPath = toPath("./ForwardTranslator_ExampleModel_Parallel");
+  openstudio::filesystem::remove_all(parallelPath);
+  ForwardTranslator parallel;
+  parallel.setNumberOfThreads(4);
+  std::vector<path> parallelPaths = parallel.translateModel(parallelPath, model);
+  ASSERT_EQ(serialPaths.size(), parallelPaths.size());
+
+  // scene must be byte-identical whatever the number of threads
+  for (size_t i = 0; i < serialPaths.size(); ++i) {
+    EXPECT_EQ(toString(relativePath(serialPaths[i], serialPath)), toString(relativePath(parallelPaths[i], parallelPath)));
+    EXPECT_EQ(readFile(serialPaths[i]), readFile(parallelPaths[i])) << toString(serialPaths[i]);
+  }
+  EXPECT_EQ(serial.warnings().size(), parallel.warnings().size());
+  EXPECT_EQ(serial.errors().size(), parallel.errors().size());
+}
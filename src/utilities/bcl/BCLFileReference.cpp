@@ -38,7 +38,7 @@ namespace openstudio {
 BCLFileReference::BCLFileReference(const openstudio::path& path, const bool setMembers) : m_path(openstudio::filesystem::system_complete(path)) {
   // DLM: why would you not want to set the members?
   if (setMembers) {
-    m_checksum = openstudio::checksum(m_path);
+    m_checksum = openstudio::cachedChecksum(m_path);
 
     std::string fileType = this->fileType();
     if (fileType == "osm") {
@@ -170,7 +170,7 @@ void BCLFileReference::writeValues(pugi::xml_node& element) const {
 }
 
 bool BCLFileReference::checkForUpdate() {
-  std::string newChecksum = openstudio::checksum(this->path());
+  std::string newChecksum = openstudio::cachedChecksum(this->path());
   if (m_checksum != newChecksum) {
     m_checksum = newChecksum;
     return true;
@@ -35,6 +35,7 @@
 #include "../core/StringHelpers.hpp"
 #include "../core/FileReference.hpp"
 #include "../core/Assert.hpp"
+#include "../core/Checksum.hpp"
 
 #include <OpenStudio.hxx>
 
@@ -923,31 +924,9 @@ bool BCLMeasure::missingRequiredFields() const {
   return missing;
 }
 
-bool BCLMeasure::checkForUpdatesFiles() {
-  bool result = false;
+std::vector<std::pair<openstudio::path, std::string>> BCLMeasure::untrackedFiles() const {
+  std::vector<std::pair<openstudio::path, std::string>> result;
 
-  std::vector<BCLFileReference> filesToRemove;
-  std::vector<BCLFileReference> filesToAdd;
-  for (BCLFileReference file : m_bclXML.files()) {
-    std::string filename = file.fileName();
-    if (!exists(file.path())) {
-      result = true;
-      // what if this is the measure.rb file?
-      filesToRemove.push_back(file);
-    } else if (filename.empty() || boost::starts_with(filename, ".")) {
-      if (filename == ".gitkeep") {
-        // allow this file
-      } else {
-        result = true;
-        filesToRemove.push_back(file);
-      }
-    } else if (file.checkForUpdate()) {
-      result = true;
-      filesToAdd.push_back(file);
-    }
-  }
-
-  // look for new files and add them
   openstudio::path srcDir = m_directory / "tests";
   openstudio::path ignoreDir = srcDir / "output";
 
@@ -975,10 +954,7 @@ bool BCLMeasure::checkForUpdatesFiles() {
       }
 
       if (!m_bclXML.hasFile(srcItemPath)) {
-        BCLFileReference fileref(srcItemPath, true);
-        fileref.setUsageType("test");
-        result = true;
-        filesToAdd.push_back(fileref);
+        result.emplace_back(srcItemPath, "test");
       }
     }
   }
@@ -994,10 +970,7 @@ bool BCLMeasure::checkForUpdatesFiles() {
       }
 
       if (!m_bclXML.hasFile(srcItemPath)) {
-        BCLFileReference fileref(srcItemPath, true);
-        fileref.setUsageType("resource");
-        result = true;
-        filesToAdd.push_back(fileref);
+        result.emplace_back(srcItemPath, "resource");
       }
     }
   }
@@ -1017,58 +990,79 @@ bool BCLMeasure::checkForUpdatesFiles() {
       }
 
       if (!m_bclXML.hasFile(srcItemPath)) {
-        BCLFileReference fileref(srcItemPath, true);
-        fileref.setUsageType("doc");
-        result = true;
-        filesToAdd.push_back(fileref);
+        result.emplace_back(srcItemPath, "doc");
       }
     }
   }
 
-  // check for measure.rb
-  openstudio::path srcItemPath = m_directory / toPath("measure.rb");
-  if (!m_bclXML.hasFile(srcItemPath)) {
-    if (exists(srcItemPath)) {
-      BCLFileReference file(srcItemPath, true);
-      file.setUsageType("script");
-      // we don't know what the actual version this was created for, we also don't know minimum version
-      file.setSoftwareProgramVersion(openStudioVersion());
-      result = true;
-      filesToAdd.push_back(file);
+  // check for measure.rb, LICENSE.md, README.md and README.md.erb
+  std::vector<std::pair<std::string, std::string>> topLevelFiles{
+    {"measure.rb", "script"}, {"LICENSE.md", "license"}, {"README.md", "readme"}, {"README.md.erb", "readmeerb"}};
+  for (const auto& topLevelFile : topLevelFiles) {
+    openstudio::path srcItemPath = m_directory / toPath(topLevelFile.first);
+    if (!m_bclXML.hasFile(srcItemPath)) {
+      if (exists(srcItemPath)) {
+        result.emplace_back(srcItemPath, topLevelFile.second);
+      }
     }
   }
 
-  // check for LICENSE.md
-  srcItemPath = m_directory / toPath("LICENSE.md");
-  if (!m_bclXML.hasFile(srcItemPath)) {
-    if (exists(srcItemPath)) {
-      BCLFileReference file(srcItemPath, true);
-      file.setUsageType("license");
-      result = true;
-      filesToAdd.push_back(file);
-    }
+  return result;
+}
+
+bool BCLMeasure::checkForUpdatesFiles() {
+  std::vector<std::pair<openstudio::path, std::string>> newFiles = untrackedFiles();
+
+  // checksum tracked and new files up front so files are read in parallel, checkForUpdate and
+  // the BCLFileReference constructor then hit the checksum cache
+  std::vector<openstudio::path> paths;
+  for (const BCLFileReference& file : m_bclXML.files()) {
+    paths.push_back(file.path());
+  }
+  for (const auto& newFile : newFiles) {
+    paths.push_back(newFile.first);
   }
+  cachedChecksums(paths);
+
+  return checkForUpdatesFiles(newFiles);
+}
+
+bool BCLMeasure::checkForUpdatesFiles(const std::vector<std::pair<openstudio::path, std::string>>& newFiles) {
+  bool result = false;
+
+  std::vector<BCLFileReference> files = m_bclXML.files();
 
-  // check for README.me
-  srcItemPath = m_directory / toPath("README.md");
-  if (!m_bclXML.hasFile(srcItemPath)) {
-    if (exists(srcItemPath)) {
-      BCLFileReference file(srcItemPath, true);
-      file.setUsageType("readme");
+  std::vector<BCLFileReference> filesToRemove;
+  std::vector<BCLFileReference> filesToAdd;
+  for (BCLFileReference file : files) {
+    std::string filename = file.fileName();
+    if (!exists(file.path())) {
+      result = true;
+      // what if this is the measure.rb file?
+      filesToRemove.push_back(file);
+    } else if (filename.empty() || boost::starts_with(filename, ".")) {
+      if (filename == ".gitkeep") {
+        // allow this file
+      } else {
+        result = true;
+        filesToRemove.push_back(file);
+      }
+    } else if (file.checkForUpdate()) {
       result = true;
       filesToAdd.push_back(file);
     }
   }
 
-  // check for README.me.erb
-  srcItemPath = m_directory / toPath("README.md.erb");
-  if (!m_bclXML.hasFile(srcItemPath)) {
-    if (exists(srcItemPath)) {
-      BCLFileReference file(srcItemPath, true);
-      file.setUsageType("readmeerb");
-      result = true;
-      filesToAdd.push_back(file);
+  // add new files
+  for (const auto& newFile : newFiles) {
+    BCLFileReference file(newFile.first, true);
+    file.setUsageType(newFile.second);
+    if (newFile.second == "script") {
+      // we don't know what the actual version this was created for, we also don't know minimum version
+      file.setSoftwareProgramVersion(openStudioVersion());
     }
+    result = true;
+    filesToAdd.push_back(file);
   }
 
   for (const BCLFileReference& file : filesToRemove) {
@@ -1087,6 +1081,33 @@ bool BCLMeasure::checkForUpdatesFiles() {
   return result;
 }
 
+std::vector<BCLMeasure> BCLMeasure::updateMeasuresInDir(const openstudio::path& dir) {
+  std::vector<BCLMeasure> measures = getMeasuresInDir(dir);
+
+  // walk each measure once and checksum the files of all measures in one parallel pass
+  std::vector<std::vector<std::pair<openstudio::path, std::string>>> newFiles;
+  newFiles.reserve(measures.size());
+  std::vector<openstudio::path> paths;
+  for (const BCLMeasure& measure : measures) {
+    for (const BCLFileReference& file : measure.m_bclXML.files()) {
+      paths.push_back(file.path());
+    }
+    newFiles.push_back(measure.untrackedFiles());
+    for (const auto& newFile : newFiles.back()) {
+      paths.push_back(newFile.first);
+    }
+  }
+  cachedChecksums(paths);
+
+  std::vector<BCLMeasure> result;
+  for (size_t i = 0; i < measures.size(); ++i) {
+    if (measures[i].checkForUpdatesFiles(newFiles[i])) {
+      result.push_back(measures[i]);
+    }
+  }
+  return result;
+}
+
 bool BCLMeasure::checkForUpdatesXML() {
   return m_bclXML.checkForUpdatesXML();
 }
@@ -235,6 +235,9 @@ class UTILITIES_API BCLMeasure
   /// Does not update the XML
   bool missingRequiredFields() const;
 
+  /// Files in the measure directory which are not yet listed in the XML paired with their usage type
+  std::vector<std::pair<openstudio::path, std::string>> untrackedFiles() const;
+
   /// Check for updates to files, will increment versionID and return true
   /// if any files have changed, been added, or removed from the measure
   /// The measure must still be saved to disk to preserve the new versionID
@@ -278,6 +281,10 @@ class UTILITIES_API BCLMeasure
   /// get all measures in an input directory
   static std::vector<BCLMeasure> getMeasuresInDir(const openstudio::path& dir);
 
+  /// get all measures in an input directory and checkForUpdatesFiles on each, files of all measures are checksummed in parallel
+  /// returns the measures that changed, these must still be saved to disk to preserve their new versionIDs
+  static std::vector<BCLMeasure> updateMeasuresInDir(const openstudio::path& dir);
+
   //@}
  private:
   // configure logging
@@ -285,6 +292,9 @@ class UTILITIES_API BCLMeasure
 
   static void createDirectory(const openstudio::path& dir);
 
+  // checkForUpdatesFiles given the untracked files, expects the files to already be in the checksum cache
+  bool checkForUpdatesFiles(const std::vector<std::pair<openstudio::path, std::string>>& newFiles);
+
   // based on function in PathHelpers.hpp but checks if file is in this measure
   bool copyDirectory(const path& source, const path& destination) const;
 
@@ -38,10 +38,14 @@
 
 #include <boost/algorithm/string/replace.hpp>
 
+#include <algorithm>
+#include <cctype>
+#include <limits>
+
 namespace openstudio {
 
 LocalBCL::LocalBCL(const path& libraryPath)
-  : m_libraryPath(libraryPath.lexically_normal()), m_dbName("components.sql"), m_dbVersion("1.3"), m_connectionOpen(false) {
+  : m_libraryPath(libraryPath.lexically_normal()), m_dbName("components.sql"), m_dbVersion("1.3"), m_connectionOpen(false), m_fullTextSearch(false) {
   //TODO: QT-Separation-Move
   //Make sure a QApplication exists
   //openstudio::Application::instance().application(false);
@@ -78,6 +82,11 @@ LocalBCL::LocalBCL(const path& libraryPath)
     LOG_AND_THROW("Unable to update Local Database");
   }
 
+  // Searches still work without the indexes, only slower
+  if (!initializeSearchIndexes()) {
+    LOG(Warn, "Unable to create search indexes for Local Database");
+  }
+
   // Retrieve oauthConsumerKeys from database
   {
     std::string statement = "SELECT data FROM Settings WHERE name='prodAuthKey'";
@@ -244,6 +253,11 @@ void LocalBCL::close() {
 bool LocalBCL::closeConnection() {
   // Close the connection to the database if needed
   if (m_connectionOpen) {
+    // all statements must be finalized before closing
+    for (const auto& p : m_preparedStatements) {
+      sqlite3_finalize(p.second);
+    }
+    m_preparedStatements.clear();
     sqlite3_close(m_db);
     m_connectionOpen = false;
   }
@@ -255,6 +269,24 @@ LocalBCL::~LocalBCL() {
   closeConnection();
 }
 
+sqlite3_stmt* LocalBCL::preparedStatement(const std::string& statement) const {
+  auto it = m_preparedStatements.find(statement);
+  if (it != m_preparedStatements.end()) {
+    sqlite3_reset(it->second);
+    sqlite3_clear_bindings(it->second);
+    return it->second;
+  }
+
+  sqlite3_stmt* sqlStmtPtr = nullptr;
+  if (sqlite3_prepare_v2(m_db, statement.c_str(), -1, &sqlStmtPtr, nullptr) != SQLITE_OK) {
+    LOG(Error, "Unable to prepare Statement: " << statement << ": " << sqlite3_errmsg(m_db));
+    sqlite3_finalize(sqlStmtPtr);  // No-op
+    return nullptr;
+  }
+  m_preparedStatements.emplace(statement, sqlStmtPtr);
+  return sqlStmtPtr;
+}
+
 bool LocalBCL::initializeLocalDb() {
   std::string create_statements(
     "CREATE TABLE Settings (name VARCHAR, data VARCHAR);"
@@ -658,6 +690,105 @@ bool LocalBCL::updateLocalDb() {
   return false;
 }
 
+bool LocalBCL::initializeSearchIndexes() {
+  std::string index_statements("CREATE INDEX IF NOT EXISTS ComponentsUid ON Components (uid, version_id);"
+                               "CREATE INDEX IF NOT EXISTS MeasuresUid ON Measures (uid, version_id);"
+                               "CREATE INDEX IF NOT EXISTS FilesUid ON Files (uid, version_id);"
+                               "CREATE INDEX IF NOT EXISTS AttributesUid ON Attributes (uid, version_id);"
+                               "CREATE INDEX IF NOT EXISTS AttributesNameValue ON Attributes (name COLLATE NOCASE, value COLLATE NOCASE);");
+
+  char* err = nullptr;
+  if (sqlite3_exec(m_db, index_statements.c_str(), nullptr, nullptr, &err) != SQLITE_OK) {
+    std::string errstr;
+
+    if (err) {
+      errstr = err;
+      sqlite3_free(err);
+    }
+
+    LOG(Error, "Error in initializeSearchIndexes when creating indexes: " << errstr);
+    return false;
+  }
+
+  // Full text search tables share their rowids with the Components and Measures tables, they are not part of the dbVersion
+  // since older versions ignore them, if SQLite was built without FTS5 searches fall back on LIKE
+  std::string fts_statements(
+    "CREATE VIRTUAL TABLE IF NOT EXISTS ComponentsSearch USING fts5(uid UNINDEXED, version_id UNINDEXED, name, description);"
+    "CREATE VIRTUAL TABLE IF NOT EXISTS MeasuresSearch USING fts5(uid UNINDEXED, version_id UNINDEXED, name, description, modeler_description);");
+
+  if (sqlite3_exec(m_db, fts_statements.c_str(), nullptr, nullptr, &err) != SQLITE_OK) {
+    std::string errstr;
+
+    if (err) {
+      errstr = err;
+      sqlite3_free(err);
+    }
+
+    LOG(Warn, "Full text search is not available for Local Database, searches will be slower: " << errstr);
+    m_fullTextSearch = false;
+    return true;
+  }
+  m_fullTextSearch = true;
+
+  // Rebuild a table if it is out of sync, e.g. after the library was modified by an older version
+  std::vector<std::pair<std::string, std::string>> tables = {
+    {"Components", "uid, version_id, name, description"},
+    {"Measures", "uid, version_id, name, description, modeler_description"},
+  };
+
+  for (const auto& table : tables) {
+    std::string statement = "SELECT (SELECT count(*) || ':' || total(rowid) FROM " + table.first + ") = (SELECT count(*) || ':' || total(rowid) FROM "
+                            + table.first + "Search)";
+    sqlite3_stmt* sqlStmtPtr;
+    if (sqlite3_prepare_v2(m_db, statement.c_str(), -1, &sqlStmtPtr, nullptr) != SQLITE_OK) {
+      LOG(Error, "Unable to prepare search index check Statement: " << statement);
+      sqlite3_finalize(sqlStmtPtr);  // No-op
+      m_fullTextSearch = false;
+      return false;
+    }
+    bool inSync = (sqlite3_step(sqlStmtPtr) == SQLITE_ROW) && (sqlite3_column_int(sqlStmtPtr, 0) != 0);
+    sqlite3_finalize(sqlStmtPtr);
+
+    if (inSync) {
+      continue;
+    }
+
+    LOG(Info, "Rebuilding search index for " << table.first);
+
+    // Start a transaction, so we can handle failures without messing up the database
+    if (!beginTransaction()) {
+      m_fullTextSearch = false;
+      return false;
+    }
+
+    std::string rebuild_statements("DELETE FROM " + table.first + "Search;"
+                                   "INSERT INTO "
+                                   + table.first + "Search (rowid, " + table.second + ") SELECT rowid, " + table.second + " FROM " + table.first + ";");
+
+    if (sqlite3_exec(m_db, rebuild_statements.c_str(), nullptr, nullptr, &err) != SQLITE_OK) {
+      std::string errstr;
+
+      if (err) {
+        errstr = err;
+        sqlite3_free(err);
+      }
+
+      LOG(Error, "Error in initializeSearchIndexes when rebuilding search index for " << table.first << ": " << errstr);
+      // Rollback changes
+      rollbackTransaction();
+      m_fullTextSearch = false;
+      return false;
+    }
+
+    if (!commitTransaction()) {
+      m_fullTextSearch = false;
+      return false;
+    }
+  }
+
+  return true;
+}
+
 /// Inherited members
 
 boost::optional<BCLComponent> LocalBCL::getComponent(const std::string& uid, const std::string& versionId) const {
@@ -665,38 +796,28 @@ boost::optional<BCLComponent> LocalBCL::getComponent(const std::string& uid, con
 
   if (m_db) {
 
+    sqlite3_stmt* sqlStmtPtr = nullptr;
     if (versionId.empty()) {
-
-      std::string statement = "SELECT version_id FROM Components WHERE uid='" + escape(uid) + "'";
-      sqlite3_stmt* sqlStmtPtr;
-      if (sqlite3_prepare_v2(m_db, statement.c_str(), -1, &sqlStmtPtr, nullptr) != SQLITE_OK) {
-        LOG(Error, "Unable to prepare version_id Statement");
-        sqlite3_finalize(sqlStmtPtr);  // No-op
-        return boost::none;
-      }
-
-      if (sqlite3_step(sqlStmtPtr) == SQLITE_ROW) {
-        std::string version_id = columnText(sqlite3_column_text(sqlStmtPtr, 0));
-        result = boost::optional<BCLComponent>(m_libraryPath / uid / version_id);
-      }
-      // Finalize statement to prevent memory leak
-      sqlite3_finalize(sqlStmtPtr);
+      sqlStmtPtr = preparedStatement("SELECT version_id FROM Components WHERE uid=?");
     } else {
-      std::string statement = "SELECT version_id FROM Components WHERE uid='" + escape(uid) + "' AND version_id='" + escape(versionId) + "'";
-      sqlite3_stmt* sqlStmtPtr;
-      if (sqlite3_prepare_v2(m_db, statement.c_str(), -1, &sqlStmtPtr, nullptr) != SQLITE_OK) {
-        LOG(Error, "Unable to prepare version_id Statement from uid and versionId.");
-        sqlite3_finalize(sqlStmtPtr);  // No-op
-        return boost::none;
-      }
+      sqlStmtPtr = preparedStatement("SELECT version_id FROM Components WHERE uid=? AND version_id=?");
+    }
+    if (!sqlStmtPtr) {
+      return boost::none;
+    }
 
-      if (sqlite3_step(sqlStmtPtr) == SQLITE_ROW) {
-        std::string version_id = columnText(sqlite3_column_text(sqlStmtPtr, 0));
-        result = boost::optional<BCLComponent>(m_libraryPath / uid / version_id);
-      }
-      // Finalize statement to prevent memory leak
-      sqlite3_finalize(sqlStmtPtr);
+    if ((sqlite3_bind_text(sqlStmtPtr, 1, uid.c_str(), uid.size(), SQLITE_TRANSIENT) != SQLITE_OK)
+        || (!versionId.empty() && (sqlite3_bind_text(sqlStmtPtr, 2, versionId.c_str(), versionId.size(), SQLITE_TRANSIENT) != SQLITE_OK))) {
+      LOG(Error, "Error binding uid and versionId: " << uid << ", " << versionId);
+      return boost::none;
+    }
+
+    if (sqlite3_step(sqlStmtPtr) == SQLITE_ROW) {
+      std::string version_id = columnText(sqlite3_column_text(sqlStmtPtr, 0));
+      result = boost::optional<BCLComponent>(m_libraryPath / uid / version_id);
     }
+    // Reset statement for its next use
+    sqlite3_reset(sqlStmtPtr);
   }
 
   return result;
@@ -709,18 +830,21 @@ boost::optional<BCLMeasure> LocalBCL::getMeasure(const std::string& uid, const s
 
     if (versionId.empty()) {
 
-      std::string statement = "SELECT version_id FROM Measures WHERE uid='" + escape(uid) + "'";
-      sqlite3_stmt* sqlStmtPtr;
-      int code = sqlite3_prepare_v2(m_db, statement.c_str(), -1, &sqlStmtPtr, nullptr);
-      if (code != SQLITE_OK) {
-        LOG(Error, "Unable to prepare version_id Statement: " << statement);
-        sqlite3_finalize(sqlStmtPtr);  // No-op
+      sqlite3_stmt* sqlStmtPtr = preparedStatement("SELECT version_id FROM Measures WHERE uid=?");
+      if (!sqlStmtPtr) {
+        return boost::none;
+      }
+
+      if (sqlite3_bind_text(sqlStmtPtr, 1, uid.c_str(), uid.size(), SQLITE_TRANSIENT) != SQLITE_OK) {
+        LOG(Error, "Error binding uid: " << uid);
         return boost::none;
       }
 
       // We seek the most recent modified one in case we find several, so store that
       boost::optional<DateTime> mostRecentModified;
 
+      int code = SQLITE_OK;
+
       // Loop until done (or failed)
       while ((code != SQLITE_DONE) && (code != SQLITE_BUSY) && (code != SQLITE_ERROR) && (code != SQLITE_MISUSE))  //loop until SQLITE_DONE
       {
@@ -752,16 +876,20 @@ boost::optional<BCLMeasure> LocalBCL::getMeasure(const std::string& uid, const s
         }
       }  // End loop on each match
 
-      // Finalize statement whether it suceeded or not
-      sqlite3_finalize(sqlStmtPtr);
+      // Reset statement for its next use
+      sqlite3_reset(sqlStmtPtr);
 
     } else {
 
-      std::string statement = "SELECT version_id FROM Measures WHERE uid='" + escape(uid) + "' AND version_id='" + escape(versionId) + "'";
-      sqlite3_stmt* sqlStmtPtr;
-      if (sqlite3_prepare_v2(m_db, statement.c_str(), -1, &sqlStmtPtr, nullptr) != SQLITE_OK) {
-        sqlite3_finalize(sqlStmtPtr);  // No-op
-        LOG(Error, "Unable to prepare version_id Statement");
+      sqlite3_stmt* sqlStmtPtr = preparedStatement("SELECT version_id FROM Measures WHERE uid=? AND version_id=?");
+      if (!sqlStmtPtr) {
+        return boost::none;
+      }
+
+      if ((sqlite3_bind_text(sqlStmtPtr, 1, uid.c_str(), uid.size(), SQLITE_TRANSIENT) != SQLITE_OK)
+          || (sqlite3_bind_text(sqlStmtPtr, 2, versionId.c_str(), versionId.size(), SQLITE_TRANSIENT) != SQLITE_OK)) {
+        LOG(Error, "Error binding uid and versionId: " << uid << ", " << versionId);
+        return boost::none;
       }
 
       if (sqlite3_step(sqlStmtPtr) == SQLITE_ROW) {
@@ -772,8 +900,8 @@ boost::optional<BCLMeasure> LocalBCL::getMeasure(const std::string& uid, const s
           LOG(Error, "Cannot find BCL measure at '" << m_libraryPath / uid / version_id << "': " << e.what());
         }
       }
-      // Finalize statement to prevent memory leak
-      sqlite3_finalize(sqlStmtPtr);
+      // Reset statement for its next use
+      sqlite3_reset(sqlStmtPtr);
     }
   }
 
@@ -913,45 +1041,11 @@ std::vector<std::string> LocalBCL::measureUids() const {
 std::vector<BCLComponent> LocalBCL::searchComponents(const std::string& searchTerm, const std::string& componentType) const {
   std::vector<BCLComponent> results;
 
-  if (m_db) {
-    std::string statement("SELECT uid, version_id FROM Components where name"
-                          "  LIKE \"%"
-                          + searchTerm + "%\" OR description LIKE \"%" + searchTerm + "%\"");
-    sqlite3_stmt* sqlStmtPtr;
-    if (sqlite3_prepare_v2(m_db, statement.c_str(), -1, &sqlStmtPtr, nullptr) != SQLITE_OK) {
-      LOG(Error, "Unable to prepare searchComponents Statement");
-      sqlite3_finalize(sqlStmtPtr);  // No-op
-      return results;
+  for (const auto& uid : searchUids(searchTerm, "component", -1, 0)) {
+    boost::optional<BCLComponent> current(m_libraryPath / uid.first / uid.second);
+    if (current) {
+      results.push_back(current.get());
     }
-
-    int code = sqlite3_prepare_v2(m_db, statement.c_str(), -1, &sqlStmtPtr, nullptr);
-    if (code != SQLITE_OK) {
-      LOG(Error, "Unable to prepare searchComponents Statement: " << statement);
-      sqlite3_finalize(sqlStmtPtr);  // No-op
-      return results;
-    }
-
-    // Loop until done (or failed)
-    while ((code != SQLITE_DONE) && (code != SQLITE_BUSY) && (code != SQLITE_ERROR) && (code != SQLITE_MISUSE))  //loop until SQLITE_DONE
-    {
-      code = sqlite3_step(sqlStmtPtr);
-      if (code == SQLITE_ROW) {
-        // Get values from SELECT
-        std::string uid = columnText(sqlite3_column_text(sqlStmtPtr, 0));
-        std::string version_id = columnText(sqlite3_column_text(sqlStmtPtr, 1));
-
-        boost::optional<BCLComponent> current(m_libraryPath / uid / version_id);
-        if (current) {
-          results.push_back(current.get());
-        }
-      } else  // i didn't get a row.  something is wrong so set the exit condition.
-      {       // should never get here since i test for all documented return states above
-        code = SQLITE_DONE;
-      }
-    }  // End loop on each match
-
-    // Finalize statement to prevent memory leak
-    sqlite3_finalize(sqlStmtPtr);
   }
 
   return results;
@@ -965,53 +1059,188 @@ std::vector<BCLMeasure> LocalBCL::searchMeasures(const std::string& searchTerm,
 
   std::vector<BCLMeasure> results;
 
-  if (m_db) {
-    std::string statement("SELECT uid, version_id FROM Measures where name LIKE \"%" + searchTerm
-                          + "%\""
-                            "  OR description LIKE \"%"
-                          + searchTerm + "%\" OR modeler_description LIKE \"%" + searchTerm + "%\"");
-    sqlite3_stmt* sqlStmtPtr;
-    if (sqlite3_prepare_v2(m_db, statement.c_str(), -1, &sqlStmtPtr, nullptr) != SQLITE_OK) {
-      LOG(Error, "Unable to prepare searchMeasures Statement");
-      sqlite3_finalize(sqlStmtPtr);  // No-op
-      return results;
+  for (const auto& uid : searchUids(searchTerm, "measure", -1, 0)) {
+    boost::optional<BCLMeasure> current = BCLMeasure::load(m_libraryPath / uid.first / uid.second);
+    if (current) {
+      results.push_back(current.get());
     }
+  }
 
-    int code = sqlite3_prepare_v2(m_db, statement.c_str(), -1, &sqlStmtPtr, nullptr);
-    if (code != SQLITE_OK) {
-      LOG(Error, "Unable to prepare searchMeasures Statement: " << statement);
-      sqlite3_finalize(sqlStmtPtr);  // No-op
-      return results;
+  return results;
+}
+
+std::vector<BCLMeasure> LocalBCL::searchMeasures(const std::string& searchTerm, const unsigned componentTypeTID) const {
+  return searchMeasures(searchTerm, "");
+}
+
+std::vector<BCLComponent> LocalBCL::searchComponents(const std::string& searchTerm, const std::string& componentType, unsigned page,
+                                                     unsigned resultsPerPage) const {
+  std::vector<BCLComponent> results;
+
+  for (const auto& uid : searchUids(searchTerm, "component", resultsPerPage, pageOffset(page, resultsPerPage))) {
+    boost::optional<BCLComponent> current(m_libraryPath / uid.first / uid.second);
+    if (current) {
+      results.push_back(current.get());
     }
+  }
 
-    // Loop until done (or failed)
-    while ((code != SQLITE_DONE) && (code != SQLITE_BUSY) && (code != SQLITE_ERROR) && (code != SQLITE_MISUSE))  //loop until SQLITE_DONE
-    {
-      code = sqlite3_step(sqlStmtPtr);
-      if (code == SQLITE_ROW) {
-        // Get values from SELECT
-        std::string uid = columnText(sqlite3_column_text(sqlStmtPtr, 0));
-        std::string version_id = columnText(sqlite3_column_text(sqlStmtPtr, 1));
+  return results;
+}
 
-        boost::optional<BCLMeasure> current = BCLMeasure::load(m_libraryPath / uid / version_id);
-        if (current) {
-          results.push_back(current.get());
-        }
-      } else  // i didn't get a row.  something is wrong so set the exit condition.
-      {       // should never get here since i test for all documented return states above
-        code = SQLITE_DONE;
-      }
-    }  // End loop on each match
+std::vector<BCLMeasure> LocalBCL::searchMeasures(const std::string& searchTerm, const std::string& componentType, unsigned page,
+                                                 unsigned resultsPerPage) const {
+  std::vector<BCLMeasure> results;
 
-    // Finalize statement to prevent memory leak
-    sqlite3_finalize(sqlStmtPtr);
+  for (const auto& uid : searchUids(searchTerm, "measure", resultsPerPage, pageOffset(page, resultsPerPage))) {
+    boost::optional<BCLMeasure> current = BCLMeasure::load(m_libraryPath / uid.first / uid.second);
+    if (current) {
+      results.push_back(current.get());
+    }
   }
 
   return results;
 }
 
-std::vector<BCLMeasure> LocalBCL::searchMeasures(const std::string& searchTerm, const unsigned componentTypeTID) const {
-  return searchMeasures(searchTerm, "");
+unsigned LocalBCL::numComponentSearchResults(const std::string& searchTerm) const {
+  return numSearchResults(searchTerm, "component");
+}
+
+unsigned LocalBCL::numMeasureSearchResults(const std::string& searchTerm) const {
+  return numSearchResults(searchTerm, "measure");
+}
+
+long long LocalBCL::pageOffset(unsigned page, unsigned resultsPerPage) {
+  // computed in 64 bits since the unsigned product wraps around, offsets past the last result simply return nothing
+  unsigned long long offset = static_cast<unsigned long long>(page) * resultsPerPage;
+  return static_cast<long long>(std::min<unsigned long long>(offset, std::numeric_limits<long long>::max()));
+}
+
+std::vector<std::pair<std::string, std::string>> LocalBCL::searchUids(const std::string& searchTerm, const std::string& componentType,
+                                                                      long long limit, long long offset) const {
+  std::vector<std::pair<std::string, std::string>> uids;
+
+  if (!m_db) {
+    return uids;
+  }
+
+  bool measures = (componentType == "measure");
+  std::string tableName = measures ? "Measures" : "Components";
+
+  // 1=limit, 2=offset, 3=search term
+  std::string statement;
+  std::string query = fullTextQuery(searchTerm);
+  if (searchTerm.empty()) {
+    statement = "SELECT uid, version_id FROM " + tableName + " ORDER BY name COLLATE NOCASE LIMIT ?1 OFFSET ?2";
+  } else if (m_fullTextSearch && !query.empty()) {
+    // bm25 weights for uid, version_id, name, description, modeler_description
+    statement = "SELECT uid, version_id FROM " + tableName + "Search WHERE " + tableName + "Search MATCH ?3 ORDER BY bm25(" + tableName
+                + "Search, 0.0, 0.0, 10.0, 5.0" + (measures ? ", 1.0" : "") + ") LIMIT ?1 OFFSET ?2";
+  } else {
+    statement = "SELECT uid, version_id FROM " + tableName + " WHERE name LIKE ?3 OR description LIKE ?3"
+                + (measures ? " OR modeler_description LIKE ?3" : "") + " ORDER BY (name LIKE ?3) DESC, name COLLATE NOCASE LIMIT ?1 OFFSET ?2";
+    query = "%" + searchTerm + "%";
+  }
+
+  sqlite3_stmt* sqlStmtPtr = preparedStatement(statement);
+  if (!sqlStmtPtr) {
+    return uids;
+  }
+
+  if ((sqlite3_bind_int64(sqlStmtPtr, 1, limit) != SQLITE_OK) || (sqlite3_bind_int64(sqlStmtPtr, 2, offset) != SQLITE_OK)
+      || (!searchTerm.empty() && (sqlite3_bind_text(sqlStmtPtr, 3, query.c_str(), query.size(), SQLITE_TRANSIENT) != SQLITE_OK))) {
+    LOG(Error, "Error binding search parameters: " << searchTerm);
+    return uids;
+  }
+
+  int code = SQLITE_OK;
+
+  // Loop until done (or failed)
+  while ((code != SQLITE_DONE) && (code != SQLITE_BUSY) && (code != SQLITE_ERROR) && (code != SQLITE_MISUSE))  //loop until SQLITE_DONE
+  {
+    code = sqlite3_step(sqlStmtPtr);
+    if (code == SQLITE_ROW) {
+      // Get values from SELECT
+      std::string uid = columnText(sqlite3_column_text(sqlStmtPtr, 0));
+      std::string version_id = columnText(sqlite3_column_text(sqlStmtPtr, 1));
+
+      uids.push_back(make_pair(uid, version_id));
+    } else  // i didn't get a row.  something is wrong so set the exit condition.
+    {       // should never get here since i test for all documented return states above
+      code = SQLITE_DONE;
+    }
+  }  // End loop on each match
+
+  // Reset statement for its next use
+  sqlite3_reset(sqlStmtPtr);
+
+  return uids;
+}
+
+unsigned LocalBCL::numSearchResults(const std::string& searchTerm, const std::string& componentType) const {
+  if (!m_db) {
+    return 0;
+  }
+
+  bool measures = (componentType == "measure");
+  std::string tableName = measures ? "Measures" : "Components";
+
+  std::string statement;
+  std::string query = fullTextQuery(searchTerm);
+  if (searchTerm.empty()) {
+    statement = "SELECT count(*) FROM " + tableName;
+  } else if (m_fullTextSearch && !query.empty()) {
+    statement = "SELECT count(*) FROM " + tableName + "Search WHERE " + tableName + "Search MATCH ?1";
+  } else {
+    statement = "SELECT count(*) FROM " + tableName + " WHERE name LIKE ?1 OR description LIKE ?1" + (measures ? " OR modeler_description LIKE ?1" : "");
+    query = "%" + searchTerm + "%";
+  }
+
+  sqlite3_stmt* sqlStmtPtr = preparedStatement(statement);
+  if (!sqlStmtPtr) {
+    return 0;
+  }
+
+  if (!searchTerm.empty() && (sqlite3_bind_text(sqlStmtPtr, 1, query.c_str(), query.size(), SQLITE_TRANSIENT) != SQLITE_OK)) {
+    LOG(Error, "Error binding search parameters: " << searchTerm);
+    return 0;
+  }
+
+  unsigned result = 0;
+  if (sqlite3_step(sqlStmtPtr) == SQLITE_ROW) {
+    result = sqlite3_column_int(sqlStmtPtr, 0);
+  }
+
+  // Reset statement for its next use
+  sqlite3_reset(sqlStmtPtr);
+
+  return result;
+}
+
+std::string LocalBCL::fullTextQuery(const std::string& searchTerm) {
+  // the default unicode61 tokenizer separates words on ASCII characters which are not alphanumeric
+  std::string result;
+  std::string word;
+  auto addWord = [&result, &word]() {
+    if (!word.empty()) {
+      if (!result.empty()) {
+        result += ' ';
+      }
+      result += '"' + word + "\"*";
+      word.clear();
+    }
+  };
+
+  for (char c : searchTerm) {
+    auto uc = static_cast<unsigned char>(c);
+    if ((uc >= 0x80) || std::isalnum(uc)) {
+      word += c;
+    } else {
+      addWord();
+    }
+  }
+  addWord();
+
+  return result;
 }
 
 /// Class members
@@ -1030,6 +1259,10 @@ bool LocalBCL::addComponent(BCLComponent& component) {
     std::string versionId = component.versionId();
 
     std::string statement = "DELETE FROM Components WHERE uid='" + escape(uid) + "' AND version_id='" + escape(versionId) + "'";
+    if (m_fullTextSearch) {
+      statement = "DELETE FROM ComponentsSearch WHERE rowid IN (SELECT rowid FROM Components WHERE uid='" + escape(uid) + "' AND version_id='"
+                  + escape(versionId) + "');" + statement;
+    }
     if (sqlite3_exec(m_db, statement.c_str(), nullptr, nullptr, nullptr) != SQLITE_OK) {
       // Rollback changes
       LOG(Error, "addComponent: statement failed, rolling back: " << statement);
@@ -1042,6 +1275,10 @@ bool LocalBCL::addComponent(BCLComponent& component) {
       ss << "INSERT INTO Components (uid, version_id, name, description, date_added, date_modified) "
          << "VALUES('" << escape(uid) << "', '" << escape(versionId) << "', '" << escape(component.name()) << "', '"
          << escape(component.description()) << "', datetime('now','localtime'), datetime('now','localtime'));";
+      if (m_fullTextSearch) {
+        ss << "INSERT INTO ComponentsSearch (rowid, uid, version_id, name, description) "
+           << "SELECT rowid, uid, version_id, name, description FROM Components WHERE rowid = last_insert_rowid();";
+      }
 
       statement = ss.str();
 
@@ -1155,6 +1392,10 @@ bool LocalBCL::removeComponent(BCLComponent& component) {
                         + "';"
                           "DELETE FROM Attributes WHERE uid='"
                         + escape(uid) + "' AND version_id='" + escape(versionId) + "';");
+  if (m_fullTextSearch) {
+    statement = "DELETE FROM ComponentsSearch WHERE rowid IN (SELECT rowid FROM Components WHERE uid='" + escape(uid) + "' AND version_id='"
+                + escape(versionId) + "');" + statement;
+  }
   if (sqlite3_exec(m_db, statement.c_str(), nullptr, nullptr, nullptr) != SQLITE_OK) {
     LOG(Error, "Couldn't delete component from SQL file: " << statement);
     // Rollback changes
@@ -1218,6 +1459,10 @@ bool LocalBCL::addMeasure(BCLMeasure& measure) {
   std::string versionId = measure.versionId();
 
   std::string statement = "DELETE FROM Measures WHERE uid='" + escape(uid) + "' AND version_id='" + escape(versionId) + "'";
+  if (m_fullTextSearch) {
+    statement = "DELETE FROM MeasuresSearch WHERE rowid IN (SELECT rowid FROM Measures WHERE uid='" + escape(uid) + "' AND version_id='"
+                + escape(versionId) + "');" + statement;
+  }
   if (sqlite3_exec(m_db, statement.c_str(), nullptr, nullptr, nullptr) != SQLITE_OK) {
     // Rollback changes
     LOG(Error, "addMeasure: statement failed, rolling back: " << statement);
@@ -1229,8 +1474,12 @@ bool LocalBCL::addMeasure(BCLMeasure& measure) {
     std::stringstream ss;
     ss << "INSERT INTO Measures (uid, version_id, name, description, modeler_description, date_added, date_modified) "
        << "VALUES('" << escape(uid) << "', '" << escape(versionId) << "', '" << escape(measure.name()) << "', '" << escape(measure.description())
-       << "', '" << escape(measure.description()) << "'"
+       << "', '" << escape(measure.modelerDescription()) << "'"
        << ", datetime('now','localtime'), datetime('now','localtime'));";
+    if (m_fullTextSearch) {
+      ss << "INSERT INTO MeasuresSearch (rowid, uid, version_id, name, description, modeler_description) "
+         << "SELECT rowid, uid, version_id, name, description, modeler_description FROM Measures WHERE rowid = last_insert_rowid();";
+    }
 
     statement = ss.str();
 
@@ -1339,6 +1588,10 @@ bool LocalBCL::removeMeasure(BCLMeasure& measure) {
                         + "';"
                           "DELETE FROM Attributes WHERE uid='"
                         + escape(uid) + "' AND version_id='" + escape(versionId) + "';");
+  if (m_fullTextSearch) {
+    statement = "DELETE FROM MeasuresSearch WHERE rowid IN (SELECT rowid FROM Measures WHERE uid='" + escape(uid) + "' AND version_id='"
+                + escape(versionId) + "');" + statement;
+  }
   if (sqlite3_exec(m_db, statement.c_str(), nullptr, nullptr, nullptr) != SQLITE_OK) {
     LOG(Error, "Couldn't delete measure from SQL file: " << statement);
     // Rollback changes
@@ -1421,7 +1674,6 @@ std::vector<BCLMeasure> LocalBCL::measureAttributeSearch(const std::vector<std::
 
 std::set<std::pair<std::string, std::string>> LocalBCL::attributeSearch(const std::vector<std::pair<std::string, std::string>>& searchTerms,
                                                                         const std::string& componentType) const {
-  typedef std::vector<std::pair<std::string, std::string>> UidsVecType;
   typedef std::set<std::pair<std::string, std::string>> UidsType;
 
   UidsType uids;
@@ -1430,109 +1682,60 @@ std::set<std::pair<std::string, std::string>> LocalBCL::attributeSearch(const st
     return uids;
   }
 
-  // Make pairs of (uid, version_id)
-  {
-    std::string tableName = (componentType == "component") ? "Components" : ((componentType == "measure") ? "Measures" : "");
-
-    std::string statement = "SELECT DISTINCT uid, version_id FROM " + tableName;
-    sqlite3_stmt* sqlStmtPtr;
-    int code = sqlite3_prepare_v2(m_db, statement.c_str(), -1, &sqlStmtPtr, nullptr);
-    if (code != SQLITE_OK) {
-      LOG(Error, "Cannot prepare statement (in searchTerms): " << statement);
-      sqlite3_finalize(sqlStmtPtr);  // No-op
-      return UidsType();
-    }
-
-    // Loop until done (or failed)
-    while ((code != SQLITE_DONE) && (code != SQLITE_BUSY) && (code != SQLITE_ERROR) && (code != SQLITE_MISUSE))  //loop until SQLITE_DONE
-    {
-      code = sqlite3_step(sqlStmtPtr);
-      if (code == SQLITE_ROW) {
-        // Get values from SELECT
-        std::string uid = columnText(sqlite3_column_text(sqlStmtPtr, 0));
-        std::string version_id = columnText(sqlite3_column_text(sqlStmtPtr, 1));
-
-        uids.insert(make_pair(uid, version_id));
+  std::string tableName = (componentType == "component") ? "Components" : ((componentType == "measure") ? "Measures" : "");
+  if (tableName.empty()) {
+    return uids;
+  }
 
-      } else  // i didn't get a row.  something is wrong so set the exit condition.
-      {       // should never get here since i test for all documented return states above
-        code = SQLITE_DONE;
-      }
-    }  // End loop on each match
+  // Intersect the (uid, version_id) pairs matching each search term in a single statement,
+  // which is prepared once per number of search terms
+  // (Note: do not do name='?', it won't think it's a bind parameter)
+  std::string statement = "SELECT uid, version_id FROM " + tableName;
+  for (size_t i = 0; i < searchTerms.size(); ++i) {
+    statement += " INTERSECT SELECT uid, version_id FROM Attributes WHERE name=? COLLATE NOCASE AND value=? COLLATE NOCASE";
+  }
 
-    // Finalize statement to prevent memory leak
-    sqlite3_finalize(sqlStmtPtr);
+  sqlite3_stmt* sqlStmtPtr = preparedStatement(statement);
+  if (!sqlStmtPtr) {
+    return UidsType();
   }
 
-  // Loop on search terms
-  {
+  // Bind the values now
+  int index = 1;
+  for (const auto& searchTerm : searchTerms) {
+    const std::string& name = searchTerm.first;
+    const std::string& value = searchTerm.second;
 
-    // Prepare a statement that we'll bind
-    // (Note: do not do name='?', it won't think it's a bind parameter)
-    std::string statement = "SELECT uid, version_id FROM Attributes WHERE name=? COLLATE NOCASE AND value=? COLLATE NOCASE";
-    sqlite3_stmt* sqlStmtPtr;
-    if (sqlite3_prepare_v2(m_db, statement.c_str(), -1, &sqlStmtPtr, nullptr) != SQLITE_OK) {
-      LOG(Error, "Cannot prepare statement (in searchTerms): " << statement);
-      sqlite3_finalize(sqlStmtPtr);  // No-op
+    if (sqlite3_bind_text(sqlStmtPtr, index++, name.c_str(), name.size(), SQLITE_TRANSIENT) != SQLITE_OK) {
+      LOG(Error, "Error binding to the 1st parameter (in searchTerms), name: " << name);
+      return UidsType();
+    } else if (sqlite3_bind_text(sqlStmtPtr, index++, value.c_str(), value.size(), SQLITE_TRANSIENT) != SQLITE_OK) {
+      LOG(Error, "Error binding to the 2nd parameter (in searchTerms), value: " << value);
       return UidsType();
     }
+  }
 
-    for (const auto& searchTerm : searchTerms) {
-
-      UidsType theseUids;
-
-      // Reset the statement to allow binding variables on the next iteration
-      sqlite3_reset(sqlStmtPtr);
-
-      // Bind the values now
-      std::string name = escape(searchTerm.first);
-      std::string value = escape(searchTerm.second);
-
-      if (sqlite3_bind_text(sqlStmtPtr, 1, name.c_str(), name.size(), SQLITE_TRANSIENT) != SQLITE_OK) {
-        LOG(Error, "Error binding to the 1st parameter (in searchTerms), name: " << name);
-        sqlite3_finalize(sqlStmtPtr);
-        return UidsType();
-      } else if (sqlite3_bind_text(sqlStmtPtr, 2, value.c_str(), value.size(), SQLITE_TRANSIENT) != SQLITE_OK) {
-        LOG(Error, "Error binding to the 2nd parameter (in searchTerms), value: " << value);
-        sqlite3_finalize(sqlStmtPtr);
-        return UidsType();
-      }
-
-      int code = SQLITE_OK;
-
-      // Loop until done (or failed)
-      while ((code != SQLITE_DONE) && (code != SQLITE_BUSY) && (code != SQLITE_ERROR) && (code != SQLITE_MISUSE))  //loop until SQLITE_DONE
-      {
-        code = sqlite3_step(sqlStmtPtr);
-        if (code == SQLITE_ROW) {
-          // Get values from SELECT
-          std::string uid = columnText(sqlite3_column_text(sqlStmtPtr, 0));
-          std::string version_id = columnText(sqlite3_column_text(sqlStmtPtr, 1));
-
-          theseUids.insert(make_pair(uid, version_id));
-
-        } else  // i didn't get a row.  something is wrong so set the exit condition.
-        {       // should never get here since i test for all documented return states above
-          code = SQLITE_DONE;
-        }
-      }  // End loop on each match
-
-      UidsVecType newUids(std::max(uids.size(), theseUids.size()));
-      auto insertEnd = std::set_intersection(uids.begin(), uids.end(), theseUids.begin(), theseUids.end(), newUids.begin());
+  int code = SQLITE_OK;
 
-      uids.clear();
-      uids.insert(newUids.begin(), insertEnd);
+  // Loop until done (or failed)
+  while ((code != SQLITE_DONE) && (code != SQLITE_BUSY) && (code != SQLITE_ERROR) && (code != SQLITE_MISUSE))  //loop until SQLITE_DONE
+  {
+    code = sqlite3_step(sqlStmtPtr);
+    if (code == SQLITE_ROW) {
+      // Get values from SELECT
+      std::string uid = columnText(sqlite3_column_text(sqlStmtPtr, 0));
+      std::string version_id = columnText(sqlite3_column_text(sqlStmtPtr, 1));
 
-      if (uids.empty()) {
-        sqlite3_finalize(sqlStmtPtr);
-        return UidsType();
-      }
+      uids.insert(make_pair(uid, version_id));
 
-    }  // End loop on searchTerms
+    } else  // i didn't get a row.  something is wrong so set the exit condition.
+    {       // should never get here since i test for all documented return states above
+      code = SQLITE_DONE;
+    }
+  }  // End loop on each match
 
-    // Finalize statement to prevent memory leak
-    sqlite3_finalize(sqlStmtPtr);
-  }  // End Loop on search terms
+  // Reset statement for its next use
+  sqlite3_reset(sqlStmtPtr);
 
   return uids;
 }
@@ -34,10 +34,12 @@
 #include "../core/Optional.hpp"
 #include "../core/Path.hpp"
 
+#include <map>
 #include <string>
 #include <vector>
 
 struct sqlite3;
+struct sqlite3_stmt;
 
 namespace openstudio {
 
@@ -102,6 +104,22 @@ class UTILITIES_API LocalBCL : public BCL
   virtual std::vector<BCLMeasure> searchMeasures(const std::string& searchTerm, const std::string& componentType) const;
   virtual std::vector<BCLMeasure> searchMeasures(const std::string& searchTerm, const unsigned componentTypeTID) const;
 
+  /// Perform a component search of the library, results are ranked by relevance and returned in 'pages'
+  /// of resultsPerPage results, use numComponentSearchResults to determine the number of pages available
+  std::vector<BCLComponent> searchComponents(const std::string& searchTerm, const std::string& componentType, unsigned page,
+                                             unsigned resultsPerPage) const;
+
+  /// Perform a measure search of the library, results are ranked by relevance and returned in 'pages'
+  /// of resultsPerPage results, use numMeasureSearchResults to determine the number of pages available
+  std::vector<BCLMeasure> searchMeasures(const std::string& searchTerm, const std::string& componentType, unsigned page,
+                                         unsigned resultsPerPage) const;
+
+  /// Returns the total number of results of a component search of the library
+  unsigned numComponentSearchResults(const std::string& searchTerm) const;
+
+  /// Returns the total number of results of a measure search of the library
+  unsigned numMeasureSearchResults(const std::string& searchTerm) const;
+
   //@}
   /** @name Class members */
   //@{
@@ -161,6 +179,10 @@ class UTILITIES_API LocalBCL : public BCL
 
   bool updateLocalDb();
 
+  // Creates the indexes and full text search tables used by searches if they do not exist yet,
+  // and rebuilds the full text search tables if they are out of sync with the Components and Measures tables
+  bool initializeSearchIndexes();
+
   bool validateProdAuthKey(const std::string& authKey);
   bool validateDevAuthKey(const std::string& authKey);
 
@@ -169,12 +191,28 @@ class UTILITIES_API LocalBCL : public BCL
   std::set<std::pair<std::string, std::string>> attributeSearch(const std::vector<std::pair<std::string, std::string>>& searchTerms,
                                                                 const std::string& componentType) const;
 
+  // Returns (uid, version_id) pairs of the components or measures matching searchTerm, best match first,
+  // a negative limit returns all results
+  std::vector<std::pair<std::string, std::string>> searchUids(const std::string& searchTerm, const std::string& componentType, long long limit,
+                                                              long long offset) const;
+
+  // Offset of the first result on a page, page * resultsPerPage clamped to what sqlite accepts
+  static long long pageOffset(unsigned page, unsigned resultsPerPage);
+
+  unsigned numSearchResults(const std::string& searchTerm, const std::string& componentType) const;
+
+  // Converts a search term to a full text query matching each of its words as a prefix, empty if it has no words
+  static std::string fullTextQuery(const std::string& searchTerm);
+
   static std::string formatString(double d, unsigned prec = 15);
 
   static std::shared_ptr<LocalBCL>& instanceInternal();
 
   bool closeConnection();
 
+  // Returns a statement prepared once per connection and reset for reuse, or nullptr if it could not be prepared
+  sqlite3_stmt* preparedStatement(const std::string& statement) const;
+
   openstudio::path m_libraryPath;
   const openstudio::path m_dbName;
   const std::string m_dbVersion;
@@ -184,6 +222,8 @@ class UTILITIES_API LocalBCL : public BCL
   std::string m_devAuthKey;
 
   sqlite3* m_db;
+  bool m_fullTextSearch;
+  mutable std::map<std::string, sqlite3_stmt*> m_preparedStatements;
   openstudio::path m_sqliteFilePath;
   std::string m_sqliteFilename;
 
@@ -129,6 +129,37 @@ TEST_F(BCLFixture, BCLMeasure) {
   ASSERT_TRUE(measure2->primaryRubyScriptPath());
 }
 
+TEST_F(BCLFixture, BCLMeasure_UpdateMeasuresInDir) {
+  openstudio::path dir = resourcesPath() / toPath("/utilities/BCL/Measures/v2/SetWindowToWallRatioByFacade/");
+  boost::optional<BCLMeasure> measure = BCLMeasure::load(dir);
+  ASSERT_TRUE(measure);
+
+  openstudio::path measuresDir = openstudio::filesystem::system_complete(toPath("./UpdateMeasuresInDir/"));
+  if (exists(measuresDir)) {
+    ASSERT_TRUE(removeDirectory(measuresDir));
+  }
+  ASSERT_TRUE(measure->clone(measuresDir / toPath("Measure1")));
+  boost::optional<BCLMeasure> measure2 = measure->clone(measuresDir / toPath("Measure2"));
+  ASSERT_TRUE(measure2);
+
+  EXPECT_EQ(2u, BCLMeasure::getMeasuresInDir(measuresDir).size());
+  EXPECT_TRUE(BCLMeasure::updateMeasuresInDir(measuresDir).empty());
+
+  ASSERT_TRUE(measure2->primaryRubyScriptPath());
+  openstudio::filesystem::ofstream file(measure2->primaryRubyScriptPath().get());
+  ASSERT_TRUE(file.is_open());
+  file << "Hi";
+  file.close();
+
+  std::vector<BCLMeasure> updated = BCLMeasure::updateMeasuresInDir(measuresDir);
+  ASSERT_EQ(1u, updated.size());
+  EXPECT_EQ(measure2->directory(), updated[0].directory());
+  EXPECT_NE(measure2->versionId(), updated[0].versionId());
+  EXPECT_FALSE(updated[0].checkForUpdatesFiles());
+
+  ASSERT_TRUE(removeDirectory(measuresDir));
+}
+
 TEST_F(BCLFixture, BCLMeasure_CTor) {
   openstudio::path dir = openstudio::filesystem::system_complete(toPath("./TestMeasure/"));
   if (exists(dir)) {
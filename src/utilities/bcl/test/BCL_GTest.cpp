@@ -30,6 +30,7 @@
 #include <gtest/gtest.h>
 #include "BCLFixture.hpp"
 
+#include "../BCLMeasure.hpp"
 #include "../LocalBCL.hpp"
 #include "../RemoteBCL.hpp"
 #include "../../idd/IddFile.hpp"
@@ -37,6 +38,8 @@
 #include "../../idf/Workspace.hpp"
 #include "../../core/FilesystemHelpers.hpp"
 
+#include <limits>
+
 using namespace openstudio;
 
 TEST_F(BCLFixture, LocalBCL_AuthKey) {
@@ -48,6 +51,44 @@ TEST_F(BCLFixture, LocalBCL_AuthKey) {
   //EXPECT_EQ(defaultDevAuthKey, LocalBCL::instance().devAuthKey());
 }
 
+TEST_F(BCLFixture, LocalBCL_SearchMeasures) {
+  LocalBCL& bcl = LocalBCL::instance();
+  for (const std::string& dir : {"IncreaseRoofRValue", "IncreaseWallRValue", "SetEplusInfiltration"}) {
+    BCLMeasure measure(resourcesPath() / toPath("utilities/BCL/Measures/v3") / toPath(dir));
+    boost::optional<BCLMeasure> installed = measure.clone(bcl.libraryPath() / toPath(measure.uid()) / toPath(measure.versionId()));
+    ASSERT_TRUE(installed);
+    EXPECT_TRUE(bcl.addMeasure(*installed));
+  }
+
+  // words match as prefixes, best match first
+  std::vector<BCLMeasure> measures = bcl.searchMeasures("roof", "");
+  ASSERT_FALSE(measures.empty());
+  EXPECT_EQ("increase_insulation_r_value_for_roofs_by_percentage", measures[0].name());
+
+  EXPECT_EQ(2u, bcl.searchMeasures("Insulation", "").size());
+  EXPECT_EQ(1u, bcl.searchMeasures("infiltration flow", "").size());
+  EXPECT_EQ(3u, bcl.searchMeasures("", "").size());
+  EXPECT_TRUE(bcl.searchMeasures("not_a_measure", "").empty());
+
+  // pages
+  EXPECT_EQ(2u, bcl.numMeasureSearchResults("insulation"));
+  EXPECT_EQ(3u, bcl.numMeasureSearchResults(""));
+  std::vector<BCLMeasure> page0 = bcl.searchMeasures("insulation", "", 0, 1);
+  std::vector<BCLMeasure> page1 = bcl.searchMeasures("insulation", "", 1, 1);
+  ASSERT_EQ(1u, page0.size());
+  ASSERT_EQ(1u, page1.size());
+  EXPECT_NE(page0[0].uid(), page1[0].uid());
+  EXPECT_TRUE(bcl.searchMeasures("insulation", "", 2, 1).empty());
+  // page * resultsPerPage beyond the range of unsigned must not wrap around to an earlier page
+  EXPECT_TRUE(bcl.searchMeasures("", "", 1u << 31, 2).empty());
+  EXPECT_TRUE(bcl.searchMeasures("", "", std::numeric_limits<unsigned>::max(), std::numeric_limits<unsigned>::max()).empty());
+
+  // removed measures are no longer found
+  EXPECT_TRUE(bcl.removeMeasure(measures[0]));
+  EXPECT_EQ(1u, bcl.numMeasureSearchResults("insulation"));
+  EXPECT_EQ(0u, bcl.numMeasureSearchResults("roofs"));
+}
+
 TEST_F(BCLFixture, RemoteBCLTest) {
   RemoteBCL remoteBCL;
 
@@ -0,0 +1,176 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2021, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_CORE_CACHEDDYNAMICCAST_HPP
+#define UTILITIES_CORE_CACHEDDYNAMICCAST_HPP
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <typeinfo>
+
+namespace openstudio {
+
+namespace detail {
+
+  /** Remembers, for each dynamic type seen, whether a Base can be cast down to Derived. Whether
+   *  dynamic_cast succeeds only depends on the dynamic type of the object, so one dynamic_cast per
+   *  class answers the question for every later object of that class. Lookups are lock free. The
+   *  table starts small and doubles as classes are added, so pairs like <ModelObject_Impl,
+   *  IdfObject_Impl> which see every concrete impl class keep answering from the table while pairs
+   *  that only see one or two classes stay tiny. */
+  template <typename Derived, typename Base>
+  class DynamicCastCache
+  {
+   public:
+    static std::shared_ptr<Derived> cast(const std::shared_ptr<Base>& p) {
+      if (!p) {
+        return nullptr;
+      }
+
+      const std::type_info* type = &typeid(*p);
+      const Table* table = m_table.load(std::memory_order_acquire);
+      if (table) {
+        signed char result = table->find(type);
+        if (result > 0) {
+          return std::static_pointer_cast<Derived>(p);
+        } else if (result < 0) {
+          return nullptr;
+        }
+      }
+      return castAndRemember(p, type);
+    }
+
+   private:
+    struct Slot
+    {
+      std::atomic<const std::type_info*> type{nullptr};
+      std::atomic<signed char> result{0};
+    };
+
+    struct Table
+    {
+      explicit Table(size_t capacity) : mask(capacity - 1), slots(new Slot[capacity]) {}
+
+      static size_t hash(const std::type_info* type) {
+        return std::hash<const std::type_info*>()(type) >> 4;
+      }
+
+      // 1 if the cast succeeds, -1 if it fails, 0 if type is not in the table
+      signed char find(const std::type_info* type) const {
+        for (size_t i = hash(type);; ++i) {
+          const Slot& slot = slots[i & mask];
+          const std::type_info* slotType = slot.type.load(std::memory_order_acquire);
+          if (slotType == type) {
+            return slot.result.load(std::memory_order_relaxed);
+          } else if (slotType == nullptr) {
+            return 0;
+          }
+        }
+      }
+
+      // only called with the mutex held, result is stored before type is published
+      void insert(const std::type_info* type, signed char result) {
+        for (size_t i = hash(type);; ++i) {
+          Slot& slot = slots[i & mask];
+          if (slot.type.load(std::memory_order_relaxed) == nullptr) {
+            slot.result.store(result, std::memory_order_relaxed);
+            slot.type.store(type, std::memory_order_release);
+            ++size;
+            return;
+          }
+        }
+      }
+
+      const size_t mask;
+      const std::unique_ptr<Slot[]> slots;
+      size_t size = 0;
+    };
+
+    static std::shared_ptr<Derived> castAndRemember(const std::shared_ptr<Base>& p, const std::type_info* type) {
+      std::shared_ptr<Derived> result = std::dynamic_pointer_cast<Derived>(p);
+      const signed char answer = result ? 1 : -1;
+
+      std::lock_guard<std::mutex> lock(m_mutex);
+      Table* table = m_table.load(std::memory_order_relaxed);
+      if (table && (table->find(type) != 0)) {
+        // another thread added it first
+        return result;
+      }
+      if (!table || (2 * (table->size + 1) > table->mask + 1)) {
+        // keep the load at most one half so probe sequences stay short and always end at an empty slot,
+        // readers may still be walking the old table so it is never freed, all tables together are at
+        // most twice the size of the last one
+        auto grown = new Table(table ? 2 * (table->mask + 1) : 8);
+        if (table) {
+          for (size_t i = 0; i <= table->mask; ++i) {
+            const std::type_info* slotType = table->slots[i].type.load(std::memory_order_relaxed);
+            if (slotType) {
+              grown->insert(slotType, table->slots[i].result.load(std::memory_order_relaxed));
+            }
+          }
+        }
+        grown->insert(type, answer);
+        m_table.store(grown, std::memory_order_release);
+      } else {
+        table->insert(type, answer);
+      }
+      return result;
+    }
+
+    static std::atomic<Table*> m_table;
+    static std::mutex m_mutex;
+  };
+
+  template <typename Derived, typename Base>
+  std::atomic<typename DynamicCastCache<Derived, Base>::Table*> DynamicCastCache<Derived, Base>::m_table{nullptr};
+
+  template <typename Derived, typename Base>
+  std::mutex DynamicCastCache<Derived, Base>::m_mutex;
+
+}  // namespace detail
+
+/** Same result as std::dynamic_pointer_cast<Derived>(p), but only pays for the dynamic_cast once
+ *  per dynamic type of p when Derived is a class derived from Base. */
+template <typename Derived, typename Base>
+std::shared_ptr<Derived> cachedDynamicPointerCast(const std::shared_ptr<Base>& p) {
+  if constexpr (std::is_same_v<std::remove_cv_t<Derived>, std::remove_cv_t<Base>>) {
+    return p;
+  } else if constexpr (std::is_base_of_v<Base, Derived> && std::is_polymorphic_v<Base>) {
+    return detail::DynamicCastCache<Derived, Base>::cast(p);
+  } else {
+    return std::dynamic_pointer_cast<Derived>(p);
+  }
+}
+
+}  // namespace openstudio
+
+#endif  // UTILITIES_CORE_CACHEDDYNAMICCAST_HPP
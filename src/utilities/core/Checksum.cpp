@@ -28,8 +28,13 @@
 ***********************************************************************************************************************/
 
 #include "Checksum.hpp"
+#include "ParallelFor.hpp"
 
+#include <algorithm>
+#include <ctime>
+#include <mutex>
 #include <sstream>
+#include <unordered_map>
 
 #include <boost/crc.hpp>
 #include <fmt/format.h>
@@ -47,6 +52,22 @@ namespace detail {
 
     return result;
   }
+
+  struct ChecksumCacheEntry
+  {
+    boost::uintmax_t size;
+    std::time_t lastWriteTime;
+    std::time_t checksumTime;
+    std::string checksum;
+  };
+
+  // keyed by path string, entries are validated against file size and last write time on every lookup
+  std::mutex checksumCacheMutex;
+  std::unordered_map<std::string, ChecksumCacheEntry> checksumCache;
+
+  // last write time has one second resolution on some file systems, do not trust entries for files written
+  // at most this many seconds before they were read
+  constexpr std::time_t checksumRacyWindow = 2;
 }  // namespace detail
 
 /// return 8 character hex checksum of string
@@ -60,19 +81,13 @@ std::string checksum(std::string s) {
 /// return 8 character hex checksum of istream
 std::string checksum(std::istream& is) {
   boost::crc_32_type crc;
+  const std::streamsize n = 64 * 1024;
+  std::vector<char> buffer(n);
   do {
-    const std::streamsize n = 1024;
-    char buffer[n];
-    is.read(buffer, n);
-    std::streamsize readSize = is.gcount();
-    //crc.process_bytes(buffer, readSize);
-
-    size_t stringSize = static_cast<size_t>(readSize);
-    std::string str(buffer, stringSize);
-    str.erase(std::remove_if(str.begin(), str.end(), openstudio::detail::checksumIgnore), str.end());
-    stringSize = str.size();
-
-    crc.process_bytes(str.c_str(), stringSize);
+    is.read(buffer.data(), n);
+    auto readEnd = buffer.begin() + is.gcount();
+    readEnd = std::remove_if(buffer.begin(), readEnd, openstudio::detail::checksumIgnore);
+    crc.process_bytes(buffer.data(), static_cast<size_t>(readEnd - buffer.begin()));
   } while (is);
 
   return fmt::format("{:0>8X}", crc.checksum());
@@ -91,6 +106,42 @@ std::string checksum(const path& p) {
   return result;
 }
 
+std::string cachedChecksum(const path& p) {
+  boost::system::error_code ec;
+  boost::uintmax_t size = openstudio::filesystem::file_size(p, ec);
+  if (ec) {
+    // missing files and directories are not cached
+    return checksum(p);
+  }
+  std::time_t lastWriteTime = openstudio::filesystem::last_write_time(p, ec);
+  if (ec) {
+    return checksum(p);
+  }
+
+  std::string key = p.string();
+  {
+    std::lock_guard<std::mutex> lock(detail::checksumCacheMutex);
+    auto it = detail::checksumCache.find(key);
+    if ((it != detail::checksumCache.end()) && (it->second.size == size) && (it->second.lastWriteTime == lastWriteTime)
+        && (it->second.checksumTime - lastWriteTime > detail::checksumRacyWindow)) {
+      return it->second.checksum;
+    }
+  }
+
+  std::time_t checksumTime = std::time(nullptr);
+  std::string result = checksum(p);
+
+  std::lock_guard<std::mutex> lock(detail::checksumCacheMutex);
+  detail::checksumCache[key] = detail::ChecksumCacheEntry{size, lastWriteTime, checksumTime, result};
+  return result;
+}
+
+std::vector<std::string> cachedChecksums(const std::vector<path>& paths, unsigned numThreads) {
+  std::vector<std::string> result(paths.size());
+  parallelFor(paths.size(), numThreads, [&](size_t i) { result[i] = cachedChecksum(paths[i]); });
+  return result;
+}
+
 int crc16(const char* ptr, int count) {
   // Simulate CRC-CCITT
   boost::crc_basic<16> crc_ccitt1(0x1021, 0xFFFF, 0, false, false);
@@ -35,6 +35,7 @@
 
 #include <string>
 #include <ostream>
+#include <vector>
 
 namespace openstudio {
 
@@ -47,6 +48,14 @@ UTILITIES_API std::string checksum(std::istream& is);
 /// return 8 character hex checksum of file contents
 UTILITIES_API std::string checksum(const path& p);
 
+/// return 8 character hex checksum of file contents, reusing the result of an earlier call while the file size and
+/// last write time are unchanged. Files written within the last couple of seconds are always re-read since a second
+/// write in the same timestamp tick would otherwise go unnoticed.
+UTILITIES_API std::string cachedChecksum(const path& p);
+
+/// return cachedChecksum of each path, files are read on up to numThreads threads, 0 uses all hardware threads
+UTILITIES_API std::vector<std::string> cachedChecksums(const std::vector<path>& paths, unsigned numThreads = 0);
+
 /// returns the CRC-16 checksum of the first len bytes of data.  Replaces Qt implementation qChecksum.
 UTILITIES_API int crc16(const char* ptr, int count);
 
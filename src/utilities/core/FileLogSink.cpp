@@ -38,8 +38,10 @@ namespace openstudio {
 
 namespace detail {
 
-  FileLogSink_Impl::FileLogSink_Impl(const openstudio::path& path)
-    : m_path{path}, m_ofs{boost::shared_ptr<openstudio::filesystem::ofstream>(new openstudio::filesystem::ofstream(path))} {
+  FileLogSink_Impl::FileLogSink_Impl(const openstudio::path& path, bool asynchronous)
+    : LogSink_Impl(asynchronous),
+      m_path{path},
+      m_ofs{boost::shared_ptr<openstudio::filesystem::ofstream>(new openstudio::filesystem::ofstream(path))} {
     this->setStream(m_ofs);
     this->enable();
   }
@@ -56,6 +58,8 @@ namespace detail {
   }
 
   std::vector<LogMessage> FileLogSink_Impl::logMessages() const {
+    this->flush();
+
     openstudio::filesystem::ifstream ifs(m_path);
     std::string line;
     std::string text;
@@ -66,7 +70,8 @@ namespace detail {
   }
 }  // namespace detail
 
-FileLogSink::FileLogSink(const openstudio::path& path) : LogSink(boost::shared_ptr<detail::FileLogSink_Impl>(new detail::FileLogSink_Impl(path))) {
+FileLogSink::FileLogSink(const openstudio::path& path, bool asynchronous)
+  : LogSink(boost::shared_ptr<detail::FileLogSink_Impl>(new detail::FileLogSink_Impl(path, asynchronous))) {
   OS_ASSERT(getImpl<detail::FileLogSink_Impl>());
 }
 
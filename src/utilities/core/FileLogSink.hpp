@@ -42,7 +42,8 @@ class UTILITIES_API FileLogSink : public LogSink
  public:
   /// constructor takes path of file, opens in write mode positioned at file beginning
   /// and registers in the global logger
-  FileLogSink(const openstudio::path& path);
+  /// if asynchronous is true messages are queued and written to the file on a dedicated thread
+  FileLogSink(const openstudio::path& path, bool asynchronous = false);
 
   /// returns the path that log messages are written to
   openstudio::path path() const;
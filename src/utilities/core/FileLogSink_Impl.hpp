@@ -44,7 +44,7 @@ namespace detail {
    public:
     /// constructor takes path of file, opens in write mode positioned at file beginning
     /// and registers in the global logger
-    FileLogSink_Impl(const openstudio::path& path);
+    FileLogSink_Impl(const openstudio::path& path, bool asynchronous);
 
     /// destructor, does not disable log sink
     virtual ~FileLogSink_Impl();
@@ -66,6 +66,9 @@ typedef std::string LogChannel;
 /// Type of stream sink used
 typedef boost::log::sinks::synchronous_sink<boost::log::sinks::text_ostream_backend> LogSinkBackend;
 
+/// Common base of the synchronous and asynchronous sinks, this is what is registered in the logging core
+typedef boost::log::sinks::sink LogSinkFrontend;
+
 /// Type of logger used
 typedef boost::log::sources::severity_channel_logger_mt<LogLevel> LoggerType;
 
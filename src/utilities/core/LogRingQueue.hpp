@@ -0,0 +1,155 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2021, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_CORE_LOGRINGQUEUE_HPP
+#define UTILITIES_CORE_LOGRINGQUEUE_HPP
+
+#include <boost/log/core/record_view.hpp>
+#include <boost/lockfree/queue.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace openstudio {
+
+namespace detail {
+
+  /** Queueing strategy for boost::log::sinks::asynchronous_sink backed by a fixed size lock-free ring buffer.
+   *
+   *  Logging threads push records without taking a lock, if the ring is full they yield until the feeding
+   *  thread has made room so no message is ever dropped. The feeding thread only sleeps on a condition
+   *  variable when the ring is empty. */
+  class LogRingQueue
+  {
+   public:
+    /// number of records the ring holds before logging threads have to wait
+    static constexpr std::size_t capacity = 8192;
+
+   protected:
+    LogRingQueue() = default;
+
+    template <typename ArgsT>
+    explicit LogRingQueue(ArgsT const&) {}
+
+    ~LogRingQueue() {
+      boost::log::record_view rec;
+      while (try_dequeue(rec)) {
+      }
+    }
+
+    /// enqueues a record, waits for space if the ring is full
+    void enqueue(boost::log::record_view const& rec) {
+      auto* p = new boost::log::record_view(rec);
+      while (!m_ring.bounded_push(p)) {
+        std::this_thread::yield();
+      }
+      notifyConsumer();
+    }
+
+    /// attempts to enqueue a record, fails if the ring is full
+    bool try_enqueue(boost::log::record_view const& rec) {
+      auto* p = new boost::log::record_view(rec);
+      if (!m_ring.bounded_push(p)) {
+        delete p;
+        return false;
+      }
+      notifyConsumer();
+      return true;
+    }
+
+    /// attempts to dequeue a record ready for processing, does not block
+    bool try_dequeue_ready(boost::log::record_view& rec) {
+      return try_dequeue(rec);
+    }
+
+    /// attempts to dequeue a record, does not block
+    bool try_dequeue(boost::log::record_view& rec) {
+      boost::log::record_view* p = nullptr;
+      if (!m_ring.pop(p)) {
+        return false;
+      }
+      rec.swap(*p);
+      delete p;
+      return true;
+    }
+
+    /// dequeues a record, blocks while the ring is empty, returns false if interrupted
+    bool dequeue_ready(boost::log::record_view& rec) {
+      while (true) {
+        if (try_dequeue(rec)) {
+          return true;
+        }
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (m_interrupted) {
+          m_interrupted = false;
+          return false;
+        }
+        // publish that we are about to sleep before checking the ring one last time, producers check
+        // the flag after pushing so one of the two sides always sees the other
+        m_consumerWaiting.store(true);
+        if (!m_ring.empty()) {
+          m_consumerWaiting.store(false);
+          continue;
+        }
+        m_condition.wait_for(lock, std::chrono::milliseconds(100));
+        m_consumerWaiting.store(false);
+      }
+    }
+
+    /// wakes the feeding thread if it is blocked in dequeue_ready
+    void interrupt_dequeue() {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_interrupted = true;
+      m_condition.notify_one();
+    }
+
+   private:
+    void notifyConsumer() {
+      if (m_consumerWaiting.load()) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_condition.notify_one();
+      }
+    }
+
+    boost::lockfree::queue<boost::log::record_view*, boost::lockfree::capacity<capacity>> m_ring;
+    std::atomic<bool> m_consumerWaiting{false};
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    bool m_interrupted = false;
+  };
+
+}  // namespace detail
+
+}  // namespace openstudio
+
+#endif  // UTILITIES_CORE_LOGRINGQUEUE_HPP
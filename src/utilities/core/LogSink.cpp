@@ -43,20 +43,46 @@ namespace openstudio {
 
 namespace detail {
 
-  LogSink_Impl::LogSink_Impl() : m_mutex{}, m_threadId{}, m_sink{boost::shared_ptr<LogSinkBackend>(new LogSinkBackend())} {}
+  LogSink_Impl::LogSink_Impl(bool asynchronous) : m_mutex{}, m_threadId{} {
+    if (asynchronous) {
+      m_asyncSink = boost::shared_ptr<AsyncLogSinkBackend>(new AsyncLogSinkBackend());
+    } else {
+      m_sink = boost::shared_ptr<LogSinkBackend>(new LogSinkBackend());
+    }
+    setLogSinkFilter(this->sink().get(), Trace, boost::none);
+  }
+
+  LogSink_Impl::~LogSink_Impl() {
+    // a sink left enabled keeps logging after its wrapper is gone, otherwise stop the feeding thread
+    bool stillEnabled = releaseLogSinkFilter(this->sink().get());
+    if (m_asyncSink && !stillEnabled) {
+      m_asyncSink->stop();
+      m_asyncSink->flush();
+    }
+  }
 
-  LogSink_Impl::~LogSink_Impl() {}
+  template <typename Function>
+  void LogSink_Impl::withFrontend(Function f) const {
+    if (m_asyncSink) {
+      f(*m_asyncSink);
+    } else {
+      f(*m_sink);
+    }
+  }
 
   bool LogSink_Impl::isEnabled() const {
-    return Logger::instance().findSink(m_sink);
+    return Logger::instance().findSink(this->sink());
   }
 
   void LogSink_Impl::enable() {
-    Logger::instance().addSink(m_sink);
+    Logger::instance().addSink(this->sink());
   }
 
   void LogSink_Impl::disable() {
-    Logger::instance().removeSink(m_sink);
+    Logger::instance().removeSink(this->sink());
+
+    // write out anything still queued
+    this->flush();
   }
 
   boost::optional<LogLevel> LogSink_Impl::logLevel() const {
@@ -119,7 +145,7 @@ namespace detail {
 
     m_autoFlush = autoFlush;
 
-    m_sink->locked_backend()->auto_flush(autoFlush);
+    withFrontend([autoFlush](auto& frontend) { frontend.locked_backend()->auto_flush(autoFlush); });
   }
 
   std::thread::id LogSink_Impl::threadId() const {
@@ -144,17 +170,27 @@ namespace detail {
     this->updateFilter(l);
   }
 
+  bool LogSink_Impl::isAsynchronous() const {
+    return static_cast<bool>(m_asyncSink);
+  }
+
+  void LogSink_Impl::flush() const {
+    withFrontend([](auto& frontend) { frontend.flush(); });
+  }
+
   void LogSink_Impl::setStream(boost::shared_ptr<std::ostream> os) {
     std::unique_lock l{m_mutex};
 
-    m_sink->locked_backend()->add_stream(os);
+    withFrontend([&os](auto& frontend) {
+      frontend.locked_backend()->add_stream(os);
 
-    // set formatting, seems like you have to call this after the stream is added
-    // DLM@20110701: would like to format Severity as string but can't figure out how to do it
-    // because you can't overload operator<< for an enum type
-    // this seems to suggest this should work: http://www.edm2.com/0405/enumeration.html
-    m_sink->set_formatter(expr::stream << "[" << expr::attr<LogChannel>("Channel") << "] <" << expr::attr<LogLevel>("Severity") << "> "
-                                       << expr::smessage);
+      // set formatting, seems like you have to call this after the stream is added
+      // DLM@20110701: would like to format Severity as string but can't figure out how to do it
+      // because you can't overload operator<< for an enum type
+      // this seems to suggest this should work: http://www.edm2.com/0405/enumeration.html
+      frontend.set_formatter(expr::stream << "[" << expr::attr<LogChannel>("Channel") << "] <" << expr::attr<LogLevel>("Severity") << "> "
+                                          << expr::smessage);
+    });
 
     //m_sink->locked_backend()->set_formatter(fmt::stream
     //  << "[" << fmt::attr< LogChannel >("Channel")
@@ -169,14 +205,15 @@ namespace detail {
     this->setAutoFlush(true);
   }
 
-  boost::shared_ptr<LogSinkBackend> LogSink_Impl::sink() const {
-    std::shared_lock l{m_mutex};
-
+  boost::shared_ptr<LogSinkFrontend> LogSink_Impl::sink() const {
+    if (m_asyncSink) {
+      return m_asyncSink;
+    }
     return m_sink;
   }
 
   void LogSink_Impl::updateFilter(const std::unique_lock<std::shared_mutex>& l) {
-    m_sink->reset_filter();
+    withFrontend([](auto& frontend) { frontend.reset_filter(); });
 
     LogLevel filterLogLevel = Trace;
     if (m_logLevel) {
@@ -188,12 +225,16 @@ namespace detail {
       filterChannelRegex = *m_channelRegex;
     }
 
-    if (m_threadId != std::thread::id{}) {
-      m_sink->set_filter(expr::attr<LogLevel>("Severity") >= filterLogLevel && expr::attr<std::thread::id>("ThreadId") == m_threadId
-                         && expr::matches(expr::attr<LogChannel>("Channel"), filterChannelRegex));
-    } else {
-      m_sink->set_filter(expr::attr<LogLevel>("Severity") >= filterLogLevel && expr::matches(expr::attr<LogChannel>("Channel"), filterChannelRegex));
-    }
+    withFrontend([&](auto& frontend) {
+      if (m_threadId != std::thread::id{}) {
+        frontend.set_filter(expr::attr<LogLevel>("Severity") >= filterLogLevel && expr::attr<std::thread::id>("ThreadId") == m_threadId
+                            && expr::matches(expr::attr<LogChannel>("Channel"), filterChannelRegex));
+      } else {
+        frontend.set_filter(expr::attr<LogLevel>("Severity") >= filterLogLevel && expr::matches(expr::attr<LogChannel>("Channel"), filterChannelRegex));
+      }
+    });
+
+    setLogSinkFilter(this->sink().get(), filterLogLevel, m_channelRegex);
   }
 
 }  // namespace detail
@@ -262,11 +303,19 @@ void LogSink::resetThreadId() {
   m_impl->resetThreadId();
 }
 
+bool LogSink::isAsynchronous() const {
+  return m_impl->isAsynchronous();
+}
+
+void LogSink::flush() const {
+  m_impl->flush();
+}
+
 void LogSink::setStream(boost::shared_ptr<std::ostream> os) {
   m_impl->setStream(os);
 }
 
-boost::shared_ptr<LogSinkBackend> LogSink::sink() const {
+boost::shared_ptr<LogSinkFrontend> LogSink::sink() const {
   return m_impl->sink();
 }
 
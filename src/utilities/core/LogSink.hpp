@@ -95,6 +95,12 @@ class UTILITIES_API LogSink
   /// reset the thread id that messages are filtered by
   void resetThreadId();
 
+  /// are messages formatted and written on a dedicated thread
+  bool isAsynchronous() const;
+
+  /// block until all messages logged so far have been written, only needed for asynchronous sinks
+  void flush() const;
+
  protected:
   friend class LoggerSingleton;
 
@@ -108,7 +114,7 @@ class UTILITIES_API LogSink
   void setStream(boost::shared_ptr<std::ostream> os);
 
   // for adding cout and cerr sinks to logger
-  boost::shared_ptr<LogSinkBackend> sink() const;
+  boost::shared_ptr<LogSinkFrontend> sink() const;
 
   // get the impl
   template <typename T>
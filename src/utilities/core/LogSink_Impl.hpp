@@ -34,7 +34,9 @@
 
 #include "LogMessage.hpp"
 #include "LogSink.hpp"
+#include "LogRingQueue.hpp"
 
+#include <boost/log/sinks/async_frontend.hpp>
 #include <boost/optional.hpp>
 
 #include <shared_mutex>
@@ -43,6 +45,18 @@ namespace openstudio {
 
 namespace detail {
 
+  /// Type of asynchronous stream sink, records are queued in a lock-free ring and written on a dedicated thread
+  typedef boost::log::sinks::asynchronous_sink<boost::log::sinks::text_ostream_backend, LogRingQueue> AsyncLogSinkBackend;
+
+  /// keeps the level and channel filters of sinks so logLevelEnabled can be answered without consulting boost::log
+  UTILITIES_API void setLogSinkFilter(const LogSinkFrontend* sink, LogLevel logLevel, const boost::optional<boost::regex>& channelRegex);
+
+  /// marks a sink as registered or not in the logging core
+  UTILITIES_API void setLogSinkEnabled(const LogSinkFrontend* sink, bool enabled);
+
+  /// forgets a sink unless it is still registered in the logging core, returns true if it is still registered
+  UTILITIES_API bool releaseLogSinkFilter(const LogSinkFrontend* sink);
+
   /// LogSink is a class for managing sinks for log messages, e.g. files, streams, etc.
   class UTILITIES_API LogSink_Impl
   {
@@ -95,28 +109,39 @@ namespace detail {
     /// reset the thread id that messages are filtered by
     void resetThreadId();
 
+    /// are messages formatted and written on a dedicated thread
+    bool isAsynchronous() const;
+
+    /// block until all messages logged so far have been written
+    void flush() const;
+
    protected:
     friend class openstudio::LogSink;
 
     // does not register in the global logger
-    LogSink_Impl();
+    LogSink_Impl(bool asynchronous = false);
 
     // must be set in the constructor
     void setStream(boost::shared_ptr<std::ostream> os);
 
     // for adding cout and cerr sinks to logger
-    boost::shared_ptr<LogSinkBackend> sink() const;
+    boost::shared_ptr<LogSinkFrontend> sink() const;
 
     mutable std::shared_mutex m_mutex;
 
    private:
     void updateFilter(const std::unique_lock<std::shared_mutex>& l);
 
+    // calls f with whichever of the synchronous or asynchronous frontends this sink uses
+    template <typename Function>
+    void withFrontend(Function f) const;
+
     boost::optional<LogLevel> m_logLevel;
     boost::optional<boost::regex> m_channelRegex;
     bool m_autoFlush = false;
     std::thread::id m_threadId;
     boost::shared_ptr<LogSinkBackend> m_sink;
+    boost::shared_ptr<AsyncLogSinkBackend> m_asyncSink;
   };
 
 }  // namespace detail
@@ -28,22 +28,141 @@
 ***********************************************************************************************************************/
 
 #include "Logger.hpp"
+#include "LogSink_Impl.hpp"
 
 #include <boost/log/common.hpp>
 #include <boost/log/attributes/function.hpp>
 
 #include <boost/core/null_deleter.hpp>
 
+#include <algorithm>
+#include <atomic>
+
 namespace sinks = boost::log::sinks;
 namespace keywords = boost::log::keywords;
 
 namespace openstudio {
 
+namespace detail {
+
+  /// Mirror of the level and channel filters of all sinks, answers whether any enabled sink would accept a message.
+  /// The lowest level accepted by any enabled sink is kept in an atomic so most rejected messages never take a lock,
+  /// the per channel answer is cached until a sink is enabled, disabled or has its filter changed.
+  class LogLevelGate
+  {
+   public:
+    bool isEnabled(LogLevel level, const std::string& channel) {
+      if (level < m_minLogLevel.load(std::memory_order_relaxed)) {
+        return false;
+      }
+
+      {
+        std::shared_lock l{m_mutex};
+        auto it = m_channelLogLevels.find(channel);
+        if (it != m_channelLogLevels.end()) {
+          return level >= it->second;
+        }
+      }
+
+      std::unique_lock l{m_mutex};
+      int channelLogLevel = noSinkLogLevel;
+      for (const auto& sinkFilter : m_sinkFilters) {
+        const SinkFilter& filter = sinkFilter.second;
+        if (filter.enabled && (!filter.channelRegex || boost::regex_match(channel, *filter.channelRegex))) {
+          channelLogLevel = std::min(channelLogLevel, static_cast<int>(filter.logLevel));
+        }
+      }
+      m_channelLogLevels[channel] = channelLogLevel;
+      return level >= channelLogLevel;
+    }
+
+    void setFilter(const LogSinkFrontend* sink, LogLevel logLevel, const boost::optional<boost::regex>& channelRegex) {
+      std::unique_lock l{m_mutex};
+      SinkFilter& filter = m_sinkFilters[sink];
+      filter.logLevel = logLevel;
+      filter.channelRegex = channelRegex;
+      update(l);
+    }
+
+    void setEnabled(const LogSinkFrontend* sink, bool enabled) {
+      std::unique_lock l{m_mutex};
+      m_sinkFilters[sink].enabled = enabled;
+      update(l);
+    }
+
+    bool release(const LogSinkFrontend* sink) {
+      std::unique_lock l{m_mutex};
+      auto it = m_sinkFilters.find(sink);
+      if (it == m_sinkFilters.end()) {
+        return false;
+      }
+      if (it->second.enabled) {
+        return true;
+      }
+      m_sinkFilters.erase(it);
+      update(l);
+      return false;
+    }
+
+   private:
+    // one above Fatal, nothing is logged
+    static constexpr int noSinkLogLevel = Fatal + 1;
+
+    struct SinkFilter
+    {
+      LogLevel logLevel = Trace;
+      boost::optional<boost::regex> channelRegex;
+      bool enabled = false;
+    };
+
+    void update(const std::unique_lock<std::shared_mutex>&) {
+      int minLogLevel = noSinkLogLevel;
+      for (const auto& sinkFilter : m_sinkFilters) {
+        if (sinkFilter.second.enabled) {
+          minLogLevel = std::min(minLogLevel, static_cast<int>(sinkFilter.second.logLevel));
+        }
+      }
+      m_minLogLevel.store(minLogLevel, std::memory_order_relaxed);
+      m_channelLogLevels.clear();
+    }
+
+    std::shared_mutex m_mutex;
+    std::atomic<int> m_minLogLevel{Trace};
+    std::map<const LogSinkFrontend*, SinkFilter> m_sinkFilters;
+    std::map<std::string, int> m_channelLogLevels;
+  };
+
+  // never destroyed so that logging during static destruction stays safe
+  LogLevelGate& logLevelGate() {
+    static auto* gate = new LogLevelGate();
+    return *gate;
+  }
+
+  void setLogSinkFilter(const LogSinkFrontend* sink, LogLevel logLevel, const boost::optional<boost::regex>& channelRegex) {
+    logLevelGate().setFilter(sink, logLevel, channelRegex);
+  }
+
+  void setLogSinkEnabled(const LogSinkFrontend* sink, bool enabled) {
+    logLevelGate().setEnabled(sink, enabled);
+  }
+
+  bool releaseLogSinkFilter(const LogSinkFrontend* sink) {
+    return logLevelGate().release(sink);
+  }
+
+}  // namespace detail
+
 /// convenience function for SWIG, prefer macros in C++
 void logFree(LogLevel level, const std::string& channel, const std::string& message) {
   BOOST_LOG_SEV(openstudio::Logger::instance().loggerFromChannel(channel), level) << message;
 }
 
+bool logLevelEnabled(LogLevel level, const std::string& channel) {
+  // the logger registers the standard out sink on construction, that has to happen before the first check
+  Logger::instance();
+  return detail::logLevelGate().isEnabled(level, channel);
+}
+
 LoggerSingleton::LoggerSingleton() {
   // Make current thread id attribute available to logging
   boost::log::core::get()->add_global_attribute("ThreadId", boost::log::attributes::make_function(&std::this_thread::get_id));
@@ -101,7 +220,7 @@ LoggerType& LoggerSingleton::loggerFromChannel(const LogChannel& logChannel) {
   return it->second;
 }
 
-bool LoggerSingleton::findSink(boost::shared_ptr<LogSinkBackend> sink) {
+bool LoggerSingleton::findSink(boost::shared_ptr<LogSinkFrontend> sink) {
   std::unique_lock l{m_mutex};
 
   auto it = m_sinks.find(sink);
@@ -109,7 +228,7 @@ bool LoggerSingleton::findSink(boost::shared_ptr<LogSinkBackend> sink) {
   return (it != m_sinks.end());
 }
 
-void LoggerSingleton::addSink(boost::shared_ptr<LogSinkBackend> sink) {
+void LoggerSingleton::addSink(boost::shared_ptr<LogSinkFrontend> sink) {
   std::shared_lock l{m_mutex};
 
   auto it = m_sinks.find(sink);
@@ -124,10 +243,12 @@ void LoggerSingleton::addSink(boost::shared_ptr<LogSinkBackend> sink) {
 
     // Register the sink in the logging core
     boost::log::core::get()->add_sink(sink);
+
+    detail::setLogSinkEnabled(sink.get(), true);
   }
 }
 
-void LoggerSingleton::removeSink(boost::shared_ptr<LogSinkBackend> sink) {
+void LoggerSingleton::removeSink(boost::shared_ptr<LogSinkFrontend> sink) {
   std::shared_lock l{m_mutex};
 
   auto it = m_sinks.find(sink);
@@ -142,6 +263,8 @@ void LoggerSingleton::removeSink(boost::shared_ptr<LogSinkBackend> sink) {
 
     // Register the sink in the logging core
     boost::log::core::get()->remove_sink(sink);
+
+    detail::setLogSinkEnabled(sink.get(), false);
   }
 }
 
@@ -56,12 +56,16 @@
 /// log a message from within a registered class and throw an exception
 #define LOG_AND_THROW(__message__) LOG_FREE_AND_THROW(logChannel(), __message__);
 
-/// log a message from outside a registered class
-#define LOG_FREE(__level__, __channel__, __message__)        \
-  {                                                          \
-    std::stringstream _ss1;                                  \
-    _ss1 << __message__;                                     \
-    openstudio::logFree(__level__, __channel__, _ss1.str()); \
+/// log a message from outside a registered class, the message is only formatted if a sink accepts the level and channel
+#define LOG_FREE(__level__, __channel__, __message__)      \
+  {                                                        \
+    const ::LogLevel _level1 = __level__;                  \
+    const openstudio::LogChannel _channel1 = __channel__;  \
+    if (openstudio::logLevelEnabled(_level1, _channel1)) { \
+      std::stringstream _ss1;                              \
+      _ss1 << __message__;                                 \
+      openstudio::logFree(_level1, _channel1, _ss1.str()); \
+    }                                                      \
   }
 
 /// log a message from outside a registered class and throw an exception
@@ -78,6 +82,10 @@ namespace openstudio {
 /// convenience function for SWIG, prefer macros in C++
 UTILITIES_API void logFree(LogLevel level, const std::string& channel, const std::string& message);
 
+/// returns false if no enabled sink accepts messages at this level on this channel, LOG uses this to skip formatting
+/// the check is conservative, sinks filtered by thread id are assumed to accept messages from every thread
+UTILITIES_API bool logLevelEnabled(LogLevel level, const std::string& channel);
+
 /** Singleton logger class.  Singleton Logger object maintains logging state throughout
    *   program execution.
    */
@@ -104,13 +112,13 @@ class UTILITIES_API LoggerSingleton
   friend class detail::LogSink_Impl;
 
   /// is the sink found in the logging core
-  bool findSink(boost::shared_ptr<LogSinkBackend> sink);
+  bool findSink(boost::shared_ptr<LogSinkFrontend> sink);
 
   /// adds a sink to the logging core, equivalent to logSink.enable()
-  void addSink(boost::shared_ptr<LogSinkBackend> sink);
+  void addSink(boost::shared_ptr<LogSinkFrontend> sink);
 
   /// removes a sink to the logging core, equivalent to logSink.disable()
-  void removeSink(boost::shared_ptr<LogSinkBackend> sink);
+  void removeSink(boost::shared_ptr<LogSinkFrontend> sink);
 
  private:
   /// private constructor
@@ -129,7 +137,7 @@ class UTILITIES_API LoggerSingleton
   LoggerMapType m_loggerMap;
 
   /// current sinks, kept here so don't destruct when LogSink wrapper goes out of scope
-  typedef std::set<boost::shared_ptr<LogSinkBackend>> SinkSetType;
+  typedef std::set<boost::shared_ptr<LogSinkFrontend>> SinkSetType;
   SinkSetType m_sinks;
 };
 
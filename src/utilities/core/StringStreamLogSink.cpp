@@ -36,7 +36,7 @@ namespace openstudio {
 
 namespace detail {
 
-  StringStreamLogSink_Impl::StringStreamLogSink_Impl() : m_stringstream(new std::stringstream) {
+  StringStreamLogSink_Impl::StringStreamLogSink_Impl(bool asynchronous) : LogSink_Impl(asynchronous), m_stringstream(new std::stringstream) {
     this->setStream(m_stringstream);
     this->enable();
   }
@@ -49,6 +49,8 @@ namespace detail {
   }
 
   std::string StringStreamLogSink_Impl::string() const {
+    this->flush();
+
     std::shared_lock l{m_mutex};
 
     return m_stringstream->str();
@@ -59,6 +61,9 @@ namespace detail {
   }
 
   void StringStreamLogSink_Impl::resetStringStream() {
+    // messages logged before the reset must not show up after it
+    this->flush();
+
     std::unique_lock l{m_mutex};
 
     m_stringstream->str("");
@@ -66,7 +71,8 @@ namespace detail {
 
 }  // namespace detail
 
-StringStreamLogSink::StringStreamLogSink() : LogSink(boost::shared_ptr<detail::StringStreamLogSink_Impl>(new detail::StringStreamLogSink_Impl())) {
+StringStreamLogSink::StringStreamLogSink(bool asynchronous)
+  : LogSink(boost::shared_ptr<detail::StringStreamLogSink_Impl>(new detail::StringStreamLogSink_Impl(asynchronous))) {
   OS_ASSERT(getImpl<detail::StringStreamLogSink_Impl>());
 }
 
@@ -40,7 +40,8 @@ class UTILITIES_API StringStreamLogSink : public LogSink
 {
  public:
   /// constructor makes a new string stream to write to and registers in the global logger
-  StringStreamLogSink();
+  /// if asynchronous is true messages are queued and written to the stream on a dedicated thread
+  explicit StringStreamLogSink(bool asynchronous = false);
 
   /// get the string stream's content
   std::string string() const;
@@ -42,7 +42,7 @@ namespace detail {
   {
    public:
     /// constructor makes a new string stream to write to and registers in the global logger
-    StringStreamLogSink_Impl();
+    StringStreamLogSink_Impl(bool asynchronous);
 
     /// destructor, disables log sink
     virtual ~StringStreamLogSink_Impl();
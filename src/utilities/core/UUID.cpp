@@ -115,11 +115,13 @@ bool operator>(const UUID& lhs, const UUID& rhs) {
 }
 
 std::string toString(const UUID& uuid) {
-  std::stringstream ss;
-  ss << '{';
-  boost::uuids::operator<<(ss, uuid);
-  ss << '}';
-  return ss.str();
+  // every cloned object writes its new handle, avoid a stringstream per call
+  std::string result;
+  result.reserve(38);
+  result.push_back('{');
+  result.append(boost::uuids::to_string(uuid));
+  result.push_back('}');
+  return result;
 }
 
 std::string createUniqueName(const std::string& prefix) {
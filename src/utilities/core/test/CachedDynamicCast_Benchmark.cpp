@@ -0,0 +1,65 @@
+#include <benchmark/benchmark.h>
+
+#include "../CachedDynamicCast.hpp"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+using namespace openstudio;
+
+struct Base
+{
+  virtual ~Base() = default;
+};
+
+struct Middle : public Base
+{
+};
+
+// stands in for the concrete impl classes of a model, far more of them than a small fixed table holds
+template <int N>
+struct Concrete : public Middle
+{
+};
+
+template <int... N>
+std::vector<std::shared_ptr<Base>> makeObjects(std::integer_sequence<int, N...>) {
+  return {std::make_shared<Concrete<N>>()...};
+}
+
+static std::vector<std::shared_ptr<Base>> objects(size_t n) {
+  std::vector<std::shared_ptr<Base>> types = makeObjects(std::make_integer_sequence<int, 256>());
+  std::vector<std::shared_ptr<Base>> result;
+  result.reserve(n);
+  for (size_t i = 0; i < n; ++i) {
+    result.push_back(types[(i * 7) % types.size()]);
+  }
+  return result;
+}
+
+static void BM_DynamicPointerCast(benchmark::State& state) {
+  std::vector<std::shared_ptr<Base>> input = objects(4096);
+
+  for (auto _ : state) {
+    for (const auto& object : input) {
+      benchmark::DoNotOptimize(std::dynamic_pointer_cast<Middle>(object));
+      benchmark::DoNotOptimize(std::dynamic_pointer_cast<Concrete<7>>(object));
+    }
+  }
+}
+
+static void BM_CachedDynamicPointerCast(benchmark::State& state) {
+  std::vector<std::shared_ptr<Base>> input = objects(4096);
+
+  for (auto _ : state) {
+    for (const auto& object : input) {
+      benchmark::DoNotOptimize(cachedDynamicPointerCast<Middle>(object));
+      benchmark::DoNotOptimize(cachedDynamicPointerCast<Concrete<7>>(object));
+    }
+  }
+}
+
+// 4096 objects of 256 concrete types, each cast to a base class and to one concrete class
+BENCHMARK(BM_DynamicPointerCast);
+BENCHMARK(BM_CachedDynamicPointerCast);
@@ -0,0 +1,150 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2021, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "../CachedDynamicCast.hpp"
+
+#include <thread>
+#include <utility>
+#include <vector>
+
+using openstudio::cachedDynamicPointerCast;
+
+namespace {
+
+struct Base
+{
+  virtual ~Base() = default;
+};
+
+struct Middle : public Base
+{
+};
+
+struct Leaf : public Middle
+{
+};
+
+struct Other : public Base
+{
+};
+
+struct Unrelated
+{
+  virtual ~Unrelated() = default;
+};
+
+struct Mixed
+  : public Other
+  , public Unrelated
+{
+};
+
+template <int N>
+struct Numbered : public Middle
+{
+};
+
+template <int... N>
+std::vector<std::shared_ptr<Base>> makeNumbered(std::integer_sequence<int, N...>) {
+  return {std::make_shared<Numbered<N>>()...};
+}
+
+}  // namespace
+
+TEST(CachedDynamicCast, MatchesDynamicCast) {
+  std::vector<std::shared_ptr<Base>> objects{std::make_shared<Base>(), std::make_shared<Middle>(), std::make_shared<Leaf>(),
+                                             std::make_shared<Other>(), std::make_shared<Mixed>(), nullptr};
+
+  // twice, so the second pass is answered from the cache
+  for (int pass = 0; pass < 2; ++pass) {
+    for (const auto& object : objects) {
+      EXPECT_EQ(std::dynamic_pointer_cast<Middle>(object), cachedDynamicPointerCast<Middle>(object));
+      EXPECT_EQ(std::dynamic_pointer_cast<Leaf>(object), cachedDynamicPointerCast<Leaf>(object));
+      EXPECT_EQ(std::dynamic_pointer_cast<Other>(object), cachedDynamicPointerCast<Other>(object));
+      EXPECT_EQ(std::dynamic_pointer_cast<const Other>(object), cachedDynamicPointerCast<const Other>(object));
+      EXPECT_EQ(std::dynamic_pointer_cast<Mixed>(object), cachedDynamicPointerCast<Mixed>(object));
+      EXPECT_EQ(std::dynamic_pointer_cast<Unrelated>(object), cachedDynamicPointerCast<Unrelated>(object));
+      EXPECT_EQ(object, cachedDynamicPointerCast<Base>(object));
+    }
+  }
+}
+
+TEST(CachedDynamicCast, Concurrent) {
+  std::vector<std::shared_ptr<Base>> objects;
+  for (int i = 0; i < 1000; ++i) {
+    objects.push_back(i % 2 ? std::shared_ptr<Base>(std::make_shared<Leaf>()) : std::shared_ptr<Base>(std::make_shared<Other>()));
+  }
+
+  std::vector<int> numLeaves(4, 0);
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < numLeaves.size(); ++t) {
+    threads.emplace_back([&objects, &numLeaves, t]() {
+      for (const auto& object : objects) {
+        if (cachedDynamicPointerCast<Middle>(object)) {
+          ++numLeaves[t];
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(std::vector<int>(numLeaves.size(), 500), numLeaves);
+}
+
+TEST(CachedDynamicCast, ManyTypes) {
+  // enough dynamic types that the table has to grow several times, while other threads are reading it
+  std::vector<std::shared_ptr<Base>> objects = makeNumbered(std::make_integer_sequence<int, 100>());
+  objects.push_back(std::make_shared<Other>());
+  objects.push_back(std::make_shared<Base>());
+
+  std::vector<int> numMismatches(4, 0);
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < numMismatches.size(); ++t) {
+    threads.emplace_back([&objects, &numMismatches, t]() {
+      for (int pass = 0; pass < 2; ++pass) {
+        for (size_t i = 0; i < objects.size(); ++i) {
+          const auto& object = objects[(i + 25 * t) % objects.size()];
+          if (std::dynamic_pointer_cast<Middle>(object) != cachedDynamicPointerCast<Middle>(object)) {
+            ++numMismatches[t];
+          }
+          if (std::dynamic_pointer_cast<Numbered<7>>(object) != cachedDynamicPointerCast<Numbered<7>>(object)) {
+            ++numMismatches[t];
+          }
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(std::vector<int>(numMismatches.size(), 0), numMismatches);
+}
@@ -35,6 +35,8 @@
 
 #include <resources.hxx>
 
+#include <ctime>
+
 TEST(Checksum, Strings) {
   EXPECT_EQ("00000000", openstudio::checksum(std::string("")));
 
@@ -97,6 +99,77 @@ TEST(Checksum, Paths) {
   EXPECT_EQ("00000000", openstudio::checksum(p));
 }
 
+TEST(Checksum, CachedPaths) {
+  openstudio::path p = resourcesPath() / openstudio::toPath("utilities/Checksum/Checksum.txt");
+  openstudio::path p2 = resourcesPath() / openstudio::toPath("utilities/Checksum/Checksum2.txt");
+  openstudio::path dir = resourcesPath() / openstudio::toPath("utilities/Checksum/");
+  openstudio::path missing = resourcesPath() / openstudio::toPath("utilities/Checksum/NotAFile.txt");
+
+  // cached results match uncached results, twice to hit the cache
+  for (unsigned i = 0; i < 2; ++i) {
+    EXPECT_EQ("1AD514BA", openstudio::cachedChecksum(p));
+    EXPECT_EQ("17B88D3A", openstudio::cachedChecksum(p2));
+    EXPECT_EQ("00000000", openstudio::cachedChecksum(dir));
+    EXPECT_EQ("00000000", openstudio::cachedChecksum(missing));
+  }
+
+  std::vector<std::string> checksums = openstudio::cachedChecksums({p, p2, dir, missing, p}, 2);
+  ASSERT_EQ(5u, checksums.size());
+  EXPECT_EQ("1AD514BA", checksums[0]);
+  EXPECT_EQ("17B88D3A", checksums[1]);
+  EXPECT_EQ("00000000", checksums[2]);
+  EXPECT_EQ("00000000", checksums[3]);
+  EXPECT_EQ("1AD514BA", checksums[4]);
+}
+
+TEST(Checksum, CachedPathsModified) {
+  openstudio::path p = openstudio::tempDir() / openstudio::toPath("CachedChecksum.txt");
+  openstudio::filesystem::remove(p);
+
+  {
+    openstudio::filesystem::ofstream ofs(p, std::ios_base::binary);
+    ofs << "Hi there";
+  }
+  std::time_t oldTime = std::time(nullptr) - 60;
+  openstudio::filesystem::last_write_time(p, oldTime);
+  EXPECT_EQ("1AD514BA", openstudio::cachedChecksum(p));
+  EXPECT_EQ("1AD514BA", openstudio::cachedChecksum(p));
+
+  // same size, new last write time
+  {
+    openstudio::filesystem::ofstream ofs(p, std::ios_base::binary);
+    ofs << "HI there";
+  }
+  openstudio::filesystem::last_write_time(p, oldTime + 1);
+  EXPECT_EQ("D5682D26", openstudio::cachedChecksum(p));
+
+  // new size
+  {
+    openstudio::filesystem::ofstream ofs(p, std::ios_base::binary);
+    ofs << "Hithere";
+  }
+  openstudio::filesystem::last_write_time(p, oldTime + 1);
+  EXPECT_EQ("597EA479", openstudio::cachedChecksum(p));
+
+  // recently written files are re-read even if size and last write time did not change
+  {
+    openstudio::filesystem::ofstream ofs(p, std::ios_base::binary);
+    ofs << "Hi there";
+  }
+  std::time_t newTime = std::time(nullptr);
+  openstudio::filesystem::last_write_time(p, newTime);
+  EXPECT_EQ("1AD514BA", openstudio::cachedChecksum(p));
+  {
+    openstudio::filesystem::ofstream ofs(p, std::ios_base::binary);
+    ofs << "HI there";
+  }
+  openstudio::filesystem::last_write_time(p, newTime);
+  EXPECT_EQ("D5682D26", openstudio::cachedChecksum(p));
+
+  openstudio::filesystem::remove(p);
+  EXPECT_EQ("00000000", openstudio::cachedChecksum(p));
+}
+
 TEST(Checksum, UUIDs) {
   openstudio::StringVector checksums;
   for (unsigned i = 0, n = 1000; i < n; ++i) {
@@ -34,6 +34,8 @@
 #include "../StringStreamLogSink.hpp"
 
 #include <sstream>
+#include <thread>
+#include <vector>
 
 using openstudio::toPath;
 using openstudio::Logger;
@@ -340,4 +342,104 @@ TEST(LoggerTest, file_logger_disable) {
 
   EXPECT_NO_THROW(openstudio::filesystem::remove(path));
 }
+
+int formattedCount = 0;
+
+std::string countFormatting(const std::string& message) {
+  ++formattedCount;
+  return message;
+}
+
+TEST(LoggerTest, level_gate) {
+  openstudio::Logger::instance().standardOutLogger().disable();
+
+  StringStreamLogSink sink;
+  sink.setLogLevel(Info);
+  sink.setChannelRegex(boost::regex("hello\\..*"));
+
+  EXPECT_FALSE(openstudio::logLevelEnabled(Debug, "hello.channel"));
+  EXPECT_TRUE(openstudio::logLevelEnabled(Info, "hello.channel"));
+  EXPECT_FALSE(openstudio::logLevelEnabled(Fatal, "goodbye.channel"));
+
+  // messages no sink accepts are never formatted
+  formattedCount = 0;
+  LOG_FREE(Debug, "hello.channel", countFormatting("Hello Debug"));
+  LOG_FREE(Error, "goodbye.channel", countFormatting("Goodbye Error"));
+  EXPECT_EQ(0, formattedCount);
+  LOG_FREE(Info, "hello.channel", countFormatting("Hello Info"));
+  EXPECT_EQ(1, formattedCount);
+  ASSERT_EQ(1u, sink.logMessages().size());
+  EXPECT_EQ("Hello Info", sink.logMessages()[0].logMessage());
+
+  // changing the filter takes effect immediately
+  sink.setLogLevel(Trace);
+  sink.resetChannelRegex();
+  EXPECT_TRUE(openstudio::logLevelEnabled(Trace, "goodbye.channel"));
+
+  sink.disable();
+  EXPECT_FALSE(openstudio::logLevelEnabled(Debug, "goodbye.channel"));
+}
+
+TEST(LoggerTest, async_string_stream_logger) {
+  openstudio::Logger::instance().standardOutLogger().disable();
+
+  StringStreamLogSink sink(true);
+  EXPECT_TRUE(sink.isAsynchronous());
+  sink.setChannelRegex(boost::regex("async\\..*"));
+
+  const unsigned numThreads = 4;
+  const unsigned numMessages = 5000;
+  std::vector<std::thread> threads;
+  for (unsigned t = 0; t < numThreads; ++t) {
+    threads.emplace_back([t]() {
+      for (unsigned i = 0; i < numMessages; ++i) {
+        LOG_FREE(Info, "async.channel" + std::to_string(t), i);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  // every message arrives, in order for each thread
+  std::vector<LogMessage> logMessages = sink.logMessages();
+  ASSERT_EQ(numThreads * numMessages, logMessages.size());
+  std::vector<unsigned> next(numThreads, 0);
+  for (const auto& logMessage : logMessages) {
+    unsigned t = std::stoul(logMessage.logChannel().substr(std::string("async.channel").size()));
+    ASSERT_LT(t, numThreads);
+    EXPECT_EQ(std::to_string(next[t]), logMessage.logMessage());
+    ++next[t];
+  }
+
+  sink.resetStringStream();
+  EXPECT_TRUE(sink.logMessages().empty());
+}
+
+TEST(LoggerTest, async_file_logger) {
+  openstudio::Logger::instance().standardOutLogger().disable();
+
+  openstudio::path path = toPath("./async_file_logger.log");
+  openstudio::filesystem::remove(path);
+
+  {
+    FileLogSink sink(path, true);
+    EXPECT_TRUE(sink.isAsynchronous());
+    sink.setLogLevel(Error);
+    sink.setChannelRegex(boost::regex("hello\\..*"));
+
+    freeLogging();
+    classLogging();
+
+    sink.disable();
+
+    std::vector<LogMessage> logMessages = sink.logMessages();
+    ASSERT_EQ(1u, logMessages.size());
+    EXPECT_EQ(Error, logMessages[0].logLevel());
+    EXPECT_EQ("hello.channel", logMessages[0].logChannel());
+    EXPECT_EQ("Hello Error", logMessages[0].logMessage());
+  }
+
+  EXPECT_NO_THROW(openstudio::filesystem::remove(path));
+}
 }  // namespace
@@ -37,26 +37,166 @@
 #include "../data/Vector.hpp"
 #include "../time/DateTime.hpp"
 
+#include <charconv>
 #include <iostream>
+#include <stdexcept>
+#include <string_view>
 
 #include <boost/regex.hpp>
 
 namespace openstudio {
 namespace detail {
 
-  CSVFile_Impl::CSVFile_Impl() : m_numColumns(0) {}
+  namespace {
 
-  CSVFile_Impl::CSVFile_Impl(const std::string& s) {
+    // integers are [-0-9]+, same as the previous regex based parser
+    bool isIntegerText(std::string_view text) {
+      if (text.empty()) {
+        return false;
+      }
+      for (char c : text) {
+        if (c != '-' && (c < '0' || c > '9')) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    // doubles are [+-]?\d+\.?\d*, there is no exponent
+    bool isDoubleText(std::string_view text) {
+      size_t i = 0;
+      const size_t n = text.size();
+      if (i < n && (text[i] == '+' || text[i] == '-')) {
+        ++i;
+      }
+      const size_t firstDigit = i;
+      while (i < n && text[i] >= '0' && text[i] <= '9') {
+        ++i;
+      }
+      if (i == firstDigit) {
+        return false;
+      }
+      if (i < n && text[i] == '.') {
+        ++i;
+      }
+      while (i < n && text[i] >= '0' && text[i] <= '9') {
+        ++i;
+      }
+      return i == n;
+    }
+
+    // same results and exceptions as std::stoi, text must pass isIntegerText
+    int parseInteger(std::string_view text) {
+      int result = 0;
+      auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), result);
+      if (ec == std::errc::invalid_argument) {
+        throw std::invalid_argument("Cannot convert '" + std::string(text) + "' to an integer");
+      } else if (ec == std::errc::result_out_of_range) {
+        throw std::out_of_range("Integer '" + std::string(text) + "' is out of range");
+      }
+      return result;
+    }
+
+    // same results and exceptions as std::stod, text must pass isDoubleText
+    double parseDouble(std::string_view text) {
+      if (!text.empty() && text[0] == '+') {
+        text.remove_prefix(1);
+      }
+#if defined(__cpp_lib_to_chars)
+      double result = 0.0;
+      auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), result);
+      if (ec == std::errc::result_out_of_range) {
+        throw std::out_of_range("Double '" + std::string(text) + "' is out of range");
+      }
+      return result;
+#else
+      return std::stod(std::string(text));
+#endif
+    }
+
+    // splits a line at commas outside of double quotes, quotes are kept. An unbalanced quote runs to the end of the line.
+    template <typename F>
+    void splitCSVLine(std::string_view line, F&& f) {
+      unsigned index = 0;
+      size_t fieldStart = 0;
+      bool inQuotes = false;
+      for (size_t i = 0; i < line.size(); ++i) {
+        if (line[i] == '"') {
+          inQuotes = !inQuotes;
+        } else if (line[i] == ',' && !inQuotes) {
+          f(index++, line.substr(fieldStart, i - fieldStart));
+          fieldStart = i + 1;
+        }
+      }
+      f(index, line.substr(fieldStart));
+    }
+
+  }  // namespace
+
+  size_t CSVFile_Impl::Column::size() const {
+    return types.size();
+  }
+
+  void CSVFile_Impl::Column::push_back(const Variant& value) {
+    switch (value.variantType().value()) {
+      case VariantType::Boolean:
+        pushNumber(CellType::Boolean, value.valueAsBoolean() ? 1.0 : 0.0);
+        break;
+      case VariantType::Double:
+        pushNumber(CellType::Double, value.valueAsDouble());
+        break;
+      case VariantType::Integer:
+        pushNumber(CellType::Integer, value.valueAsInteger());
+        break;
+      default:
+        pushString(value.valueAsString());
+        break;
+    }
+  }
+
+  void CSVFile_Impl::Column::pushNumber(CellType type, double value) {
+    types.push_back(type);
+    numbers.push_back(value);
+    if (numStrings > 0) {
+      strings.emplace_back();
+    }
+  }
+
+  void CSVFile_Impl::Column::pushString(std::string value) {
+    if (numStrings == 0) {
+      strings.resize(types.size());
+    }
+    types.push_back(CellType::String);
+    numbers.push_back(0.0);
+    strings.push_back(std::move(value));
+    ++numStrings;
+  }
+
+  Variant CSVFile_Impl::Column::value(size_t row) const {
+    switch (types[row]) {
+      case CellType::Boolean:
+        return Variant(numbers[row] != 0.0);
+      case CellType::Double:
+        return Variant(numbers[row]);
+      case CellType::Integer:
+        return Variant(static_cast<int>(numbers[row]));
+      default:
+        return Variant(strings[row]);
+    }
+  }
+
+  CSVFile_Impl::CSVFile_Impl() : m_numRows(0) {}
+
+  CSVFile_Impl::CSVFile_Impl(const std::string& s) : m_numRows(0) {
     std::istringstream ss(s);
 
     // will throw on error
-    m_rows = parseRows(ss);
-
-    assignNumColumns();
-    padRows();
+    parseRows(ss, 0, std::vector<unsigned>());
   }
 
-  CSVFile_Impl::CSVFile_Impl(const openstudio::path& p) {
+  CSVFile_Impl::CSVFile_Impl(const openstudio::path& p) : CSVFile_Impl(p, 0, std::vector<unsigned>()) {}
+
+  CSVFile_Impl::CSVFile_Impl(const openstudio::path& p, unsigned rowsToSkip, const std::vector<unsigned>& columnIndices) : m_numRows(0) {
     if (!boost::filesystem::exists(p) || !boost::filesystem::is_regular_file(p)) {
       LOG_AND_THROW("Path '" << p << "' is not a CSVFile file");
     }
@@ -65,11 +205,9 @@ namespace detail {
     std::ifstream ifs(openstudio::toSystemFilename(p));
 
     // will throw on error
-    m_rows = parseRows(ifs);
+    parseRows(ifs, rowsToSkip, columnIndices);
 
     m_path = p;
-    assignNumColumns();
-    padRows();
   }
 
   CSVFile CSVFile_Impl::clone() const {
@@ -84,32 +222,32 @@ namespace detail {
   std::string CSVFile_Impl::string() const {
     static const boost::regex escapeItRegex(",");
 
-    std::string s;
     std::stringstream result;
-    for (const auto& row : m_rows) {
-      OS_ASSERT(row.size() == m_numColumns);
-      for (size_t i = 0; i < m_numColumns; ++i) {
-
-        switch (row[i].variantType().value()) {
-          case VariantType::Integer:
-            result << row[i].valueAsInteger();
+    const size_t numColumns = m_columns.size();
+    for (unsigned row = 0; row < m_numRows; ++row) {
+      for (size_t i = 0; i < numColumns; ++i) {
+        const Column& column = m_columns[i];
+        OS_ASSERT(column.size() == m_numRows);
+
+        switch (column.types[row]) {
+          case CellType::Integer:
+            result << static_cast<int>(column.numbers[row]);
             break;
-          case VariantType::Double:
-            result << row[i].valueAsDouble();
+          case CellType::Double:
+            result << column.numbers[row];
             break;
-          case VariantType::String:
-            s = row[i].valueAsString();
-            if (boost::regex_match(s, escapeItRegex)) {
-              result << "\"" << s << "\"";
+          case CellType::String:
+            if (boost::regex_match(column.strings[row], escapeItRegex)) {
+              result << "\"" << column.strings[row] << "\"";
             } else {
-              result << s;
+              result << column.strings[row];
             }
             break;
           default:
             break;
         }
 
-        if (i < m_numColumns - 1) {
+        if (i < numColumns - 1) {
           result << ",";
         }
       }
@@ -164,124 +302,102 @@ namespace detail {
   }
 
   unsigned CSVFile_Impl::numColumns() const {
-    return m_numColumns;
+    return m_columns.size();
   }
 
   unsigned CSVFile_Impl::numRows() const {
-    return m_rows.size();
+    return m_numRows;
   }
 
   std::vector<std::vector<Variant>> CSVFile_Impl::rows() const {
-    return m_rows;
+    std::vector<std::vector<Variant>> result(m_numRows);
+    for (unsigned row = 0; row < m_numRows; ++row) {
+      result[row].reserve(m_columns.size());
+      for (const auto& column : m_columns) {
+        result[row].push_back(column.value(row));
+      }
+    }
+    return result;
   }
 
   void CSVFile_Impl::addRow(const std::vector<Variant>& row) {
-    m_rows.push_back(row);
-    if (row.size() > m_numColumns) {
-      m_numColumns = row.size();
-      padRows();
-    }
-
-    while (m_rows[m_rows.size() - 1].size() < m_numColumns) {
-      m_rows[m_rows.size() - 1].push_back(Variant(""));
+    ensureNumColumns(row.size());
+    for (size_t i = 0; i < row.size(); ++i) {
+      m_columns[i].push_back(row[i]);
     }
+    ++m_numRows;
+    padColumns();
   }
 
   void CSVFile_Impl::setRows(const std::vector<std::vector<Variant>>& rows) {
-    m_rows = rows;
-    assignNumColumns();
+    m_columns.clear();
+    m_numRows = 0;
+    for (const auto& row : rows) {
+      addRow(row);
+    }
   }
 
   void CSVFile_Impl::clear() {
-    m_rows.clear();
+    m_columns.clear();
     m_path.reset();
-    m_numColumns = 0;
+    m_numRows = 0;
   }
 
   unsigned CSVFile_Impl::addColumn(const std::vector<DateTime>& dateTimes) {
-    unsigned n = dateTimes.size();
-    ensureNumRows(n);
-
-    unsigned numRows = m_rows.size();
-    for (unsigned i = 0; i < numRows; ++i) {
-      if (i < n) {
-        m_rows[i].push_back(Variant(dateTimes[i].toISO8601()));
-      } else {
-        m_rows[i].push_back(Variant(""));
-      }
+    std::vector<std::string> values;
+    values.reserve(dateTimes.size());
+    for (const auto& dateTime : dateTimes) {
+      values.push_back(dateTime.toISO8601());
     }
-
-    ++m_numColumns;
-    return m_numColumns;
+    return addColumn(values);
   }
 
   unsigned CSVFile_Impl::addColumn(const Vector& values) {
-    unsigned n = values.size();
-    ensureNumRows(n);
-
-    unsigned numRows = m_rows.size();
-    for (unsigned i = 0; i < numRows; ++i) {
-      if (i < n) {
-        m_rows[i].push_back(Variant(values[i]));
-      } else {
-        m_rows[i].push_back(Variant(""));
-      }
-    }
-
-    ++m_numColumns;
-    return m_numColumns;
+    return addColumn(std::vector<double>(values.begin(), values.end()));
   }
 
   unsigned CSVFile_Impl::addColumn(const std::vector<double>& values) {
-    unsigned n = values.size();
-    ensureNumRows(n);
+    ensureNumRows(values.size());
 
-    unsigned numRows = m_rows.size();
-    for (unsigned i = 0; i < numRows; ++i) {
-      if (i < n) {
-        m_rows[i].push_back(Variant(values[i]));
-      } else {
-        m_rows[i].push_back(Variant(""));
-      }
+    Column column;
+    for (double value : values) {
+      column.pushNumber(CellType::Double, value);
     }
+    m_columns.push_back(std::move(column));
+    padColumns();
 
-    ++m_numColumns;
-    return m_numColumns;
+    return m_columns.size();
   }
 
   unsigned CSVFile_Impl::addColumn(const std::vector<std::string>& values) {
-    unsigned n = values.size();
-    ensureNumRows(n);
+    ensureNumRows(values.size());
 
-    unsigned numRows = m_rows.size();
-    for (unsigned i = 0; i < numRows; ++i) {
-      if (i < n) {
-        m_rows[i].push_back(Variant(values[i]));
-      } else {
-        m_rows[i].push_back(Variant(""));
-      }
+    Column column;
+    for (const auto& value : values) {
+      column.pushString(value);
     }
+    m_columns.push_back(std::move(column));
+    padColumns();
 
-    ++m_numColumns;
-    return m_numColumns;
+    return m_columns.size();
   }
 
   std::vector<DateTime> CSVFile_Impl::getColumnAsDateTimes(unsigned columnIndex) const {
-    if (columnIndex >= m_numColumns) {
-      LOG(Warn, "Column index " << columnIndex << " invalid for number of columns " << m_numColumns);
+    if (columnIndex >= m_columns.size()) {
+      LOG(Warn, "Column index " << columnIndex << " invalid for number of columns " << m_columns.size());
       return std::vector<DateTime>();
     }
 
     std::vector<DateTime> result;
 
-    unsigned numRows = m_rows.size();
-    for (unsigned i = 0; i < numRows; ++i) {
-      if (m_rows[i][columnIndex].variantType() != VariantType::String) {
+    const Column& column = m_columns[columnIndex];
+    for (unsigned i = 0; i < m_numRows; ++i) {
+      if (column.types[i] != CellType::String) {
         LOG(Warn, "Value at row " << i << " and column " << columnIndex << " is not a DateTime string");
         return std::vector<DateTime>();
       }
 
-      boost::optional<DateTime> dateTime = DateTime::fromISO8601(m_rows[i][columnIndex].valueAsString());
+      boost::optional<DateTime> dateTime = DateTime::fromISO8601(column.strings[i]);
       if (!dateTime) {
         LOG(Warn, "Value at row " << i << " and column " << columnIndex << " is not a DateTime string");
         return std::vector<DateTime>();
@@ -293,53 +409,42 @@ namespace detail {
   }
 
   std::vector<double> CSVFile_Impl::getColumnAsDoubleVector(unsigned columnIndex) const {
-    if (columnIndex >= m_numColumns) {
-      LOG(Warn, "Column index " << columnIndex << " invalid for number of columns " << m_numColumns);
+    if (columnIndex >= m_columns.size()) {
+      LOG(Warn, "Column index " << columnIndex << " invalid for number of columns " << m_columns.size());
       return std::vector<double>();
     }
 
-    std::vector<double> result;
-
-    unsigned numRows = m_rows.size();
-    for (unsigned i = 0; i < numRows; ++i) {
-
-      boost::optional<double> value;
-      if (m_rows[i][columnIndex].variantType() == VariantType::Double) {
-        value = m_rows[i][columnIndex].valueAsDouble();
-      } else if (m_rows[i][columnIndex].variantType() == VariantType::Integer) {
-        value = m_rows[i][columnIndex].valueAsInteger();
-      }
-
-      if (!value) {
+    const Column& column = m_columns[columnIndex];
+    for (unsigned i = 0; i < m_numRows; ++i) {
+      if (column.types[i] != CellType::Double && column.types[i] != CellType::Integer) {
         LOG(Warn, "Value at row " << i << " and column " << columnIndex << " is not a numeric value");
         return std::vector<double>();
       }
-      result.push_back(*value);
     }
 
-    return result;
+    return column.numbers;
   }
 
   std::vector<std::string> CSVFile_Impl::getColumnAsStringVector(unsigned columnIndex) const {
-    if (columnIndex >= m_numColumns) {
-      LOG(Warn, "Column index " << columnIndex << " invalid for number of columns " << m_numColumns);
+    if (columnIndex >= m_columns.size()) {
+      LOG(Warn, "Column index " << columnIndex << " invalid for number of columns " << m_columns.size());
       return std::vector<std::string>();
     }
 
     std::vector<std::string> result;
 
-    unsigned numRows = m_rows.size();
-    for (unsigned i = 0; i < numRows; ++i) {
+    const Column& column = m_columns[columnIndex];
+    for (unsigned i = 0; i < m_numRows; ++i) {
 
-      if (m_rows[i][columnIndex].variantType() == VariantType::String) {
-        result.push_back(m_rows[i][columnIndex].valueAsString());
-      } else if (m_rows[i][columnIndex].variantType() == VariantType::Double) {
+      if (column.types[i] == CellType::String) {
+        result.push_back(column.strings[i]);
+      } else if (column.types[i] == CellType::Double) {
         std::stringstream ss;
-        ss << m_rows[i][columnIndex].valueAsDouble();
+        ss << column.numbers[i];
         result.push_back(ss.str());
-      } else if (m_rows[i][columnIndex].variantType() == VariantType::Integer) {
+      } else if (column.types[i] == CellType::Integer) {
         std::stringstream ss;
-        ss << m_rows[i][columnIndex].valueAsInteger();
+        ss << static_cast<int>(column.numbers[i]);
         result.push_back(ss.str());
       }
     }
@@ -348,68 +453,103 @@ namespace detail {
   }
 
   // throws on error
-  std::vector<std::vector<Variant>> CSVFile_Impl::parseRows(std::istream& input) {
-    std::vector<std::vector<Variant>> result;
-
+  void CSVFile_Impl::parseRows(std::istream& input, unsigned rowsToSkip, const std::vector<unsigned>& columnIndices) {
     // DLM: what conditions should make this throw?
 
-    // Excel formated CSV regex, \A[^,"]*(?=,)|(?:[^",]*"[^"]*"[^",]*)+|[^",]*"[^"]*\Z|(?<=,)[^,]*(?=,)|(?<=,)[^,]*\Z|\A[^,]*\Z
-    static const boost::regex csvRegex(
-      "\\A[^,\"]*(?=,)|(?:[^\",]*\"[^\"]*\"[^\",]*)+|[^\",]*\"[^\"]*\\Z|(?<=,)[^,]*(?=,)|(?<=,)[^,]*\\Z|\\A[^,]*\\Z");
-    static const boost::regex intRegex("^[-0-9]+$");
-    static const boost::regex doubleRegex("^[+-]?\\d+\\.?(\\d+)?$");
-    static const boost::regex quoteRegex("^\"(.*)\"$");
-
-    std::string line;
-    while (std::getline(input, line)) {
-      std::vector<Variant> row;
-      boost::regex_token_iterator<std::string::iterator> it{line.begin(), line.end(), csvRegex, 0};
-      boost::regex_token_iterator<std::string::iterator> end;
-      while (it != end) {
-        std::string value = *it;
-        if (boost::regex_match(value, intRegex)) {
-          row.push_back(Variant(std::stoi(value)));
-        } else if (boost::regex_match(value, doubleRegex)) {
-          row.push_back(Variant(std::stod(value)));
-        } else {
-          boost::smatch valueMatch;
-          if (boost::regex_search(value, valueMatch, quoteRegex)) {
-            row.push_back(Variant(valueMatch[1]));
-          } else {
-            row.push_back(Variant(value));
-          }
-        }
-        ++it;
+    // read everything at once, lines and fields are then views into this buffer
+    std::string contents;
+    {
+      std::ostringstream ss;
+      ss << input.rdbuf();
+      contents = ss.str();
+    }
+
+    // column in this file for each column in the input, -1 if the input column is not read
+    std::vector<int> targetColumns;
+    for (size_t i = 0; i < columnIndices.size(); ++i) {
+      if (columnIndices[i] >= targetColumns.size()) {
+        targetColumns.resize(columnIndices[i] + 1, -1);
+      }
+      if (targetColumns[columnIndices[i]] < 0) {
+        targetColumns[columnIndices[i]] = static_cast<int>(i);
       }
-      result.push_back(row);
     }
+    ensureNumColumns(columnIndices.size());
+
+    auto addCell = [this](unsigned columnIndex, std::string_view value) {
+      ensureNumColumns(columnIndex + 1);
+      Column& column = m_columns[columnIndex];
+      if (isIntegerText(value)) {
+        column.pushNumber(CellType::Integer, parseInteger(value));
+      } else if (isDoubleText(value)) {
+        column.pushNumber(CellType::Double, parseDouble(value));
+      } else if (value.size() >= 2 && value.front() == '"' && value.back() == '"') {
+        column.pushString(std::string(value.substr(1, value.size() - 2)));
+      } else {
+        column.pushString(std::string(value));
+      }
+    };
+
+    std::string_view remaining(contents);
+    unsigned lineNumber = 0;
+    while (!remaining.empty()) {
+      // same lines as std::getline, a final newline does not start another line
+      size_t lineEnd = remaining.find('\n');
+      std::string_view line = remaining.substr(0, lineEnd);
+      remaining.remove_prefix(lineEnd == std::string_view::npos ? remaining.size() : lineEnd + 1);
+
+      if (lineNumber++ < rowsToSkip) {
+        continue;
+      }
 
-    return result;
-  }
+      // windows line endings
+      if (!line.empty() && line.back() == '\r') {
+        line.remove_suffix(1);
+      }
+
+      if (columnIndices.empty()) {
+        splitCSVLine(line, addCell);
+      } else {
+        splitCSVLine(line, [&](unsigned index, std::string_view value) {
+          if (index < targetColumns.size() && targetColumns[index] >= 0) {
+            addCell(targetColumns[index], value);
+          }
+        });
+      }
 
-  void CSVFile_Impl::assignNumColumns() {
-    m_numColumns = 0;
-    for (const auto& row : m_rows) {
-      m_numColumns = std::max<unsigned>(m_numColumns, row.size());
+      ++m_numRows;
+      padColumns();
+    }
+
+    // columns repeated in columnIndices are copies of the first one
+    for (size_t i = 0; i < columnIndices.size(); ++i) {
+      int target = targetColumns[columnIndices[i]];
+      if (target != static_cast<int>(i)) {
+        m_columns[i] = m_columns[target];
+      }
     }
   }
 
   void CSVFile_Impl::ensureNumRows(unsigned numRows) {
     // add empty cells to existing columns if needed
-    if (numRows > m_rows.size()) {
-      unsigned numRowsToAdd = numRows - m_rows.size();
-      std::vector<Variant> blankRow(m_numColumns, Variant(""));
-      for (unsigned i = 0; i < numRowsToAdd; ++i) {
-        m_rows.push_back(blankRow);
-      }
+    if (numRows > m_numRows) {
+      m_numRows = numRows;
+      padColumns();
+    }
+  }
+
+  void CSVFile_Impl::ensureNumColumns(unsigned numColumns) {
+    // new columns are empty for existing rows
+    while (m_columns.size() < numColumns) {
+      m_columns.emplace_back();
+      padColumns();
     }
-    OS_ASSERT(m_rows.size() >= numRows);
   }
 
-  void CSVFile_Impl::padRows() {
-    for (auto& row : m_rows) {
-      while (row.size() < m_numColumns) {
-        row.push_back(Variant(""));
+  void CSVFile_Impl::padColumns() {
+    for (auto& column : m_columns) {
+      while (column.size() < m_numRows) {
+        column.pushString("");
       }
     }
   }
@@ -422,6 +562,9 @@ CSVFile::CSVFile(const std::string& s) : m_impl(std::shared_ptr<detail::CSVFile_
 
 CSVFile::CSVFile(const openstudio::path& p) : m_impl(std::shared_ptr<detail::CSVFile_Impl>(new detail::CSVFile_Impl(p))) {}
 
+CSVFile::CSVFile(const openstudio::path& p, unsigned rowsToSkip, const std::vector<unsigned>& columnIndices)
+  : m_impl(std::shared_ptr<detail::CSVFile_Impl>(new detail::CSVFile_Impl(p, rowsToSkip, columnIndices))) {}
+
 CSVFile::CSVFile(std::shared_ptr<detail::CSVFile_Impl> impl) : m_impl(impl) {}
 
 CSVFile CSVFile::clone() const {
@@ -446,6 +589,15 @@ boost::optional<CSVFile> CSVFile::load(const openstudio::path& p) {
   return result;
 }
 
+boost::optional<CSVFile> CSVFile::load(const openstudio::path& p, unsigned rowsToSkip, const std::vector<unsigned>& columnIndices) {
+  boost::optional<CSVFile> result;
+  try {
+    result = CSVFile(p, rowsToSkip, columnIndices);
+  } catch (const std::exception&) {
+  }
+  return result;
+}
+
 std::string CSVFile::string() const {
   return getImpl<detail::CSVFile_Impl>()->string();
 }
@@ -59,6 +59,11 @@ class UTILITIES_API CSVFile
   /** Constructor with path, will throw if path does not exist or file is incorrect. */
   CSVFile(const openstudio::path& p);
 
+  /** Constructor with path that skips rowsToSkip rows at the top of the file and only reads the columns in columnIndices
+   *  (first column is index 0), all columns are read if columnIndices is empty. The columns read become columns 0, 1, ...
+   *  of this CSVFile in the order given. Will throw if path does not exist or file is incorrect. */
+  CSVFile(const openstudio::path& p, unsigned rowsToSkip, const std::vector<unsigned>& columnIndices = std::vector<unsigned>());
+
   /** Clones this CSVFile into a separate one. */
   CSVFile clone() const;
 
@@ -68,6 +73,10 @@ class UTILITIES_API CSVFile
   /** Attempt to load a CSVFile from path */
   static boost::optional<CSVFile> load(const openstudio::path& p);
 
+  /** Attempt to load some of the rows and columns of a CSVFile from path, see the matching constructor */
+  static boost::optional<CSVFile> load(const openstudio::path& p, unsigned rowsToSkip,
+                                       const std::vector<unsigned>& columnIndices = std::vector<unsigned>());
+
   /** Get the CSVFile as a string. */
   std::string string() const;
 
@@ -36,6 +36,9 @@
 #include "../core/Path.hpp"
 #include "../data/Vector.hpp"
 
+#include <string>
+#include <vector>
+
 namespace openstudio {
 
 class CSVFile;
@@ -53,6 +56,8 @@ namespace detail {
 
     CSVFile_Impl(const openstudio::path& p);
 
+    CSVFile_Impl(const openstudio::path& p, unsigned rowsToSkip, const std::vector<unsigned>& columnIndices);
+
     CSVFile clone() const;
 
     std::string string() const;
@@ -104,18 +109,41 @@ namespace detail {
    private:
     REGISTER_LOGGER("openstudio.CSVFile");
 
-    // throws on error
-    static std::vector<std::vector<Variant>> parseRows(std::istream& input);
-
-    void assignNumColumns();
+    enum class CellType : unsigned char
+    {
+      Boolean,
+      Double,
+      Integer,
+      String
+    };
+
+    // cells of one column, numbers are stored contiguously and strings are only allocated once the column has a string cell
+    struct Column
+    {
+      std::vector<CellType> types;
+      std::vector<double> numbers;
+      std::vector<std::string> strings;
+      size_t numStrings = 0;
+
+      size_t size() const;
+      void push_back(const Variant& value);
+      void pushNumber(CellType type, double value);
+      void pushString(std::string value);
+      Variant value(size_t row) const;
+    };
+
+    // throws on error, rows are appended to m_columns
+    void parseRows(std::istream& input, unsigned rowsToSkip, const std::vector<unsigned>& columnIndices);
 
     void ensureNumRows(unsigned numRows);
 
-    void padRows();
+    void ensureNumColumns(unsigned numColumns);
+
+    void padColumns();
 
     boost::optional<openstudio::path> m_path;
-    unsigned m_numColumns;
-    std::vector<std::vector<Variant>> m_rows;
+    unsigned m_numRows;
+    std::vector<Column> m_columns;
   };
 
 }  // namespace detail
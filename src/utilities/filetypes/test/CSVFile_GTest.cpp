@@ -296,3 +296,59 @@ TEST(Filetypes, CSVFile_AddAndGetColumn) {
   EXPECT_EQ("2.2", getCol4[1]);
   EXPECT_EQ("0.33", getCol4[2]);
 }
+
+TEST(Filetypes, CSVFile_Parse) {
+  CSVFile csvFile(std::string("Name,\"A, quoted\",-5\r\n+1.5,2.,3\r\n\"x\"\r\n"));
+  ASSERT_EQ(3u, csvFile.numRows());
+  ASSERT_EQ(3u, csvFile.numColumns());
+  auto rows = csvFile.rows();
+
+  ASSERT_EQ(VariantType::String, rows[0][0].variantType().value());
+  EXPECT_EQ("Name", rows[0][0].valueAsString());
+  ASSERT_EQ(VariantType::String, rows[0][1].variantType().value());
+  EXPECT_EQ("A, quoted", rows[0][1].valueAsString());
+  ASSERT_EQ(VariantType::Integer, rows[0][2].variantType().value());
+  EXPECT_EQ(-5, rows[0][2].valueAsInteger());
+
+  ASSERT_EQ(VariantType::Double, rows[1][0].variantType().value());
+  EXPECT_EQ(1.5, rows[1][0].valueAsDouble());
+  ASSERT_EQ(VariantType::Double, rows[1][1].variantType().value());
+  EXPECT_EQ(2.0, rows[1][1].valueAsDouble());
+  ASSERT_EQ(VariantType::Integer, rows[1][2].variantType().value());
+  EXPECT_EQ(3, rows[1][2].valueAsInteger());
+
+  // short rows are padded with empty strings
+  EXPECT_EQ("x", rows[2][0].valueAsString());
+  ASSERT_EQ(VariantType::String, rows[2][2].variantType().value());
+  EXPECT_EQ("", rows[2][2].valueAsString());
+
+  EXPECT_TRUE(csvFile.getColumnAsDoubleVector(0).empty());
+  std::vector<double> column = csvFile.getColumnAsDoubleVector(2);
+  EXPECT_TRUE(column.empty());
+
+  EXPECT_THROW(CSVFile(std::string("99999999999,1\n")), std::out_of_range);
+}
+
+TEST(Filetypes, CSVFile_LoadSelectedColumns) {
+  path p = resourcesPath() / toPath("utilities/Filetypes/test_csv.csv");
+
+  boost::optional<CSVFile> allColumns = CSVFile::load(p);
+  ASSERT_TRUE(allColumns);
+
+  boost::optional<CSVFile> csvFile = CSVFile::load(p, 1, {2, 0});
+  ASSERT_TRUE(csvFile);
+  ASSERT_EQ(allColumns->numRows() - 1, csvFile->numRows());
+  ASSERT_EQ(2u, csvFile->numColumns());
+
+  std::vector<std::string> column0 = allColumns->getColumnAsStringVector(0);
+  std::vector<std::string> column2 = allColumns->getColumnAsStringVector(2);
+  EXPECT_TRUE(std::vector<std::string>(column2.begin() + 1, column2.end()) == csvFile->getColumnAsStringVector(0));
+  EXPECT_TRUE(std::vector<std::string>(column0.begin() + 1, column0.end()) == csvFile->getColumnAsStringVector(1));
+
+  // columns past the end of the file are empty
+  csvFile = CSVFile::load(p, 0, {0, 10});
+  ASSERT_TRUE(csvFile);
+  ASSERT_EQ(allColumns->numRows(), csvFile->numRows());
+  ASSERT_EQ(2u, csvFile->numColumns());
+  EXPECT_TRUE(csvFile->getColumnAsStringVector(1) == std::vector<std::string>(csvFile->numRows(), ""));
+}
@@ -32,6 +32,7 @@
 #include "Vector3d.hpp"
 #include "Geometry.hpp"
 #include "Intersection.hpp"
+#include "PointWelder.hpp"
 
 #include "../core/Assert.hpp"
 //#include "../core/Path.hpp"
@@ -261,19 +262,6 @@ std::string FloorplanJS::toJSON(bool prettyPrint) const {
   return result;
 }
 
-size_t getVertexIndex(const Point3d& point3d, std::vector<Point3d>& allPoints, double tol = 0.001) {
-  size_t n = allPoints.size();
-  for (size_t i = 0; i < n; ++i) {
-    if (std::sqrt(std::pow(point3d.x() - allPoints[i].x(), 2) + std::pow(point3d.y() - allPoints[i].y(), 2)
-                  + std::pow(point3d.z() - allPoints[i].z(), 2))
-        < tol) {
-      return i;
-    }
-  }
-  allPoints.push_back(point3d);
-  return (allPoints.size() - 1);
-}
-
 std::string FloorplanJS::makeSurface(const Json::Value& story, const Json::Value& spaceOrShading, const std::string& parentSurfaceName,
                                      const std::string& parentSubSurfaceName, bool belowFloorPlenum, bool aboveCeilingPlenum,
                                      const std::string& surfaceType, const Point3dVectorVector& finalFaceVertices, size_t faceFormat,
@@ -308,19 +296,19 @@ std::string FloorplanJS::makeSurface(const Json::Value& story, const Json::Value
   std::string geometryId = std::string("Geometry ") + std::to_string(geometries.size());
   std::string faceId = std::string("Face ") + std::to_string(geometries.size());
 
-  Point3dVector allVertices;
+  PointWelder allVertices;
   std::vector<size_t> faceIndices;
   for (const auto& finalFaceVerts : finalFaceVertices) {
     faceIndices.push_back(faceFormat);
     for (const auto& vert : finalFaceVerts) {
-      faceIndices.push_back(getVertexIndex(vert, allVertices));
+      faceIndices.push_back(allVertices.addPoint(vert));
     }
   }
 
   {
     std::string uuid = geometryId;
     type = "Geometry";
-    ThreeGeometryData data(toThreeVector(allVertices), faceIndices);
+    ThreeGeometryData data(toThreeVector(allVertices.points()), faceIndices);
     ThreeGeometry geometry(uuid, type, data);
     geometries.push_back(geometry);
   }
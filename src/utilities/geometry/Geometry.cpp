@@ -29,6 +29,7 @@
 
 #include "Geometry.hpp"
 #include "Intersection.hpp"
+#include "PointWelder.hpp"
 #include "Transformation.hpp"
 #include "Vector3d.hpp"
 
@@ -475,7 +476,7 @@ std::vector<std::vector<Point3d>> computeTriangulation(const Point3dVector& vert
   // if holes have been triangulated, rejoin them here before subtraction
   std::vector<std::vector<Point3d>> newHoles = joinAll(holes, tol);
 
-  std::vector<Point3d> allPoints;
+  PointWelder allPoints(tol);
 
   // PolyPartition does not support holes which intersect the polygon or share an edge
   // if any hole is not fully contained we will use boost to remove all the holes
@@ -515,7 +516,7 @@ std::vector<std::vector<Point3d>> computeTriangulation(const Point3dVector& vert
       return result;
     }
 
-    Point3d point = getCombinedPoint(vertices[n - i - 1], allPoints, tol);
+    Point3d point = allPoints.combinedPoint(vertices[n - i - 1]);
     outerPoly[i].x = point.x();
     outerPoly[i].y = point.y();
   }
@@ -542,7 +543,7 @@ std::vector<std::vector<Point3d>> computeTriangulation(const Point3dVector& vert
         return result;
       }
 
-      Point3d point = getCombinedPoint(holeVertices[i], allPoints, tol);
+      Point3d point = allPoints.combinedPoint(holeVertices[i]);
       innerPoly[i].x = point.x();
       innerPoly[i].y = point.y();
     }
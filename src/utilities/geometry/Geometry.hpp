@@ -91,7 +91,7 @@ UTILITIES_API double getAngle(const Vector3d& vector1, const Vector3d& vector2);
 UTILITIES_API bool circularEqual(const std::vector<Point3d>& points1, const std::vector<Point3d>& points2, double tol = 0.001);
 
 /// if point3d is within tol of any existing points then returns existing point
-/// otherwise adds point3d to allPoints and returns point3d
+/// otherwise adds point3d to allPoints and returns point3d, use PointWelder when combining many points
 UTILITIES_API Point3d getCombinedPoint(const Point3d& point3d, std::vector<Point3d>& allPoints, double tol = 0.001);
 
 /// compute triangulation of vertices, holes are removed in the triangulation
@@ -30,6 +30,7 @@
 #include "Geometry.hpp"
 #include "Vector3d.hpp"
 #include "Intersection.hpp"
+#include "PointWelder.hpp"
 #include "../data/Matrix.hpp"
 #include "../core/Assert.hpp"
 #include "../core/Logger.hpp"
@@ -220,20 +221,20 @@ std::vector<BoostPolygon> removeHoles(const std::vector<BoostPolygon>& polygons)
 }
 
 // convert a Point3d to a BoostPoint
-boost::tuple<double, double> boostPointFromPoint3d(const Point3d& point3d, std::vector<Point3d>& allPoints, double tol) {
+boost::tuple<double, double> boostPointFromPoint3d(const Point3d& point3d, PointWelder& allPoints, double tol) {
   OS_ASSERT(abs(point3d.z()) <= tol);
 
   // simple method
   //return boost::make_tuple(point3d.x(), point3d.y());
 
   // detailed method, try to combine points within tolerance
-  Point3d resultPoint = getCombinedPoint(point3d, allPoints, tol);
+  Point3d resultPoint = allPoints.combinedPoint(point3d);
 
   return boost::make_tuple(resultPoint.x(), resultPoint.y());
 }
 
 // convert vertices to a boost polygon, all vertices must lie on z = 0 plane
-boost::optional<BoostPolygon> boostPolygonFromVertices(const std::vector<Point3d>& vertices, std::vector<Point3d>& allPoints, double tol) {
+boost::optional<BoostPolygon> boostPolygonFromVertices(const std::vector<Point3d>& vertices, PointWelder& allPoints, double tol) {
   if (vertices.size() < 3) {
     return boost::none;
   }
@@ -266,7 +267,7 @@ boost::optional<BoostPolygon> boostPolygonFromVertices(const std::vector<Point3d
   return polygon;
 }
 
-boost::optional<BoostPolygon> nonIntersectingBoostPolygonFromVertices(const std::vector<Point3d>& polygon, std::vector<Point3d>& allPoints,
+boost::optional<BoostPolygon> nonIntersectingBoostPolygonFromVertices(const std::vector<Point3d>& polygon, PointWelder& allPoints,
                                                                       double tol) {
   // cppcheck-suppress constStatement
   boost::optional<BoostPolygon> result = boostPolygonFromVertices(polygon, allPoints, tol);
@@ -284,7 +285,7 @@ boost::optional<BoostPolygon> nonIntersectingBoostPolygonFromVertices(const std:
 }
 
 // convert vertices to a boost ring, all vertices must lie on z = 0 plane
-boost::optional<BoostRing> boostRingFromVertices(const std::vector<Point3d>& vertices, std::vector<Point3d>& allPoints, double tol) {
+boost::optional<BoostRing> boostRingFromVertices(const std::vector<Point3d>& vertices, PointWelder& allPoints, double tol) {
   if (vertices.size() < 3) {
     return boost::none;
   }
@@ -317,7 +318,7 @@ boost::optional<BoostRing> boostRingFromVertices(const std::vector<Point3d>& ver
   return ring;
 }
 
-boost::optional<BoostRing> nonIntersectingBoostRingFromVertices(const std::vector<Point3d>& polygon, std::vector<Point3d>& allPoints, double tol) {
+boost::optional<BoostRing> nonIntersectingBoostRingFromVertices(const std::vector<Point3d>& polygon, PointWelder& allPoints, double tol) {
   boost::optional<BoostRing> result = boostRingFromVertices(polygon, allPoints, tol);
   if (!result) {
     return boost::none;
@@ -332,8 +333,8 @@ boost::optional<BoostRing> nonIntersectingBoostRingFromVertices(const std::vecto
   return result;
 }
 
-// convert a boost polygon to vertices
-std::vector<Point3d> verticesFromBoostPolygon(const BoostPolygon& polygon, std::vector<Point3d>& allPoints, double tol) {
+// convert a boost polygon to vertices, points are combined within the tolerance of allPoints
+std::vector<Point3d> verticesFromBoostPolygon(const BoostPolygon& polygon, PointWelder& allPoints) {
   std::vector<Point3d> result;
 
   BoostRing outer = polygon.outer();
@@ -346,7 +347,7 @@ std::vector<Point3d> verticesFromBoostPolygon(const BoostPolygon& polygon, std::
     Point3d point3d(outer[i].x(), outer[i].y(), 0.0);
 
     // try to combine points within tolerance
-    Point3d resultPoint = getCombinedPoint(point3d, allPoints, tol);
+    Point3d resultPoint = allPoints.combinedPoint(point3d);
 
     // don't keep repeated vertices
     if ((i > 0) && (result.back() == resultPoint)) {
@@ -374,8 +375,8 @@ std::vector<Point3d> verticesFromBoostPolygon(const BoostPolygon& polygon, std::
   return result;
 }
 
-// convert a boost ring to vertices
-std::vector<Point3d> verticesFromBoostRing(const BoostRing& ring, std::vector<Point3d>& allPoints, double tol) {
+// convert a boost ring to vertices, points are combined within the tolerance of allPoints
+std::vector<Point3d> verticesFromBoostRing(const BoostRing& ring, PointWelder& allPoints) {
   std::vector<Point3d> result;
 
   // add point for each vertex except final vertex
@@ -383,7 +384,7 @@ std::vector<Point3d> verticesFromBoostRing(const BoostRing& ring, std::vector<Po
     Point3d point3d(ring[i].x(), ring[i].y(), 0.0);
 
     // try to combine points within tolerance
-    Point3d resultPoint = getCombinedPoint(point3d, allPoints, tol);
+    Point3d resultPoint = allPoints.combinedPoint(point3d);
 
     // don't keep repeated vertices
     if ((i > 0) && (result.back() == resultPoint)) {
@@ -490,7 +491,7 @@ double IntersectionResult::area2() const {
 
 std::vector<Point3d> removeSpikes(const std::vector<Point3d>& polygon, double tol) {
   // convert vertices to boost rings
-  std::vector<Point3d> allPoints;
+  PointWelder allPoints(tol);
 
   // cppcheck-suppress constStatement
   boost::optional<BoostPolygon> boostPolygon = boostPolygonFromVertices(polygon, allPoints, tol);
@@ -500,14 +501,14 @@ std::vector<Point3d> removeSpikes(const std::vector<Point3d>& polygon, double to
 
   BoostPolygon boostResult = removeSpikes(*boostPolygon);
 
-  std::vector<Point3d> result = verticesFromBoostPolygon(boostResult, allPoints, tol);
+  std::vector<Point3d> result = verticesFromBoostPolygon(boostResult, allPoints);
 
   return result;
 }
 
 bool pointInPolygon(const Point3d& point, const std::vector<Point3d>& polygon, double tol) {
   // convert vertices to boost rings
-  std::vector<Point3d> allPoints;
+  PointWelder allPoints(tol);
 
   boost::optional<BoostRing> boostPolygon = nonIntersectingBoostRingFromVertices(polygon, allPoints, tol);
   if (!boostPolygon) {
@@ -538,7 +539,7 @@ bool pointInPolygon(const Point3d& point, const std::vector<Point3d>& polygon, d
 
 boost::optional<std::vector<Point3d>> join(const std::vector<Point3d>& polygon1, const std::vector<Point3d>& polygon2, double tol) {
   // convert vertices to boost rings
-  std::vector<Point3d> allPoints;
+  PointWelder allPoints(tol);
 
   boost::optional<BoostRing> boostPolygon1 = nonIntersectingBoostRingFromVertices(polygon1, allPoints, tol);
   if (!boostPolygon1) {
@@ -574,7 +575,7 @@ boost::optional<std::vector<Point3d>> join(const std::vector<Point3d>& polygon1,
     return boost::none;
   };
 
-  std::vector<Point3d> unionVertices = verticesFromBoostPolygon(unionResult[0], allPoints, tol);
+  std::vector<Point3d> unionVertices = verticesFromBoostPolygon(unionResult[0], allPoints);
   boost::optional<double> testArea = boost::geometry::area(unionResult[0]);
   if (!testArea || unionVertices.empty()) {
     LOG_FREE(Info, "utilities.geometry.join", "Cannot compute area of union");
@@ -678,7 +679,7 @@ boost::optional<IntersectionResult> intersect(const std::vector<Point3d>& polygo
   //std::cout << "Initial polygon2 area " << getArea(polygon2).get() << '\n';
 
   // convert vertices to boost rings
-  std::vector<Point3d> allPoints;
+  PointWelder allPoints(tol);
 
   boost::optional<BoostRing> boostPolygon1 = nonIntersectingBoostRingFromVertices(polygon1, allPoints, tol);
   if (!boostPolygon1) {
@@ -715,7 +716,7 @@ boost::optional<IntersectionResult> intersect(const std::vector<Point3d>& polygo
   }
 
   // check that largest intersection is ok
-  std::vector<Point3d> intersectionVertices = verticesFromBoostPolygon(intersectionResult[0], allPoints, tol);
+  std::vector<Point3d> intersectionVertices = verticesFromBoostPolygon(intersectionResult[0], allPoints);
   boost::optional<double> testArea = boost::geometry::area(intersectionResult[0]);
   if (!testArea || intersectionVertices.empty()) {
     LOG_FREE(Info, "utilities.geometry.intersect", "Cannot compute area of largest intersection");
@@ -742,7 +743,7 @@ boost::optional<IntersectionResult> intersect(const std::vector<Point3d>& polygo
   // create new polygon for each remaining intersection
   for (unsigned i = 1; i < intersectionResult.size(); ++i) {
 
-    std::vector<Point3d> newPolygon = verticesFromBoostPolygon(intersectionResult[i], allPoints, tol);
+    std::vector<Point3d> newPolygon = verticesFromBoostPolygon(intersectionResult[i], allPoints);
 
     testArea = boost::geometry::area(intersectionResult[i]);
     if (!testArea || newPolygon.empty()) {
@@ -777,7 +778,7 @@ boost::optional<IntersectionResult> intersect(const std::vector<Point3d>& polygo
   // create new polygon for each difference
   for (unsigned i = 0; i < differenceResult1.size(); ++i) {
 
-    std::vector<Point3d> newPolygon1 = verticesFromBoostPolygon(differenceResult1[i], allPoints, tol);
+    std::vector<Point3d> newPolygon1 = verticesFromBoostPolygon(differenceResult1[i], allPoints);
 
     testArea = boost::geometry::area(differenceResult1[i]);
     if (!testArea || newPolygon1.empty()) {
@@ -807,7 +808,7 @@ boost::optional<IntersectionResult> intersect(const std::vector<Point3d>& polygo
   // create new polygon for each difference
   for (unsigned i = 0; i < differenceResult2.size(); ++i) {
 
-    std::vector<Point3d> newPolygon2 = verticesFromBoostPolygon(differenceResult2[i], allPoints, tol);
+    std::vector<Point3d> newPolygon2 = verticesFromBoostPolygon(differenceResult2[i], allPoints);
 
     testArea = boost::geometry::area(differenceResult2[i]);
     if (!testArea || newPolygon2.empty()) {
@@ -840,7 +841,7 @@ std::vector<std::vector<Point3d>> subtract(const std::vector<Point3d>& polygon,
   std::vector<std::vector<Point3d>> result;
 
   // convert vertices to boost rings
-  std::vector<Point3d> allPoints;
+  PointWelder allPoints(tol);
 
   // cppcheck-suppress constStatement
   boost::optional<BoostPolygon> initialBoostPolygon = nonIntersectingBoostPolygonFromVertices(polygon, allPoints, tol);
@@ -873,7 +874,7 @@ std::vector<std::vector<Point3d>> subtract(const std::vector<Point3d>& polygon,
   }
 
   for (const BoostPolygon& boostPolygon : boostPolygons) {
-    result.push_back(verticesFromBoostPolygon(boostPolygon, allPoints, tol));
+    result.push_back(verticesFromBoostPolygon(boostPolygon, allPoints));
   }
 
   return result;
@@ -881,7 +882,7 @@ std::vector<std::vector<Point3d>> subtract(const std::vector<Point3d>& polygon,
 
 bool selfIntersects(const std::vector<Point3d>& polygon, double tol) {
   // convert vertices to boost rings
-  std::vector<Point3d> allPoints;
+  PointWelder allPoints(tol);
 
   // cppcheck-suppress constStatement
   boost::optional<BoostPolygon> bp = nonIntersectingBoostPolygonFromVertices(polygon, allPoints, tol);
@@ -894,7 +895,7 @@ bool selfIntersects(const std::vector<Point3d>& polygon, double tol) {
 
 bool intersects(const std::vector<Point3d>& polygon1, const std::vector<Point3d>& polygon2, double tol) {
   // convert vertices to boost rings
-  std::vector<Point3d> allPoints;
+  PointWelder allPoints(tol);
 
   boost::optional<BoostPolygon> bp1 = boostPolygonFromVertices(polygon1, allPoints, tol);
   boost::optional<BoostPolygon> bp2 = boostPolygonFromVertices(polygon2, allPoints, tol);
@@ -914,7 +915,7 @@ bool within(const Point3d& point1, const std::vector<Point3d>& polygon2, double
 
 bool within(const std::vector<Point3d>& geometry1, const std::vector<Point3d>& polygon2, double tol) {
   // convert vertices to boost rings
-  std::vector<Point3d> allPoints;
+  PointWelder allPoints(tol);
 
   if (geometry1.size() == 1) {
     if (geometry1[0].z() > tol) {
@@ -1001,7 +1002,7 @@ boost::optional<double> getLinearAlpha(const Point3d& point0, const Point3d& poi
 }
 
 std::vector<Point3d> simplify(const std::vector<Point3d>& vertices, bool removeCollinear, double tol) {
-  std::vector<Point3d> allPoints;
+  PointWelder allPoints(tol);
 
   bool reversed = false;
   boost::optional<Vector3d> outwardNormal = getOutwardNormal(vertices);
@@ -1031,7 +1032,7 @@ std::vector<Point3d> simplify(const std::vector<Point3d>& vertices, bool removeC
   //boost::geometry::simplify(*bp, out, 0.0);
   boost::geometry::simplify(*bp, out, tol);  // points within tol would already be merged
 
-  std::vector<Point3d> tmp = verticesFromBoostPolygon(out, allPoints, tol);
+  std::vector<Point3d> tmp = verticesFromBoostPolygon(out, allPoints);
 
   if (reversed) {
     tmp = reorderULC(reverse(tmp));
@@ -1053,7 +1054,7 @@ std::vector<Point3d> simplify(const std::vector<Point3d>& vertices, bool removeC
   for (size_t i = 0; i < allPoints.size(); ++i) {
     bool found = false;
     for (const auto& tmpPoint : tmp) {
-      if (getDistance(tmpPoint, allPoints[i]) < tol) {
+      if (getDistance(tmpPoint, allPoints.points()[i]) < tol) {
         found = true;
       }
     }
@@ -1068,7 +1069,7 @@ std::vector<Point3d> simplify(const std::vector<Point3d>& vertices, bool removeC
     // see which remaining points fit in this segment, double is index in allPoints, alpha along line
     std::vector<std::pair<size_t, double>> pointsInSegment;
     for (size_t j : pointsToAdd) {
-      boost::optional<double> alpha = getLinearAlpha(tmp[i - 1], tmp[i], allPoints[j]);
+      boost::optional<double> alpha = getLinearAlpha(tmp[i - 1], tmp[i], allPoints.points()[j]);
       if (alpha) {
         pointsInSegment.push_back(std::make_pair(j, *alpha));
       }
@@ -1078,7 +1079,7 @@ std::vector<Point3d> simplify(const std::vector<Point3d>& vertices, bool removeC
               [](std::pair<size_t, double> a, std::pair<size_t, double> b) { return a.second < b.second; });
 
     for (const auto& pointInSegment : pointsInSegment) {
-      result.push_back(allPoints[pointInSegment.first]);
+      result.push_back(allPoints.points()[pointInSegment.first]);
       pointsToAdd.erase(pointInSegment.first);
     }
 
@@ -1089,7 +1090,7 @@ std::vector<Point3d> simplify(const std::vector<Point3d>& vertices, bool removeC
   // now check between last point and first point
   std::vector<std::pair<size_t, double>> pointsInSegment;
   for (size_t j : pointsToAdd) {
-    boost::optional<double> alpha = getLinearAlpha(tmp[tmp.size() - 1], tmp[0], allPoints[j]);
+    boost::optional<double> alpha = getLinearAlpha(tmp[tmp.size() - 1], tmp[0], allPoints.points()[j]);
     if (alpha) {
       pointsInSegment.push_back(std::make_pair(j, *alpha));
     }
@@ -1099,7 +1100,7 @@ std::vector<Point3d> simplify(const std::vector<Point3d>& vertices, bool removeC
             [](std::pair<size_t, double> a, std::pair<size_t, double> b) { return a.second < b.second; });
 
   for (const auto& pointInSegment : pointsInSegment) {
-    result.push_back(allPoints[pointInSegment.first]);
+    result.push_back(allPoints.points()[pointInSegment.first]);
     pointsToAdd.erase(pointInSegment.first);
   }
 
@@ -1111,7 +1112,7 @@ std::vector<Point3d> simplify(const std::vector<Point3d>& vertices, bool removeC
 }
 
 /// Converts a Polygon to a BoostPolygon
-boost::optional<BoostPolygon> BoostPolygonFromPolygon(const Polygon3d& polygon, Point3dVector& allPoints, double tol) {
+boost::optional<BoostPolygon> BoostPolygonFromPolygon(const Polygon3d& polygon, PointWelder& allPoints, double tol) {
   BoostPolygon boostPolygon;
 
   for (const Point3d& vertex : polygon.getOuterPath()) {
@@ -1132,7 +1133,7 @@ boost::optional<BoostPolygon> BoostPolygonFromPolygon(const Polygon3d& polygon,
   return boostPolygon;
 }
 
-Polygon3d PolygonFromBoostPolygon(const BoostPolygon& boostPolygon, Point3dVector& allPoints, double tol) {
+Polygon3d PolygonFromBoostPolygon(const BoostPolygon& boostPolygon, PointWelder& allPoints) {
   Polygon3d p;
   BoostRing outer = boostPolygon.outer();
   if (outer.empty()) {
@@ -1142,7 +1143,7 @@ Polygon3d PolygonFromBoostPolygon(const BoostPolygon& boostPolygon, Point3dVecto
   Point3dVector points;
   for (unsigned i = 0; i < outer.size() - 1; ++i) {
     Point3d point3d(outer[i].x(), outer[i].y(), 0.0);
-    Point3d resultPoint = getCombinedPoint(point3d, allPoints, tol);
+    Point3d resultPoint = allPoints.combinedPoint(point3d);
     // don't keep repeated vertices
     if ((i > 0) && (points.back() == resultPoint)) {
       continue;
@@ -1159,7 +1160,7 @@ Polygon3d PolygonFromBoostPolygon(const BoostPolygon& boostPolygon, Point3dVecto
     Point3dVector hole;
     for (unsigned i = 0; i < inner.size() - 1; ++i) {
       Point3d point3d(inner[i].x(), inner[i].y(), 0.0);
-      Point3d resultPoint = getCombinedPoint(point3d, allPoints, tol);
+      Point3d resultPoint = allPoints.combinedPoint(point3d);
       // don't keep repeated vertices
       if ((i > 0) && (hole.back() == resultPoint)) {
         continue;
@@ -1174,10 +1175,10 @@ Polygon3d PolygonFromBoostPolygon(const BoostPolygon& boostPolygon, Point3dVecto
 
 // Non class member stuff
 boost::optional<Polygon3d> join(const Polygon3d& polygon1, const Polygon3d& polygon2) {
-  Point3dVector allPoints;
-
   double tol = 0.01;
 
+  PointWelder allPoints(tol);
+
   // Convert polygons to boost polygon (not ring obvs)
   boost::optional<BoostPolygon> boostPolygon1 = BoostPolygonFromPolygon(polygon1, allPoints, tol);
   if (!boostPolygon1) {
@@ -1208,7 +1209,7 @@ boost::optional<Polygon3d> join(const Polygon3d& polygon1, const Polygon3d& poly
   }
 
   // Convert back to polygon
-  Polygon3d p = PolygonFromBoostPolygon(unionResult.front(), allPoints, tol);
+  Polygon3d p = PolygonFromBoostPolygon(unionResult.front(), allPoints);
   return p;
 }
 
@@ -1301,7 +1302,7 @@ std::vector<Polygon3d> joinAll(const std::vector<Polygon3d>& polygons, double to
 
 std::vector<Polygon3d> bufferAll(const std::vector<Polygon3d>& polygons, double tol) {
   BoostMultiPolygon source;
-  std::vector<Point3d> allPoints;
+  PointWelder allPoints(tol);
 
   for (const Polygon3d& polygon : polygons) {
     // cppcheck-suppress constStatement
@@ -1325,7 +1326,7 @@ std::vector<Polygon3d> bufferAll(const std::vector<Polygon3d>& polygons, double
   for (const auto& boostPolygon : resultShrink) {
     BoostPolygon simplified;
     boost::geometry::simplify(boostPolygon, simplified, tol);
-    auto polygon = PolygonFromBoostPolygon(simplified, allPoints, tol);
+    auto polygon = PolygonFromBoostPolygon(simplified, allPoints);
     result.push_back(polygon);
   }
 
@@ -1334,7 +1335,7 @@ std::vector<Polygon3d> bufferAll(const std::vector<Polygon3d>& polygons, double
 
 boost::optional<std::vector<Point3d>> buffer(const std::vector<Point3d>& polygon1, double amount, double tol) {
 
-  std::vector<Point3d> allPoints;
+  PointWelder allPoints(tol);
   boost::optional<BoostPolygon> boostPolygon1 = nonIntersectingBoostPolygonFromVertices(polygon1, allPoints, tol);
 
   if (!boostPolygon1) {
@@ -1356,12 +1357,12 @@ boost::optional<std::vector<Point3d>> buffer(const std::vector<Point3d>& polygon
 
   boost::geometry::buffer(polygons, result, distance_strategy, side_strategy, join_strategy, end_strategy, point_strategy);
 
-  std::vector<Point3d> vertices = verticesFromBoostPolygon(result[0], allPoints, tol);
+  std::vector<Point3d> vertices = verticesFromBoostPolygon(result[0], allPoints);
   return vertices;
 }
 
 boost::optional<std::vector<std::vector<Point3d>>> buffer(const std::vector<std::vector<Point3d>>& polygons, double amount, double tol) {
-  std::vector<Point3d> allPoints;
+  PointWelder allPoints(tol);
 
   BoostMultiPolygon boostPolygons;
   for (const auto& polygon : polygons) {
@@ -1384,7 +1385,7 @@ boost::optional<std::vector<std::vector<Point3d>>> buffer(const std::vector<std:
 
   std::vector<Point3dVector> results;
   for (const auto& boostPolygon : result) {
-    std::vector<Point3d> points = verticesFromBoostPolygon(boostPolygon, allPoints, tol);
+    std::vector<Point3d> points = verticesFromBoostPolygon(boostPolygon, allPoints);
     results.push_back(points);
   }
   return results;
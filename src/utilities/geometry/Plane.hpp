@@ -43,6 +43,10 @@ namespace openstudio {
 class Point3d;
 class Vector3d;
 
+namespace detail {
+  struct PlaneFromCoefficients;
+}
+
 /** Plane defines an infinite plane in 3D space.  The equation of a plane is
    *  a*x + b*y + c*z = d, any point that satisfies this equation is on the plane.
    */
@@ -103,6 +107,9 @@ class UTILITIES_API Plane
   double d() const;
 
  private:
+  // lets the batched plane fits in PolygonBuffer.cpp construct with coefficients
+  friend struct detail::PlaneFromCoefficients;
+
   // construct with coefficients
   Plane(double a, double b, double c, double d);
 
@@ -80,7 +80,7 @@ class UTILITIES_API Point3d
 
  private:
   REGISTER_LOGGER("utilities.Point3d");
-  Vector m_storage;
+  double m_storage[3];
 };
 
 /// ostream operator
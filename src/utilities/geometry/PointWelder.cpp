@@ -0,0 +1,167 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2021, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "PointWelder.hpp"
+
+#include <cmath>
+
+namespace openstudio {
+
+namespace {
+
+  // cells are twice the tolerance so that two points closer than tol never land more than one cell apart,
+  // even after rounding in the division by the cell size
+  constexpr double cellSizeFactor = 2.0;
+
+  // largest cell coordinate (2^50), below this the rounding error in the cell coordinate is at most 0.25 cells so the
+  // one cell guarantee above holds, points further out are checked linearly
+  constexpr double maxCellCoordinate = 1125899906842624.0;
+
+}  // namespace
+
+size_t PointWelder::CellKeyHash::operator()(const CellKey& key) const {
+  auto h = static_cast<std::uint64_t>(key.x) * 0x9E3779B97F4A7C15ULL;
+  h ^= static_cast<std::uint64_t>(key.y) * 0xC2B2AE3D27D4EB4FULL + (h << 6) + (h >> 2);
+  h ^= static_cast<std::uint64_t>(key.z) * 0x165667B19E3779F9ULL + (h << 6) + (h >> 2);
+  return static_cast<size_t>(h);
+}
+
+PointWelder::PointWelder(double tol) : m_tol(tol), m_cellSize(cellSizeFactor * tol) {}
+
+boost::optional<PointWelder::CellKey> PointWelder::cellKey(const Point3d& point3d) const {
+  // a zero, negative or non-finite tolerance can not be gridded
+  if (!(m_cellSize > 0.0) || !std::isfinite(m_cellSize)) {
+    return boost::none;
+  }
+
+  double x = std::floor(point3d.x() / m_cellSize);
+  double y = std::floor(point3d.y() / m_cellSize);
+  double z = std::floor(point3d.z() / m_cellSize);
+
+  // also rejects NaN
+  if (!(std::abs(x) < maxCellCoordinate) || !(std::abs(y) < maxCellCoordinate) || !(std::abs(z) < maxCellCoordinate)) {
+    return boost::none;
+  }
+
+  return CellKey{static_cast<std::int64_t>(x), static_cast<std::int64_t>(y), static_cast<std::int64_t>(z)};
+}
+
+bool PointWelder::withinTolerance(const Point3d& point3d, size_t index) const {
+  // same expression as getCombinedPoint so that welding decisions are identical
+  const Point3d& otherPoint = m_points[index];
+  return std::sqrt(std::pow(point3d.x() - otherPoint.x(), 2) + std::pow(point3d.y() - otherPoint.y(), 2) + std::pow(point3d.z() - otherPoint.z(), 2))
+         < m_tol;
+}
+
+boost::optional<size_t> PointWelder::findPoint(const Point3d& point3d) const {
+  boost::optional<CellKey> key = cellKey(point3d);
+  if (!key) {
+    // fall back to checking every point in order
+    for (size_t i = 0; i < m_points.size(); ++i) {
+      if (withinTolerance(point3d, i)) {
+        return i;
+      }
+    }
+    return boost::none;
+  }
+
+  // the first point added wins, so keep the lowest matching index over all neighboring cells
+  boost::optional<size_t> result;
+  for (std::int64_t dx = -1; dx <= 1; ++dx) {
+    for (std::int64_t dy = -1; dy <= 1; ++dy) {
+      for (std::int64_t dz = -1; dz <= 1; ++dz) {
+        auto it = m_cells.find(CellKey{key->x + dx, key->y + dy, key->z + dz});
+        if (it == m_cells.end()) {
+          continue;
+        }
+        // indices in each cell are in increasing order
+        for (size_t index : it->second) {
+          if (result && index >= *result) {
+            break;
+          }
+          if (withinTolerance(point3d, index)) {
+            result = index;
+            break;
+          }
+        }
+      }
+    }
+  }
+
+  for (size_t index : m_unbinned) {
+    if (result && index >= *result) {
+      break;
+    }
+    if (withinTolerance(point3d, index)) {
+      result = index;
+      break;
+    }
+  }
+
+  return result;
+}
+
+size_t PointWelder::addPoint(const Point3d& point3d) {
+  if (boost::optional<size_t> index = findPoint(point3d)) {
+    return *index;
+  }
+
+  size_t index = m_points.size();
+  m_points.push_back(point3d);
+  if (boost::optional<CellKey> key = cellKey(point3d)) {
+    m_cells[*key].push_back(index);
+  } else {
+    m_unbinned.push_back(index);
+  }
+  return index;
+}
+
+Point3d PointWelder::combinedPoint(const Point3d& point3d) {
+  return m_points[addPoint(point3d)];
+}
+
+const std::vector<Point3d>& PointWelder::points() const {
+  return m_points;
+}
+
+size_t PointWelder::size() const {
+  return m_points.size();
+}
+
+double PointWelder::tolerance() const {
+  return m_tol;
+}
+
+void PointWelder::clear() {
+  m_points.clear();
+  m_cells.clear();
+  m_unbinned.clear();
+}
+
+}  // namespace openstudio
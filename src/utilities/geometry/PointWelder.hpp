@@ -0,0 +1,105 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2021, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_GEOMETRY_POINTWELDER_HPP
+#define UTILITIES_GEOMETRY_POINTWELDER_HPP
+
+#include "../UtilitiesAPI.hpp"
+#include "Point3d.hpp"
+
+#include <boost/optional.hpp>
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace openstudio {
+
+/** PointWelder merges points which are within a tolerance of each other.  Points are kept in the order they were added
+   *  and the first point added within tol of a new point is the one that new point is welded to, the same as repeatedly
+   *  calling getCombinedPoint with a single vector of points.  Lookups go through a spatial hash grid rather than a scan
+   *  over every point added so far, so welding n points is linear rather than quadratic in n.
+   */
+class UTILITIES_API PointWelder
+{
+ public:
+  /// create an empty welder, points closer than tol are welded together
+  explicit PointWelder(double tol = 0.001);
+
+  /// returns the index of the first point within tol of point3d, otherwise adds point3d and returns its index
+  size_t addPoint(const Point3d& point3d);
+
+  /// returns the first point within tol of point3d, otherwise adds point3d and returns it
+  Point3d combinedPoint(const Point3d& point3d);
+
+  /// returns the index of the first point within tol of point3d, does not add point3d
+  boost::optional<size_t> findPoint(const Point3d& point3d) const;
+
+  /// all points added, in the order they were added
+  const std::vector<Point3d>& points() const;
+
+  size_t size() const;
+
+  double tolerance() const;
+
+  /// remove all points, keeps the tolerance
+  void clear();
+
+ private:
+  struct CellKey
+  {
+    std::int64_t x;
+    std::int64_t y;
+    std::int64_t z;
+
+    bool operator==(const CellKey& other) const {
+      return x == other.x && y == other.y && z == other.z;
+    }
+  };
+
+  struct CellKeyHash
+  {
+    size_t operator()(const CellKey& key) const;
+  };
+
+  boost::optional<CellKey> cellKey(const Point3d& point3d) const;
+
+  bool withinTolerance(const Point3d& point3d, size_t index) const;
+
+  double m_tol;
+  double m_cellSize;
+  std::vector<Point3d> m_points;
+  std::unordered_map<CellKey, std::vector<size_t>, CellKeyHash> m_cells;
+  // points whose coordinates can not be mapped to a cell, checked on every lookup
+  std::vector<size_t> m_unbinned;
+};
+
+}  // namespace openstudio
+
+#endif  //UTILITIES_GEOMETRY_POINTWELDER_HPP
@@ -0,0 +1,444 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2021, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "PolygonBuffer.hpp"
+
+#include <cmath>
+
+namespace openstudio {
+
+PolygonBuffer::PolygonBuffer() : m_offsets(1, 0) {}
+
+PolygonBuffer::PolygonBuffer(std::vector<size_t> offsets, std::vector<double> x, std::vector<double> y, std::vector<double> z)
+  : m_offsets(std::move(offsets)), m_x(std::move(x)), m_y(std::move(y)), m_z(std::move(z)) {
+  if (m_offsets.empty() || m_offsets.front() != 0) {
+    LOG_AND_THROW("Polygon offsets must start at 0");
+  }
+  for (size_t i = 1; i < m_offsets.size(); ++i) {
+    if (m_offsets[i] < m_offsets[i - 1]) {
+      LOG_AND_THROW("Polygon offsets must not decrease, offset " << i << " is " << m_offsets[i] << " but offset " << i - 1 << " is "
+                                                                 << m_offsets[i - 1]);
+    }
+  }
+  if ((m_x.size() != m_offsets.back()) || (m_y.size() != m_offsets.back()) || (m_z.size() != m_offsets.back())) {
+    LOG_AND_THROW("Last polygon offset " << m_offsets.back() << " does not match the number of coordinates, x has " << m_x.size()
+                                         << ", y has " << m_y.size() << " and z has " << m_z.size());
+  }
+}
+
+void PolygonBuffer::reserve(size_t numPolygons, size_t numVertices) {
+  m_offsets.reserve(numPolygons + 1);
+  m_x.reserve(numVertices);
+  m_y.reserve(numVertices);
+  m_z.reserve(numVertices);
+}
+
+size_t PolygonBuffer::addPolygon(const std::vector<Point3d>& points) {
+  for (const Point3d& point : points) {
+    m_x.push_back(point.x());
+    m_y.push_back(point.y());
+    m_z.push_back(point.z());
+  }
+  m_offsets.push_back(m_x.size());
+  return m_offsets.size() - 2;
+}
+
+void PolygonBuffer::clear() {
+  m_offsets.assign(1, 0);
+  m_x.clear();
+  m_y.clear();
+  m_z.clear();
+}
+
+size_t PolygonBuffer::numPolygons() const {
+  return m_offsets.size() - 1;
+}
+
+size_t PolygonBuffer::numVertices() const {
+  return m_x.size();
+}
+
+size_t PolygonBuffer::numVertices(size_t index) const {
+  return m_offsets[index + 1] - m_offsets[index];
+}
+
+std::vector<Point3d> PolygonBuffer::polygon(size_t index) const {
+  std::vector<Point3d> result;
+  result.reserve(numVertices(index));
+  for (size_t i = m_offsets[index], iend = m_offsets[index + 1]; i < iend; ++i) {
+    result.emplace_back(m_x[i], m_y[i], m_z[i]);
+  }
+  return result;
+}
+
+const std::vector<size_t>& PolygonBuffer::offsets() const {
+  return m_offsets;
+}
+
+const std::vector<double>& PolygonBuffer::x() const {
+  return m_x;
+}
+
+const std::vector<double>& PolygonBuffer::y() const {
+  return m_y;
+}
+
+const std::vector<double>& PolygonBuffer::z() const {
+  return m_z;
+}
+
+namespace detail {
+
+  // the plane fits below end up with the coefficients, build the plane from them directly
+  struct PlaneFromCoefficients
+  {
+    static Plane plane(double a, double b, double c, double d) {
+      return Plane(a, b, c, d);
+    }
+  };
+
+}  // namespace detail
+
+namespace {
+
+  // sums over the vertices of one polygon, everything is relative to the first vertex
+  struct PolygonSums
+  {
+    size_t n = 0;
+    double x0 = 0.0;
+    double y0 = 0.0;
+    double z0 = 0.0;
+
+    // Newall vector, accumulated triangle by triangle over the fan from the first vertex in the same order as getNewallVector
+    double nx = 0.0;
+    double ny = 0.0;
+    double nz = 0.0;
+
+    // m[a][b] is the sum over fan triangles of component a of the triangle's cross product times component b of the sum of
+    // its two other vertices, the centroid is x0 + (N' * m) / (3 * N' * N) where N is the Newall vector
+    double m[3][3] = {{0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}};
+
+    // first and second moments of the vertices, these make up A'*A and A'*b in the least squares fits of Plane(points)
+    double sx = 0.0;
+    double sy = 0.0;
+    double sz = 0.0;
+    double sxx = 0.0;
+    double syy = 0.0;
+    double szz = 0.0;
+    double sxy = 0.0;
+    double sxz = 0.0;
+    double syz = 0.0;
+  };
+
+  PolygonSums sumPolygon(const PolygonBuffer& polygons, size_t index, bool centroidSums, bool planeSums) {
+    PolygonSums result;
+    const size_t begin = polygons.offsets()[index];
+    const size_t n = polygons.offsets()[index + 1] - begin;
+    result.n = n;
+    if (n < 3) {
+      return result;
+    }
+
+    const double* x = polygons.x().data() + begin;
+    const double* y = polygons.y().data() + begin;
+    const double* z = polygons.z().data() + begin;
+    const double x0 = x[0];
+    const double y0 = y[0];
+    const double z0 = z[0];
+    result.x0 = x0;
+    result.y0 = y0;
+    result.z0 = z0;
+
+    double nx = 0.0;
+    double ny = 0.0;
+    double nz = 0.0;
+    for (size_t i = 1; i < n - 1; ++i) {
+      const double x1 = x[i] - x0;
+      const double y1 = y[i] - y0;
+      const double z1 = z[i] - z0;
+      const double x2 = x[i + 1] - x0;
+      const double y2 = y[i + 1] - y0;
+      const double z2 = z[i + 1] - z0;
+      const double cx = y1 * z2 - z1 * y2;
+      const double cy = z1 * x2 - x1 * z2;
+      const double cz = x1 * y2 - y1 * x2;
+      nx += cx;
+      ny += cy;
+      nz += cz;
+      if (centroidSums) {
+        const double tx = x1 + x2;
+        const double ty = y1 + y2;
+        const double tz = z1 + z2;
+        result.m[0][0] += cx * tx;
+        result.m[0][1] += cx * ty;
+        result.m[0][2] += cx * tz;
+        result.m[1][0] += cy * tx;
+        result.m[1][1] += cy * ty;
+        result.m[1][2] += cy * tz;
+        result.m[2][0] += cz * tx;
+        result.m[2][1] += cz * ty;
+        result.m[2][2] += cz * tz;
+      }
+    }
+    result.nx = nx;
+    result.ny = ny;
+    result.nz = nz;
+
+    if (planeSums) {
+      double sx = 0.0;
+      double sy = 0.0;
+      double sz = 0.0;
+      double sxx = 0.0;
+      double syy = 0.0;
+      double szz = 0.0;
+      double sxy = 0.0;
+      double sxz = 0.0;
+      double syz = 0.0;
+      for (size_t i = 0; i < n; ++i) {
+        const double dx = x[i] - x0;
+        const double dy = y[i] - y0;
+        const double dz = z[i] - z0;
+        sx += dx;
+        sy += dy;
+        sz += dz;
+        sxx += dx * dx;
+        syy += dy * dy;
+        szz += dz * dz;
+        sxy += dx * dy;
+        sxz += dx * dz;
+        syz += dy * dz;
+      }
+      result.sx = sx;
+      result.sy = sy;
+      result.sz = sz;
+      result.sxx = sxx;
+      result.syy = syy;
+      result.szz = szz;
+      result.sxy = sxy;
+      result.sxz = sxz;
+      result.syz = syz;
+    }
+
+    return result;
+  }
+
+  boost::optional<Vector3d> newallVector(const PolygonSums& sums) {
+    if (sums.n < 3) {
+      return boost::none;
+    }
+    return Vector3d(sums.nx, sums.ny, sums.nz);
+  }
+
+  boost::optional<Point3d> centroid(const PolygonSums& sums) {
+    if (sums.n < 3) {
+      return boost::none;
+    }
+    const double nn = sums.nx * sums.nx + sums.ny * sums.ny + sums.nz * sums.nz;
+    if (!(nn > 0.0)) {
+      return boost::none;
+    }
+    const double scale = 1.0 / (3.0 * nn);
+    const double cx = (sums.nx * sums.m[0][0] + sums.ny * sums.m[1][0] + sums.nz * sums.m[2][0]) * scale;
+    const double cy = (sums.nx * sums.m[0][1] + sums.ny * sums.m[1][1] + sums.nz * sums.m[2][1]) * scale;
+    const double cz = (sums.nx * sums.m[0][2] + sums.ny * sums.m[1][2] + sums.nz * sums.m[2][2]) * scale;
+    return Point3d(sums.x0 + cx, sums.y0 + cy, sums.z0 + cz);
+  }
+
+  // solves the symmetric system [s11 s12 s13; s12 s22 s23; s13 s23 s33] * x = r if its determinant beats maxDet,
+  // this is one of the least squares fits in Plane(points) with A'*A and A'*b built from the polygon's moments
+  bool solvePlaneFit(double s11, double s12, double s13, double s22, double s23, double s33, double r1, double r2, double r3,
+                     double& maxDet, double x[3]) {
+    // same expansion as det3x3 in Plane.cpp
+    double det = s11 * s22 * s33 + s12 * s23 * s13 + s13 * s12 * s23 - s13 * s22 * s13 - s12 * s12 * s33 - s11 * s23 * s23;
+    if (!(det > maxDet)) {
+      return false;
+    }
+    maxDet = det;
+
+    // inverse of a symmetric matrix from its cofactors
+    double i11 = s22 * s33 - s23 * s23;
+    double i12 = s13 * s23 - s12 * s33;
+    double i13 = s12 * s23 - s13 * s22;
+    double i22 = s11 * s33 - s13 * s13;
+    double i23 = s12 * s13 - s11 * s23;
+    double i33 = s11 * s22 - s12 * s12;
+    x[0] = (i11 * r1 + i12 * r2 + i13 * r3) / det;
+    x[1] = (i12 * r1 + i22 * r2 + i23 * r3) / det;
+    x[2] = (i13 * r1 + i23 * r2 + i33 * r3) / det;
+    return true;
+  }
+
+  boost::optional<Plane> plane(const PolygonSums& sums, const PolygonBuffer& polygons, size_t index) {
+    if (sums.n < 3) {
+      return boost::none;
+    }
+
+    if (sums.n == 3) {
+      // same as Plane(points), points[1] is the point and (a x b) is the normal
+      const size_t begin = polygons.offsets()[index];
+      Point3d p0(polygons.x()[begin], polygons.y()[begin], polygons.z()[begin]);
+      Point3d p1(polygons.x()[begin + 1], polygons.y()[begin + 1], polygons.z()[begin + 1]);
+      Point3d p2(polygons.x()[begin + 2], polygons.y()[begin + 2], polygons.z()[begin + 2]);
+      Vector3d normal = (p1 - p0).cross(p2 - p1);
+      if (!(normal.length() > 0.0)) {
+        return boost::none;
+      }
+      return Plane(p1, normal);
+    }
+
+    // same three fits as Plane(points), the one with the best conditioned normal equations wins
+    const double n = static_cast<double>(sums.n);
+    double maxDet = 1e-8;
+    double a = 0.0;
+    double b = 0.0;
+    double c = 0.0;
+    double d = 0.0;
+    bool foundSolution = false;
+    double x[3];
+
+    // x = [a/c; b/c; d/c]
+    if (solvePlaneFit(sums.sxx, sums.sxy, sums.sx, sums.syy, sums.sy, n, -sums.sxz, -sums.syz, -sums.sz, maxDet, x)) {
+      c = 1.0 / std::sqrt(x[0] * x[0] + x[1] * x[1] + 1.0);
+      a = x[0] * c;
+      b = x[1] * c;
+      d = x[2] * c;
+      foundSolution = true;
+    }
+
+    // x = [a/b; c/b; d/b]
+    if (solvePlaneFit(sums.sxx, sums.sxz, sums.sx, sums.szz, sums.sz, n, -sums.sxy, -sums.syz, -sums.sy, maxDet, x)) {
+      b = 1.0 / std::sqrt(x[0] * x[0] + x[1] * x[1] + 1.0);
+      a = x[0] * b;
+      c = x[1] * b;
+      d = x[2] * b;
+      foundSolution = true;
+    }
+
+    // x = [b/a; c/a; d/a]
+    if (solvePlaneFit(sums.syy, sums.syz, sums.sy, sums.szz, sums.sz, n, -sums.sxy, -sums.sxz, -sums.sx, maxDet, x)) {
+      a = 1.0 / std::sqrt(x[0] * x[0] + x[1] * x[1] + 1.0);
+      b = x[0] * a;
+      c = x[1] * a;
+      d = x[2] * a;
+      foundSolution = true;
+    }
+
+    if (!foundSolution) {
+      return boost::none;
+    }
+
+    // the fits are relative to the first vertex
+    d = d - a * sums.x0 - b * sums.y0 - c * sums.z0;
+
+    // plane outward normal should match sense of vertices
+    if (a * sums.nx + b * sums.ny + c * sums.nz < 0) {
+      a = -a;
+      b = -b;
+      c = -c;
+      d = -d;
+    }
+
+    return detail::PlaneFromCoefficients::plane(a, b, c, d);
+  }
+
+}  // namespace
+
+std::vector<boost::optional<Vector3d>> getNewallVectors(const PolygonBuffer& polygons) {
+  std::vector<boost::optional<Vector3d>> result;
+  result.reserve(polygons.numPolygons());
+  for (size_t i = 0, n = polygons.numPolygons(); i < n; ++i) {
+    result.push_back(newallVector(sumPolygon(polygons, i, false, false)));
+  }
+  return result;
+}
+
+std::vector<boost::optional<double>> getAreas(const PolygonBuffer& polygons) {
+  std::vector<boost::optional<double>> result;
+  result.reserve(polygons.numPolygons());
+  for (size_t i = 0, n = polygons.numPolygons(); i < n; ++i) {
+    boost::optional<double> area;
+    boost::optional<Vector3d> newall = newallVector(sumPolygon(polygons, i, false, false));
+    if (newall) {
+      area = newall->length() / 2.0;
+    }
+    result.push_back(area);
+  }
+  return result;
+}
+
+std::vector<boost::optional<Vector3d>> getOutwardNormals(const PolygonBuffer& polygons) {
+  std::vector<boost::optional<Vector3d>> result;
+  result.reserve(polygons.numPolygons());
+  for (size_t i = 0, n = polygons.numPolygons(); i < n; ++i) {
+    boost::optional<Vector3d> normal = newallVector(sumPolygon(polygons, i, false, false));
+    if (normal && !normal->normalize()) {
+      normal.reset();
+    }
+    result.push_back(normal);
+  }
+  return result;
+}
+
+std::vector<boost::optional<Point3d>> getCentroids(const PolygonBuffer& polygons) {
+  std::vector<boost::optional<Point3d>> result;
+  result.reserve(polygons.numPolygons());
+  for (size_t i = 0, n = polygons.numPolygons(); i < n; ++i) {
+    result.push_back(centroid(sumPolygon(polygons, i, true, false)));
+  }
+  return result;
+}
+
+std::vector<boost::optional<Plane>> getPlanes(const PolygonBuffer& polygons) {
+  std::vector<boost::optional<Plane>> result;
+  result.reserve(polygons.numPolygons());
+  for (size_t i = 0, n = polygons.numPolygons(); i < n; ++i) {
+    result.push_back(plane(sumPolygon(polygons, i, false, true), polygons, i));
+  }
+  return result;
+}
+
+std::vector<PolygonProperties> getPolygonProperties(const PolygonBuffer& polygons) {
+  std::vector<PolygonProperties> result(polygons.numPolygons());
+  for (size_t i = 0, n = polygons.numPolygons(); i < n; ++i) {
+    PolygonSums sums = sumPolygon(polygons, i, true, true);
+    PolygonProperties& properties = result[i];
+    boost::optional<Vector3d> newall = newallVector(sums);
+    if (newall) {
+      properties.area = newall->length() / 2.0;
+      if (newall->normalize()) {
+        properties.outwardNormal = newall;
+      }
+    }
+    properties.centroid = centroid(sums);
+    properties.plane = plane(sums, polygons, i);
+  }
+  return result;
+}
+
+}  // namespace openstudio
@@ -0,0 +1,127 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2021, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_GEOMETRY_POLYGONBUFFER_HPP
+#define UTILITIES_GEOMETRY_POLYGONBUFFER_HPP
+
+#include "../UtilitiesAPI.hpp"
+#include "Plane.hpp"
+#include "Point3d.hpp"
+#include "Vector3d.hpp"
+#include "../core/Logger.hpp"
+
+#include <boost/optional.hpp>
+
+#include <vector>
+
+namespace openstudio {
+
+/** PolygonBuffer stores many polygons in flat structure of arrays form.  The vertices of polygon i are the entries
+   *  offsets()[i] up to (not including) offsets()[i + 1] of x(), y() and z(), so offsets() always has numPolygons() + 1
+   *  entries and starts at 0.  The batched geometry functions below walk these arrays directly, rather than going through
+   *  a std::vector<Point3d> and a Transformation for every polygon, which makes them much cheaper than calling
+   *  getArea, getOutwardNormal, getCentroid and Plane(points) polygon by polygon for a whole building.
+   */
+class UTILITIES_API PolygonBuffer
+{
+ public:
+  /// create an empty buffer
+  PolygonBuffer();
+
+  /// create a buffer from flat arrays, throws if offsets does not start at 0, decreases or does not end at the size of x, y and z
+  PolygonBuffer(std::vector<size_t> offsets, std::vector<double> x, std::vector<double> y, std::vector<double> z);
+
+  /// reserve space for numPolygons polygons with numVertices vertices in total
+  void reserve(size_t numPolygons, size_t numVertices);
+
+  /// append a polygon, returns its index
+  size_t addPolygon(const std::vector<Point3d>& points);
+
+  /// remove all polygons
+  void clear();
+
+  size_t numPolygons() const;
+
+  /// total number of vertices over all polygons
+  size_t numVertices() const;
+
+  /// number of vertices of polygon index
+  size_t numVertices(size_t index) const;
+
+  /// vertices of polygon index
+  std::vector<Point3d> polygon(size_t index) const;
+
+  const std::vector<size_t>& offsets() const;
+
+  const std::vector<double>& x() const;
+
+  const std::vector<double>& y() const;
+
+  const std::vector<double>& z() const;
+
+ private:
+  REGISTER_LOGGER("utilities.PolygonBuffer");
+
+  std::vector<size_t> m_offsets;
+  std::vector<double> m_x;
+  std::vector<double> m_y;
+  std::vector<double> m_z;
+};
+
+/// area, outward normal, centroid and plane of one polygon, each is empty where the single polygon function would fail
+struct UTILITIES_API PolygonProperties
+{
+  boost::optional<double> area;
+  boost::optional<Vector3d> outwardNormal;
+  boost::optional<Point3d> centroid;
+  boost::optional<Plane> plane;
+};
+
+/// compute Newall vectors of all polygons, same as calling getNewallVector on each polygon
+UTILITIES_API std::vector<boost::optional<Vector3d>> getNewallVectors(const PolygonBuffer& polygons);
+
+/// compute areas of all polygons, same as calling getArea on each polygon
+UTILITIES_API std::vector<boost::optional<double>> getAreas(const PolygonBuffer& polygons);
+
+/// compute outward normals of all polygons, same as calling getOutwardNormal on each polygon
+UTILITIES_API std::vector<boost::optional<Vector3d>> getOutwardNormals(const PolygonBuffer& polygons);
+
+/// compute centroids of all polygons, agrees with getCentroid on each polygon to within rounding for planar polygons
+UTILITIES_API std::vector<boost::optional<Point3d>> getCentroids(const PolygonBuffer& polygons);
+
+/// fit planes to all polygons, agrees with Plane(points) on each polygon to within rounding, empty where Plane(points) throws
+UTILITIES_API std::vector<boost::optional<Plane>> getPlanes(const PolygonBuffer& polygons);
+
+/// compute area, outward normal, centroid and plane of all polygons, cheaper than calling the functions above one by one
+/// since the sums over each polygon's vertices are computed once and shared between the four results
+UTILITIES_API std::vector<PolygonProperties> getPolygonProperties(const PolygonBuffer& polygons);
+
+}  // namespace openstudio
+
+#endif  //UTILITIES_GEOMETRY_POLYGONBUFFER_HPP
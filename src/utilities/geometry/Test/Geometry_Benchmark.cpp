@@ -0,0 +1,151 @@
+#include <benchmark/benchmark.h>
+
+#include "../Geometry.hpp"
+#include "../Plane.hpp"
+#include "../Point3d.hpp"
+#include "../PolygonBuffer.hpp"
+#include "../Transformation.hpp"
+#include "../Vector3d.hpp"
+
+#include <cmath>
+#include <vector>
+
+using namespace openstudio;
+
+// regular n-gon of radius 10 tilted out of the xy plane, counterclockwise looking down the tilted normal
+std::vector<Point3d> makePolygon(size_t n) {
+  Transformation tilt = Transformation::rotation(Vector3d(1, 1, 0), 0.3);
+  std::vector<Point3d> result;
+  result.reserve(n);
+  for (size_t i = 0; i < n; ++i) {
+    double angle = 2.0 * 3.14159265358979323846 * static_cast<double>(i) / static_cast<double>(n);
+    result.push_back(tilt * Point3d(10.0 * std::cos(angle), 10.0 * std::sin(angle), 3.0));
+  }
+  return result;
+}
+
+static void BM_TransformPoint(benchmark::State& state) {
+  std::vector<Point3d> points = makePolygon(state.range(0));
+  Transformation transformation = Transformation::translation(Vector3d(1, 2, 3)) * Transformation::rotation(Vector3d(0, 0, 1), 0.5);
+
+  for (auto _ : state) {
+    for (const Point3d& point : points) {
+      benchmark::DoNotOptimize(transformation * point);
+    }
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+static void BM_TransformPoints(benchmark::State& state) {
+  std::vector<Point3d> points = makePolygon(state.range(0));
+  Transformation transformation = Transformation::translation(Vector3d(1, 2, 3)) * Transformation::rotation(Vector3d(0, 0, 1), 0.5);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(transformation * points);
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+static void BM_AlignFace(benchmark::State& state) {
+  std::vector<Point3d> points = makePolygon(state.range(0));
+
+  for (auto _ : state) {
+    Transformation align = Transformation::alignFace(points);
+    benchmark::DoNotOptimize(align.inverse() * points);
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+static void BM_GetArea(benchmark::State& state) {
+  std::vector<Point3d> points = makePolygon(state.range(0));
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(getArea(points));
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+static void BM_GetOutwardNormal(benchmark::State& state) {
+  std::vector<Point3d> points = makePolygon(state.range(0));
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(getOutwardNormal(points));
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+static void BM_GetCentroid(benchmark::State& state) {
+  std::vector<Point3d> points = makePolygon(state.range(0));
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(getCentroid(points));
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+// many small polygons like the surfaces of a building, each one translated away from the others
+std::vector<std::vector<Point3d>> makePolygons(size_t numPolygons) {
+  std::vector<Point3d> quad = makePolygon(4);
+  std::vector<std::vector<Point3d>> result;
+  result.reserve(numPolygons);
+  for (size_t i = 0; i < numPolygons; ++i) {
+    result.push_back(Transformation::translation(Vector3d(static_cast<double>(i % 100), static_cast<double>(i / 100), 0.0)) * quad);
+  }
+  return result;
+}
+
+static void BM_PolygonPropertiesOneByOne(benchmark::State& state) {
+  std::vector<std::vector<Point3d>> polygons = makePolygons(state.range(0));
+
+  for (auto _ : state) {
+    for (const std::vector<Point3d>& points : polygons) {
+      benchmark::DoNotOptimize(getArea(points));
+      benchmark::DoNotOptimize(getOutwardNormal(points));
+      benchmark::DoNotOptimize(getCentroid(points));
+      benchmark::DoNotOptimize(Plane(points));
+    }
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+static void BM_PolygonProperties(benchmark::State& state) {
+  PolygonBuffer polygons;
+  for (const std::vector<Point3d>& points : makePolygons(state.range(0))) {
+    polygons.addPolygon(points);
+  }
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(getPolygonProperties(polygons));
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+static void BM_PolygonAreas(benchmark::State& state) {
+  PolygonBuffer polygons;
+  for (const std::vector<Point3d>& points : makePolygons(state.range(0))) {
+    polygons.addPolygon(points);
+  }
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(getAreas(polygons));
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+BENCHMARK(BM_TransformPoint)->RangeMultiplier(4)->Range(4, 4096)->Complexity();
+
+BENCHMARK(BM_TransformPoints)->RangeMultiplier(4)->Range(4, 4096)->Complexity();
+
+BENCHMARK(BM_AlignFace)->RangeMultiplier(4)->Range(4, 4096)->Complexity();
+
+BENCHMARK(BM_GetArea)->RangeMultiplier(4)->Range(4, 4096)->Complexity();
+
+BENCHMARK(BM_GetOutwardNormal)->RangeMultiplier(4)->Range(4, 4096)->Complexity();
+
+BENCHMARK(BM_GetCentroid)->RangeMultiplier(4)->Range(4, 4096)->Complexity();
+
+BENCHMARK(BM_PolygonPropertiesOneByOne)->RangeMultiplier(8)->Range(8, 4096)->Complexity();
+
+BENCHMARK(BM_PolygonProperties)->RangeMultiplier(8)->Range(8, 4096)->Complexity();
+
+BENCHMARK(BM_PolygonAreas)->RangeMultiplier(8)->Range(8, 4096)->Complexity();
@@ -0,0 +1,61 @@
+#include <benchmark/benchmark.h>
+
+#include "../Geometry.hpp"
+#include "../Point3d.hpp"
+#include "../PointWelder.hpp"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace openstudio;
+
+// n grid points with every point repeated three times with a small jitter, so two out of three lookups weld
+std::vector<Point3d> makeWeldPoints(size_t n) {
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> jitter(-0.0002, 0.0002);
+  size_t side = 1;
+  while (side * side < n) {
+    ++side;
+  }
+
+  std::vector<Point3d> result;
+  result.reserve(3 * n);
+  for (size_t i = 0; i < n; ++i) {
+    double x = 0.5 * static_cast<double>(i % side);
+    double y = 0.5 * static_cast<double>(i / side);
+    for (int j = 0; j < 3; ++j) {
+      result.emplace_back(x + jitter(gen), y + jitter(gen), jitter(gen));
+    }
+  }
+  std::shuffle(result.begin(), result.end(), gen);
+  return result;
+}
+
+static void BM_GetCombinedPoint(benchmark::State& state) {
+  std::vector<Point3d> points = makeWeldPoints(state.range(0));
+
+  for (auto _ : state) {
+    std::vector<Point3d> allPoints;
+    for (const Point3d& point : points) {
+      benchmark::DoNotOptimize(getCombinedPoint(point, allPoints, 0.001));
+    }
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+static void BM_PointWelder(benchmark::State& state) {
+  std::vector<Point3d> points = makeWeldPoints(state.range(0));
+
+  for (auto _ : state) {
+    PointWelder welder(0.001);
+    for (const Point3d& point : points) {
+      benchmark::DoNotOptimize(welder.addPoint(point));
+    }
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+BENCHMARK(BM_GetCombinedPoint)->RangeMultiplier(4)->Range(16, 16384)->Complexity();
+
+BENCHMARK(BM_PointWelder)->RangeMultiplier(4)->Range(16, 16384)->Complexity();
@@ -0,0 +1,114 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2021, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include "GeometryFixture.hpp"
+
+#include "../Geometry.hpp"
+#include "../Point3d.hpp"
+#include "../PointWelder.hpp"
+
+#include <limits>
+#include <random>
+
+using namespace openstudio;
+
+TEST_F(GeometryFixture, PointWelder) {
+  PointWelder welder(0.01);
+  EXPECT_EQ(0.01, welder.tolerance());
+  EXPECT_EQ(0u, welder.size());
+  EXPECT_FALSE(welder.findPoint(Point3d(0, 0, 0)));
+
+  EXPECT_EQ(0u, welder.addPoint(Point3d(0, 0, 0)));
+  EXPECT_EQ(1u, welder.addPoint(Point3d(1, 0, 0)));
+  EXPECT_EQ(0u, welder.addPoint(Point3d(0.005, 0, 0)));
+  EXPECT_EQ(1u, welder.addPoint(Point3d(1, 0.005, -0.005)));
+  EXPECT_EQ(2u, welder.size());
+
+  // exactly tol away is not welded
+  EXPECT_EQ(2u, welder.addPoint(Point3d(0, 0.01, 0)));
+  EXPECT_EQ(3u, welder.size());
+
+  // the first point added wins even if a later point is closer
+  ASSERT_TRUE(welder.findPoint(Point3d(0, 0.006, 0)));
+  EXPECT_EQ(0u, welder.findPoint(Point3d(0, 0.006, 0)).get());
+  EXPECT_TRUE(Point3d(0, 0, 0) == welder.combinedPoint(Point3d(0, 0.006, 0)));
+
+  ASSERT_EQ(3u, welder.points().size());
+  EXPECT_TRUE(Point3d(0, 0, 0) == welder.points()[0]);
+  EXPECT_TRUE(Point3d(1, 0, 0) == welder.points()[1]);
+  EXPECT_TRUE(Point3d(0, 0.01, 0) == welder.points()[2]);
+
+  welder.clear();
+  EXPECT_EQ(0u, welder.size());
+  EXPECT_FALSE(welder.findPoint(Point3d(0, 0, 0)));
+  EXPECT_EQ(0.01, welder.tolerance());
+}
+
+TEST_F(GeometryFixture, PointWelder_MatchesGetCombinedPoint) {
+  // points clustered around cell boundaries so that welding often crosses cells
+  std::mt19937 gen(1234);
+  std::uniform_int_distribution<int> cell(-20, 20);
+  std::uniform_real_distribution<double> offset(-0.0015, 0.0015);
+
+  for (double tol : {0.001, 0.01, 0.0003}) {
+    PointWelder welder(tol);
+    std::vector<Point3d> allPoints;
+    for (unsigned i = 0; i < 5000; ++i) {
+      Point3d point(cell(gen) * tol + offset(gen), cell(gen) * tol + offset(gen), cell(gen) * tol + offset(gen));
+      Point3d expected = getCombinedPoint(point, allPoints, tol);
+      EXPECT_TRUE(expected == welder.combinedPoint(point));
+    }
+    ASSERT_EQ(allPoints.size(), welder.size());
+    for (size_t i = 0; i < allPoints.size(); ++i) {
+      EXPECT_TRUE(allPoints[i] == welder.points()[i]);
+    }
+  }
+}
+
+TEST_F(GeometryFixture, PointWelder_Degenerate) {
+  // zero tolerance never welds
+  PointWelder zero(0.0);
+  EXPECT_EQ(0u, zero.addPoint(Point3d(1, 2, 3)));
+  EXPECT_EQ(1u, zero.addPoint(Point3d(1, 2, 3)));
+
+  // coordinates too large for the grid are still welded
+  PointWelder welder(0.001);
+  double big = 1.0e13;
+  EXPECT_EQ(0u, welder.addPoint(Point3d(big, 0, 0)));
+  EXPECT_EQ(0u, welder.addPoint(Point3d(big, 0.0005, 0)));
+  EXPECT_EQ(1u, welder.addPoint(Point3d(0, 0, 0)));
+  EXPECT_EQ(1u, welder.addPoint(Point3d(0.0005, 0, 0)));
+
+  // NaN never welds
+  double nan = std::numeric_limits<double>::quiet_NaN();
+  EXPECT_EQ(2u, welder.addPoint(Point3d(nan, 0, 0)));
+  EXPECT_EQ(3u, welder.addPoint(Point3d(nan, 0, 0)));
+  EXPECT_EQ(4u, welder.size());
+}
@@ -0,0 +1,195 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2021, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+#include <gtest/gtest.h>
+#include "GeometryFixture.hpp"
+
+#include "../Geometry.hpp"
+#include "../Plane.hpp"
+#include "../Point3d.hpp"
+#include "../PolygonBuffer.hpp"
+#include "../Transformation.hpp"
+#include "../Vector3d.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+using namespace openstudio;
+
+TEST_F(GeometryFixture, PolygonBuffer) {
+  PolygonBuffer polygons;
+  EXPECT_EQ(0u, polygons.numPolygons());
+  EXPECT_EQ(0u, polygons.numVertices());
+  ASSERT_EQ(1u, polygons.offsets().size());
+
+  std::vector<Point3d> square{{0, 0, 0}, {1, 0, 0}, {1, 1, 0}, {0, 1, 0}};
+  std::vector<Point3d> triangle{{0, 0, 1}, {0, 0, 2}, {0, 1, 1}};
+  EXPECT_EQ(0u, polygons.addPolygon(square));
+  EXPECT_EQ(1u, polygons.addPolygon(std::vector<Point3d>()));
+  EXPECT_EQ(2u, polygons.addPolygon(triangle));
+  EXPECT_EQ(3u, polygons.numPolygons());
+  EXPECT_EQ(7u, polygons.numVertices());
+  EXPECT_EQ(4u, polygons.numVertices(0));
+  EXPECT_EQ(0u, polygons.numVertices(1));
+  EXPECT_EQ(3u, polygons.numVertices(2));
+  EXPECT_EQ(std::vector<size_t>({0, 4, 4, 7}), polygons.offsets());
+  EXPECT_EQ(square, polygons.polygon(0));
+  EXPECT_TRUE(polygons.polygon(1).empty());
+  EXPECT_EQ(triangle, polygons.polygon(2));
+
+  PolygonBuffer copy(polygons.offsets(), polygons.x(), polygons.y(), polygons.z());
+  EXPECT_EQ(3u, copy.numPolygons());
+  EXPECT_EQ(triangle, copy.polygon(2));
+
+  EXPECT_THROW(PolygonBuffer({1, 4}, polygons.x(), polygons.y(), polygons.z()), std::exception);
+  EXPECT_THROW(PolygonBuffer({0, 4, 3, 7}, polygons.x(), polygons.y(), polygons.z()), std::exception);
+  EXPECT_THROW(PolygonBuffer({0, 4, 6}, polygons.x(), polygons.y(), polygons.z()), std::exception);
+  EXPECT_THROW(PolygonBuffer({0, 7}, polygons.x(), polygons.y(), std::vector<double>()), std::exception);
+
+  polygons.clear();
+  EXPECT_EQ(0u, polygons.numPolygons());
+  EXPECT_EQ(0u, polygons.numVertices());
+}
+
+TEST_F(GeometryFixture, PolygonBuffer_Degenerate) {
+  PolygonBuffer polygons;
+  polygons.addPolygon({{0, 0, 0}, {1, 0, 0}});
+  polygons.addPolygon({{0, 0, 0}, {1, 0, 0}, {2, 0, 0}, {3, 0, 0}});
+  polygons.addPolygon({{0, 0, 0}, {1, 1, 1}, {2, 2, 2}});
+
+  std::vector<PolygonProperties> properties = getPolygonProperties(polygons);
+  ASSERT_EQ(3u, properties.size());
+
+  EXPECT_FALSE(properties[0].area);
+  EXPECT_FALSE(properties[0].outwardNormal);
+  EXPECT_FALSE(properties[0].centroid);
+  EXPECT_FALSE(properties[0].plane);
+
+  for (size_t i = 1; i < 3; ++i) {
+    ASSERT_TRUE(properties[i].area);
+    EXPECT_EQ(0.0, properties[i].area.get());
+    EXPECT_FALSE(properties[i].outwardNormal);
+    EXPECT_FALSE(properties[i].centroid);
+    EXPECT_FALSE(properties[i].plane);
+  }
+}
+
+TEST_F(GeometryFixture, PolygonBuffer_MatchesSinglePolygonFunctions) {
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> angle(0.0, 3.14159265358979323846);
+  std::uniform_real_distribution<double> coordinate(-50.0, 50.0);
+  std::uniform_real_distribution<double> size(0.5, 20.0);
+
+  // planar polygons of 3 to 12 vertices in random orientations, some convex and some not
+  std::vector<std::vector<Point3d>> allPoints;
+  for (unsigned i = 0; i < 200; ++i) {
+    unsigned n = 3 + i % 10;
+    std::vector<Point3d> facePoints;
+    for (unsigned j = 0; j < n; ++j) {
+      double theta = 2.0 * 3.14159265358979323846 * j / n;
+      double radius = size(generator) * ((i % 2 == 0) || (j % 2 == 0) ? 1.0 : 0.4);
+      facePoints.push_back(Point3d(radius * std::cos(theta), radius * std::sin(theta), 0.0));
+    }
+    if (i % 3 == 0) {
+      std::reverse(facePoints.begin(), facePoints.end());
+    }
+    Transformation t = Transformation::translation(Vector3d(coordinate(generator), coordinate(generator), coordinate(generator)))
+                       * Transformation::rotation(Vector3d(1, 0, 0), angle(generator))
+                       * Transformation::rotation(Vector3d(0, 0, 1), angle(generator));
+    allPoints.push_back(t * facePoints);
+  }
+
+  // axis aligned floor, wall and roof
+  allPoints.push_back({{0, 10, 0}, {10, 10, 0}, {10, 0, 0}, {0, 0, 0}});
+  allPoints.push_back({{0, 0, 3}, {0, 0, 0}, {10, 0, 0}, {10, 0, 3}});
+  allPoints.push_back({{10, 0, 3}, {10, 10, 3}, {0, 10, 3}, {0, 0, 3}});
+
+  PolygonBuffer polygons;
+  for (const std::vector<Point3d>& points : allPoints) {
+    polygons.addPolygon(points);
+  }
+
+  std::vector<boost::optional<Vector3d>> newallVectors = getNewallVectors(polygons);
+  std::vector<boost::optional<double>> areas = getAreas(polygons);
+  std::vector<boost::optional<Vector3d>> normals = getOutwardNormals(polygons);
+  std::vector<boost::optional<Point3d>> centroids = getCentroids(polygons);
+  std::vector<boost::optional<Plane>> planes = getPlanes(polygons);
+  std::vector<PolygonProperties> properties = getPolygonProperties(polygons);
+  ASSERT_EQ(allPoints.size(), newallVectors.size());
+  ASSERT_EQ(allPoints.size(), areas.size());
+  ASSERT_EQ(allPoints.size(), normals.size());
+  ASSERT_EQ(allPoints.size(), centroids.size());
+  ASSERT_EQ(allPoints.size(), planes.size());
+  ASSERT_EQ(allPoints.size(), properties.size());
+
+  for (size_t i = 0; i < allPoints.size(); ++i) {
+    const std::vector<Point3d>& points = allPoints[i];
+
+    boost::optional<Vector3d> newall = getNewallVector(points);
+    ASSERT_TRUE(newall);
+    ASSERT_TRUE(newallVectors[i]);
+    EXPECT_DOUBLE_EQ(newall->x(), newallVectors[i]->x());
+    EXPECT_DOUBLE_EQ(newall->y(), newallVectors[i]->y());
+    EXPECT_DOUBLE_EQ(newall->z(), newallVectors[i]->z());
+
+    boost::optional<double> area = getArea(points);
+    ASSERT_TRUE(area);
+    ASSERT_TRUE(areas[i]);
+    ASSERT_TRUE(properties[i].area);
+    EXPECT_DOUBLE_EQ(area.get(), areas[i].get());
+    EXPECT_DOUBLE_EQ(area.get(), properties[i].area.get());
+
+    boost::optional<Vector3d> normal = getOutwardNormal(points);
+    ASSERT_TRUE(normal);
+    ASSERT_TRUE(normals[i]);
+    ASSERT_TRUE(properties[i].outwardNormal);
+    EXPECT_DOUBLE_EQ(normal->x(), normals[i]->x());
+    EXPECT_DOUBLE_EQ(normal->y(), normals[i]->y());
+    EXPECT_DOUBLE_EQ(normal->z(), normals[i]->z());
+    EXPECT_DOUBLE_EQ(normal->x(), properties[i].outwardNormal->x());
+    EXPECT_DOUBLE_EQ(normal->y(), properties[i].outwardNormal->y());
+    EXPECT_DOUBLE_EQ(normal->z(), properties[i].outwardNormal->z());
+
+    boost::optional<Point3d> centroid = getCentroid(points);
+    ASSERT_TRUE(centroid);
+    ASSERT_TRUE(centroids[i]);
+    ASSERT_TRUE(properties[i].centroid);
+    EXPECT_NEAR(0.0, getDistance(centroid.get(), centroids[i].get()), 1.0e-9);
+    EXPECT_NEAR(0.0, getDistance(centroid.get(), properties[i].centroid.get()), 1.0e-9);
+
+    Plane plane(points);
+    ASSERT_TRUE(planes[i]);
+    ASSERT_TRUE(properties[i].plane);
+    EXPECT_NEAR(plane.a(), planes[i]->a(), 1.0e-9);
+    EXPECT_NEAR(plane.b(), planes[i]->b(), 1.0e-9);
+    EXPECT_NEAR(plane.c(), planes[i]->c(), 1.0e-9);
+    EXPECT_NEAR(plane.d(), planes[i]->d(), 1.0e-9);
+    EXPECT_TRUE(plane.equal(properties[i].plane.get(), 1.0e-9));
+  }
+}
@@ -32,6 +32,8 @@
 
 #include "../ThreeJS.hpp"
 
+#include <json/json.h>
+
 #include <resources.hxx>
 
 using namespace openstudio;
@@ -60,3 +62,129 @@ TEST_F(GeometryFixture, ThreeJS) {
   scene = ThreeScene::load(toString(p));
   ASSERT_TRUE(scene);
 }
+
+TEST_F(GeometryFixture, ThreeJS_PrintJSON) {
+  openstudio::path p = resourcesPath() / toPath("utilities/Geometry/threejs.json");
+  boost::optional<ThreeScene> scene = ThreeScene::load(toString(p));
+  ASSERT_TRUE(scene);
+
+  // toJSON(true) still builds the document as a Json::Value, rewriting it compactly gives what jsoncpp
+  // used to write for toJSON(false), the streamed JSON must match it byte for byte
+  Json::CharReaderBuilder rbuilder;
+  std::string formattedErrors;
+  Json::Value expectedRoot;
+  std::istringstream prettyStream(scene->toJSON(true));
+  ASSERT_TRUE(Json::parseFromStream(rbuilder, prettyStream, &expectedRoot, &formattedErrors));
+
+  Json::StreamWriterBuilder wbuilder;
+  wbuilder["commentStyle"] = "None";
+  wbuilder["indentation"] = "";
+  std::string expected = Json::writeString(wbuilder, expectedRoot);
+
+  std::stringstream ss;
+  scene->printJSON(ss);
+  EXPECT_EQ(expected, ss.str());
+
+  std::string json = scene->toJSON(false);
+  EXPECT_EQ(expected, json);
+
+  // and parse back to the same document
+  Json::Value root;
+  std::istringstream iss(json);
+  ASSERT_TRUE(Json::parseFromStream(rbuilder, iss, &root, &formattedErrors));
+  EXPECT_EQ(expectedRoot, root);
+
+  boost::optional<ThreeScene> scene2 = ThreeScene::load(json);
+  ASSERT_TRUE(scene2);
+  EXPECT_EQ(json, scene2->toJSON(false));
+  EXPECT_EQ(scene->toJSON(true), scene2->toJSON(true));
+}
+
+TEST_F(GeometryFixture, ThreeJS_PrintGLB) {
+  // L shaped OpenStudio polygon, needs a real triangulation rather than a fan
+  std::vector<double> lVertices{2, 0, 0, 2, 0, -1, 1, 0, -1, 1, 0, -2, 0, 0, -2, 0, 0, 0};
+  std::vector<size_t> lFaces{openstudioFaceFormatId(), 0, 1, 2, 3, 4, 5};
+  ThreeGeometry lGeometry("lGeometry", "Geometry", ThreeGeometryData(lVertices, lFaces));
+
+  std::vector<double> triVertices{0, 1, 0, 1, 1, 0, 0, 2, 0};
+  std::vector<size_t> triFaces{0, 0, 1, 2};
+  ThreeGeometry triGeometry("triGeometry", "Geometry", ThreeGeometryData(triVertices, triFaces));
+
+  std::vector<ThreeMaterial> materials = makeStandardThreeMaterials();
+  ASSERT_FALSE(materials.empty());
+
+  ThreeUserData userData;
+  std::vector<ThreeSceneChild> children{ThreeSceneChild("lChild", "L", "Mesh", "lGeometry", materials[0].uuid(), userData),
+                                        ThreeSceneChild("triChild", "Triangle", "Mesh", "triGeometry", materials[0].uuid(), userData)};
+  ThreeSceneMetadata metadata(std::vector<std::string>(), ThreeBoundingBox(0, 0, 0, 0, 0, 0, 0, 0, 0, 0), 0.0,
+                              std::vector<ThreeModelObjectMetadata>());
+  ThreeScene scene(metadata, {lGeometry, triGeometry}, materials, ThreeSceneObject("scene", children));
+
+  std::stringstream ss;
+  scene.printGLB(ss);
+  std::string glb = ss.str();
+
+  auto readUInt32 = [&glb](size_t offset) {
+    return static_cast<unsigned>(static_cast<unsigned char>(glb[offset])) | (static_cast<unsigned>(static_cast<unsigned char>(glb[offset + 1])) << 8)
+           | (static_cast<unsigned>(static_cast<unsigned char>(glb[offset + 2])) << 16)
+           | (static_cast<unsigned>(static_cast<unsigned char>(glb[offset + 3])) << 24);
+  };
+
+  ASSERT_GT(glb.size(), 20u);
+  EXPECT_EQ("glTF", glb.substr(0, 4));
+  EXPECT_EQ(2u, readUInt32(4));
+  EXPECT_EQ(glb.size(), readUInt32(8));
+
+  unsigned jsonLength = readUInt32(12);
+  EXPECT_EQ(0u, jsonLength % 4);
+  EXPECT_EQ("JSON", glb.substr(16, 4));
+
+  Json::CharReaderBuilder rbuilder;
+  std::istringstream iss(glb.substr(20, jsonLength));
+  Json::Value gltf;
+  std::string formattedErrors;
+  ASSERT_TRUE(Json::parseFromStream(rbuilder, iss, &gltf, &formattedErrors));
+
+  EXPECT_EQ("2.0", gltf["asset"]["version"].asString());
+  ASSERT_EQ(3u, gltf["nodes"].size());
+  EXPECT_EQ(2u, gltf["nodes"][0]["children"].size());
+  ASSERT_EQ(2u, gltf["meshes"].size());
+  EXPECT_EQ(materials.size(), gltf["materials"].size());
+
+  // 6 vertices and 4 triangles for the L, 3 vertices and 1 triangle for the triangle
+  ASSERT_EQ(4u, gltf["accessors"].size());
+  EXPECT_EQ(6u, gltf["accessors"][0]["count"].asUInt());
+  EXPECT_EQ(12u, gltf["accessors"][1]["count"].asUInt());
+  EXPECT_EQ(3u, gltf["accessors"][2]["count"].asUInt());
+  EXPECT_EQ(3u, gltf["accessors"][3]["count"].asUInt());
+  EXPECT_EQ(2.0, gltf["accessors"][0]["max"][0].asDouble());
+  EXPECT_EQ(-2.0, gltf["accessors"][0]["min"][2].asDouble());
+
+  unsigned binLength = readUInt32(20 + jsonLength);
+  EXPECT_EQ("BIN", glb.substr(24 + jsonLength, 3));
+  EXPECT_EQ(gltf["buffers"][0]["byteLength"].asUInt(), binLength);
+  EXPECT_EQ((6 * 3 + 12 + 3 * 3 + 3) * 4u, binLength);
+  EXPECT_EQ(glb.size(), 28 + jsonLength + binLength);
+
+  // every triangle of the L lies inside the L with the same winding, so the triangle areas add up to the L area
+  size_t bin = 28 + jsonLength;
+  auto vertex = [&](unsigned i) {
+    float xyz[3];
+    for (unsigned c = 0; c < 3; ++c) {
+      unsigned u = readUInt32(bin + 12 * i + 4 * c);
+      std::memcpy(&xyz[c], &u, sizeof(u));
+    }
+    return Point3d(xyz[0], xyz[1], xyz[2]);
+  };
+  double area = 0;
+  for (unsigned t = 0; t < 4; ++t) {
+    Point3d a = vertex(readUInt32(bin + 72 + 12 * t));
+    Point3d b = vertex(readUInt32(bin + 72 + 12 * t + 4));
+    Point3d c = vertex(readUInt32(bin + 72 + 12 * t + 8));
+    double signedArea = 0.5 * ((b.x() - a.x()) * (c.z() - a.z()) - (c.x() - a.x()) * (b.z() - a.z()));
+    // the L is clockwise looking down the y axis
+    EXPECT_LT(signedArea, 0.0);
+    area += std::abs(signedArea);
+  }
+  EXPECT_NEAR(3.0, area, 1e-9);
+}
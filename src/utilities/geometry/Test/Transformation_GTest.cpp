@@ -34,6 +34,7 @@
 #include "../Point3d.hpp"
 #include "../Vector3d.hpp"
 #include "../EulerAngles.hpp"
+#include "../Geometry.hpp"
 
 #include <boost/math/constants/constants.hpp>
 
@@ -582,3 +583,28 @@ TEST_F(GeometryFixture, Transformation_Decompose) {
 
   EXPECT_TRUE(transformation.matrix() == test.matrix()) << transformation.matrix() << '\n' << test.matrix();
 }
+
+TEST_F(GeometryFixture, Transformation_Storage) {
+  Transformation transformation = Transformation::translation(Vector3d(1, 2, 3)) * Transformation::rotation(Vector3d(1, 1, 1), degToRad(30));
+
+  // matrix and vector representations round trip
+  Matrix matrix = transformation.matrix();
+  EXPECT_TRUE(matrix == Transformation(matrix).matrix());
+  Vector vector = transformation.vector();
+  ASSERT_EQ(16u, vector.size());
+  EXPECT_TRUE(matrix == Transformation(vector).matrix()) << matrix << '\n' << Transformation(vector).matrix();
+  for (unsigned i = 0; i < 4; ++i) {
+    for (unsigned j = 0; j < 4; ++j) {
+      EXPECT_EQ(matrix(i, j), vector[4 * j + i]);
+    }
+  }
+
+  // batch transform matches transforming each point
+  std::vector<Point3d> points{Point3d(0, 0, 0), Point3d(1, 0, 0), Point3d(1, 1, 0), Point3d(-2, 3.5, 7)};
+  std::vector<Point3d> transformed = transformation * points;
+  ASSERT_EQ(points.size(), transformed.size());
+  for (unsigned i = 0; i < points.size(); ++i) {
+    EXPECT_EQ(transformation * points[i], transformed[i]);
+  }
+  EXPECT_TRUE(circularEqual(points, transformation.inverse() * transformed, 1.0e-12));
+}
@@ -28,16 +28,29 @@
 ***********************************************************************************************************************/
 
 #include "ThreeJS.hpp"
+#include "Geometry.hpp"
+#include "PointWelder.hpp"
+#include "Vector3d.hpp"
 
 #include "../core/Assert.hpp"
 #include "../core/Compare.hpp"
 #include "../core/Path.hpp"
 #include "../core/Json.hpp"
 #include "../core/UUID.hpp"
+#include "../core/Filesystem.hpp"
+#include "../core/PathHelpers.hpp"
 
 #include <json/json.h>
 
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
 #include <iostream>
+#include <limits>
+#include <memory>
+#include <sstream>
 #include <string>
 
 namespace openstudio {
@@ -261,6 +274,263 @@ Transformation toThreeMatrix(const std::vector<double>& matrix) {
   return Transformation();
 }
 
+namespace {
+
+  // writes JSON text to a stream in large chunks, scalars are formatted exactly as jsoncpp formats them
+  class JsonChunkWriter
+  {
+   public:
+    explicit JsonChunkWriter(std::ostream& os) : m_os(os) {
+      m_buffer.reserve(chunkSize + 64);
+    }
+
+    void raw(const char* s) {
+      m_buffer.append(s);
+      flushIfFull();
+    }
+
+    void raw(const std::string& s) {
+      m_buffer.append(s);
+      flushIfFull();
+    }
+
+    void quoted(const std::string& s) {
+      raw(Json::valueToQuotedString(s.c_str()));
+    }
+
+    void boolean(bool b) {
+      raw(b ? "true" : "false");
+    }
+
+    void number(unsigned u) {
+      char buffer[16];
+      auto [end, ec] = std::to_chars(buffer, buffer + sizeof(buffer), u);
+      m_buffer.append(buffer, end);
+      flushIfFull();
+    }
+
+    // same as Json::valueToString(double) with the default 17 significant digits
+    void number(double d) {
+      if (!std::isfinite(d)) {
+        raw(std::isnan(d) ? "null" : (d < 0 ? "-1e+9999" : "1e+9999"));
+        return;
+      }
+      char buffer[40];
+      int n = std::snprintf(buffer, sizeof(buffer), "%.17g", d);
+      bool hasPointOrExponent = false;
+      for (int i = 0; i < n; ++i) {
+        if (buffer[i] == ',') {
+          buffer[i] = '.';
+        }
+        if (buffer[i] == '.' || buffer[i] == 'e') {
+          hasPointOrExponent = true;
+        }
+      }
+      m_buffer.append(buffer, n);
+      if (!hasPointOrExponent) {
+        m_buffer.append(".0");
+      }
+      flushIfFull();
+    }
+
+    void value(const Json::Value& value, Json::StreamWriter& writer) {
+      flush();
+      writer.write(value, &m_os);
+    }
+
+    void flush() {
+      m_os.write(m_buffer.data(), m_buffer.size());
+      m_buffer.clear();
+    }
+
+   private:
+    static constexpr size_t chunkSize = 65536;
+
+    void flushIfFull() {
+      if (m_buffer.size() >= chunkSize) {
+        flush();
+      }
+    }
+
+    std::ostream& m_os;
+    std::string m_buffer;
+  };
+
+  // writes little endian binary data to a stream in large chunks
+  class BinaryChunkWriter
+  {
+   public:
+    explicit BinaryChunkWriter(std::ostream& os) : m_os(os) {
+      m_buffer.reserve(chunkSize);
+    }
+
+    void uint32(std::uint32_t u) {
+      m_buffer.push_back(static_cast<char>(u & 0xFF));
+      m_buffer.push_back(static_cast<char>((u >> 8) & 0xFF));
+      m_buffer.push_back(static_cast<char>((u >> 16) & 0xFF));
+      m_buffer.push_back(static_cast<char>((u >> 24) & 0xFF));
+      if (m_buffer.size() >= chunkSize) {
+        flush();
+      }
+    }
+
+    void float32(float f) {
+      std::uint32_t u;
+      static_assert(sizeof(u) == sizeof(f), "float must be 32 bits");
+      std::memcpy(&u, &f, sizeof(u));
+      uint32(u);
+    }
+
+    void bytes(const std::string& s) {
+      m_buffer.append(s);
+      flush();
+    }
+
+    void flush() {
+      m_os.write(m_buffer.data(), m_buffer.size());
+      m_buffer.clear();
+    }
+
+   private:
+    static constexpr size_t chunkSize = 65536;
+
+    std::ostream& m_os;
+    std::string m_buffer;
+  };
+
+  Point3d threeVertex(const std::vector<double>& vertices, size_t index) {
+    return Point3d(vertices[3 * index], vertices[3 * index + 1], vertices[3 * index + 2]);
+  }
+
+  // appends triangles for an OpenStudio polygon face, triangles keep the winding of the polygon
+  void appendPolygonTriangles(const std::vector<double>& vertices, const std::vector<std::uint32_t>& polygon, std::vector<std::uint32_t>& result) {
+    if (polygon.size() < 3) {
+      return;
+    }
+
+    Point3dVector points;
+    for (std::uint32_t index : polygon) {
+      points.push_back(threeVertex(vertices, index));
+    }
+
+    std::vector<std::vector<Point3d>> triangles;
+    Point3dVector facePoints;
+    if (polygon.size() > 3 && getOutwardNormal(points)) {
+      // in face coordinates the polygon is counterclockwise, computeTriangulation wants clockwise
+      facePoints = Transformation::alignFace(points).inverse() * points;
+      triangles = computeTriangulation(reverse(facePoints), std::vector<std::vector<Point3d>>());
+    }
+
+    // computeTriangulation returns the original points, map them back to positions in the polygon
+    PointWelder welder;
+    std::vector<size_t> positions;
+    for (size_t i = 0; i < facePoints.size(); ++i) {
+      if (welder.addPoint(facePoints[i]) == positions.size()) {
+        positions.push_back(i);
+      }
+    }
+
+    bool triangulated = !triangles.empty();
+    std::vector<std::uint32_t> polygonTriangles;
+    for (const auto& triangle : triangles) {
+      if (triangle.size() != 3) {
+        triangulated = false;
+        break;
+      }
+      size_t t[3];
+      for (unsigned i = 0; i < 3 && triangulated; ++i) {
+        boost::optional<size_t> index = welder.findPoint(triangle[i]);
+        if (index) {
+          t[i] = positions[*index];
+        } else {
+          triangulated = false;
+        }
+      }
+      if (!triangulated) {
+        break;
+      }
+      // signed area in face coordinates, positive is counterclockwise like the polygon
+      const Point3d& a = facePoints[t[0]];
+      const Point3d& b = facePoints[t[1]];
+      const Point3d& c = facePoints[t[2]];
+      if ((b.x() - a.x()) * (c.y() - a.y()) - (c.x() - a.x()) * (b.y() - a.y()) < 0) {
+        std::swap(t[1], t[2]);
+      }
+      polygonTriangles.insert(polygonTriangles.end(), {polygon[t[0]], polygon[t[1]], polygon[t[2]]});
+    }
+
+    if (!triangulated) {
+      // triangles, degenerate polygons and anything the triangulation fails on are fanned
+      polygonTriangles.clear();
+      for (size_t i = 1; i + 1 < polygon.size(); ++i) {
+        polygonTriangles.insert(polygonTriangles.end(), {polygon[0], polygon[i], polygon[i + 1]});
+      }
+    }
+
+    result.insert(result.end(), polygonTriangles.begin(), polygonTriangles.end());
+  }
+
+  /// triangle vertex indices for three.js faces, supports triangles, quads and OpenStudio polygons
+  /// returns an empty vector if the faces use another format or reference missing vertices
+  std::vector<std::uint32_t> threeTriangles(const ThreeGeometry& geometry, const std::vector<double>& vertices, const std::vector<size_t>& faces) {
+    std::vector<std::uint32_t> result;
+    const size_t numVertices = vertices.size() / 3;
+    const size_t n = faces.size();
+
+    auto vertexIndex = [&](size_t i) -> boost::optional<std::uint32_t> {
+      if (i >= n || faces[i] >= numVertices) {
+        return boost::none;
+      }
+      return static_cast<std::uint32_t>(faces[i]);
+    };
+
+    size_t i = 0;
+    while (i < n) {
+      const size_t format = faces[i];
+      std::vector<std::uint32_t> polygon;
+      size_t numIndices = 0;
+      if (format == 0) {
+        numIndices = 3;
+      } else if (format == 1) {
+        numIndices = 4;
+      } else if (format == openstudioFaceFormatId()) {
+        // all remaining vertices belong to one face
+        numIndices = n - i - 1;
+      } else {
+        LOG_FREE(Warn, "utilities.geometry.ThreeScene", "Geometry '" << geometry.uuid() << "' uses unsupported face format " << format);
+        return std::vector<std::uint32_t>();
+      }
+
+      for (size_t j = 1; j <= numIndices; ++j) {
+        boost::optional<std::uint32_t> index = vertexIndex(i + j);
+        if (!index) {
+          LOG_FREE(Warn, "utilities.geometry.ThreeScene", "Geometry '" << geometry.uuid() << "' has a face with a missing vertex");
+          return std::vector<std::uint32_t>();
+        }
+        polygon.push_back(*index);
+      }
+
+      if (format == 0) {
+        result.insert(result.end(), polygon.begin(), polygon.end());
+      } else if (format == 1) {
+        result.insert(result.end(), {polygon[0], polygon[1], polygon[2], polygon[0], polygon[2], polygon[3]});
+      } else {
+        appendPolygonTriangles(vertices, polygon, result);
+      }
+
+      i += numIndices + 1;
+    }
+
+    return result;
+  }
+
+  bool isIdentityMatrix(const std::vector<double>& matrix) {
+    static const std::vector<double> identity{1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1};
+    return matrix.empty() || matrix == identity;
+  }
+
+}  // namespace
+
 ThreeScene::ThreeScene(const ThreeSceneMetadata& metadata, const std::vector<ThreeGeometry>& geometries, const std::vector<ThreeMaterial>& materials,
                        const ThreeSceneObject& sceneObject)
   : m_metadata(metadata), m_geometries(geometries), m_materials(materials), m_sceneObject(sceneObject) {}
@@ -322,6 +592,12 @@ boost::optional<ThreeScene> ThreeScene::load(const std::string& json) {
 }
 
 std::string ThreeScene::toJSON(bool prettyPrint) const {
+  if (!prettyPrint) {
+    std::ostringstream ss;
+    printJSON(ss);
+    return ss.str();
+  }
+
   Json::Value scene(Json::objectValue);
 
   // metadata
@@ -347,22 +623,317 @@ std::string ThreeScene::toJSON(bool prettyPrint) const {
   // write to string
   Json::StreamWriterBuilder wbuilder;
 
-  if (prettyPrint) {
-    // mimic the old StyledWriter behavior:
-    wbuilder["commentStyle"] = "All";
-    // From source, it seems indentation was set to 3 spaces, rather than the new default of '\t'
-    wbuilder["indentation"] = "   ";
-  } else {
-    // mimic the old FastWriter behavior:
-    wbuilder["commentStyle"] = "None";
-    wbuilder["indentation"] = "";
-  }
+  // mimic the old StyledWriter behavior:
+  wbuilder["commentStyle"] = "All";
+  // From source, it seems indentation was set to 3 spaces, rather than the new default of '\t'
+  wbuilder["indentation"] = "   ";
 
   std::string result = Json::writeString(wbuilder, scene);
 
   return result;
 }
 
+std::ostream& ThreeScene::printJSON(std::ostream& os) const {
+  // mimic the old FastWriter behavior:
+  Json::StreamWriterBuilder wbuilder;
+  wbuilder["commentStyle"] = "None";
+  wbuilder["indentation"] = "";
+  std::unique_ptr<Json::StreamWriter> writer(wbuilder.newStreamWriter());
+
+  // members are written in sorted order, the same order jsoncpp writes an object in
+  JsonChunkWriter out(os);
+  out.raw("{\"geometries\":[");
+  for (size_t i = 0; i < m_geometries.size(); ++i) {
+    const ThreeGeometry& geometry = m_geometries[i];
+    const ThreeGeometryData& data = geometry.m_data;
+    if (i > 0) {
+      out.raw(",");
+    }
+
+    out.raw("{\"data\":{\"castShadow\":");
+    out.boolean(data.m_castShadow);
+    out.raw(",\"doubleSided\":");
+    out.boolean(data.m_doubleSided);
+
+    out.raw(",\"faces\":[");
+    for (size_t j = 0; j < data.m_faces.size(); ++j) {
+      if (j > 0) {
+        out.raw(",");
+      }
+      out.number(static_cast<unsigned>(data.m_faces[j]));
+    }
+
+    // normals and uvs are not written, same as ThreeGeometryData::toJsonValue
+    out.raw("],\"normals\":[],\"receiveShadow\":");
+    out.boolean(data.m_receiveShadow);
+    out.raw(",\"scale\":");
+    out.number(data.m_scale);
+
+    out.raw(",\"uvs\":[],\"vertices\":[");
+    for (size_t j = 0; j < data.m_vertices.size(); ++j) {
+      if (j > 0) {
+        out.raw(",");
+      }
+      out.number(data.m_vertices[j]);
+    }
+
+    out.raw("],\"visible\":");
+    out.boolean(data.m_visible);
+    out.raw("},\"type\":");
+    out.quoted(geometry.m_type);
+    out.raw(",\"uuid\":");
+    out.quoted(geometry.m_uuid);
+    out.raw("}");
+  }
+
+  out.raw("],\"materials\":[");
+  for (size_t i = 0; i < m_materials.size(); ++i) {
+    if (i > 0) {
+      out.raw(",");
+    }
+    out.value(m_materials[i].toJsonValue(), *writer);
+  }
+
+  out.raw("],\"metadata\":");
+  out.value(m_metadata.toJsonValue(), *writer);
+  out.raw(",\"object\":");
+  out.value(m_sceneObject.toJsonValue(), *writer);
+  out.raw("}");
+  out.flush();
+
+  return os;
+}
+
+std::ostream& ThreeScene::printGLB(std::ostream& os) const {
+  // glTF component types and buffer targets
+  const unsigned floatComponent = 5126;
+  const unsigned unsignedIntComponent = 5125;
+  const unsigned arrayBufferTarget = 34962;
+  const unsigned elementArrayBufferTarget = 34963;
+  const unsigned trianglesMode = 4;
+
+  // triangulate everything up front, the JSON chunk needs every buffer length before any geometry is written
+  std::vector<std::vector<std::uint32_t>> triangles;
+  std::map<std::string, Json::ArrayIndex> geometryAccessors;
+  Json::Value accessors(Json::arrayValue);
+  Json::Value bufferViews(Json::arrayValue);
+  std::uint64_t binLength = 0;
+
+  auto addBufferView = [&](std::uint64_t byteLength, unsigned target) {
+    Json::Value bufferView(Json::objectValue);
+    bufferView["buffer"] = 0;
+    bufferView["byteOffset"] = Json::UInt64(binLength);
+    bufferView["byteLength"] = Json::UInt64(byteLength);
+    bufferView["target"] = target;
+    bufferViews.append(bufferView);
+    binLength += byteLength;
+    return bufferViews.size() - 1;
+  };
+
+  for (const auto& geometry : m_geometries) {
+    const std::vector<double>& vertices = geometry.m_data.m_vertices;
+    triangles.push_back(threeTriangles(geometry, vertices, geometry.m_data.m_faces));
+    const size_t numVertices = vertices.size() / 3;
+    if (triangles.back().empty()) {
+      continue;
+    }
+
+    // POSITION accessors must have bounds
+    Json::Value minValue(Json::arrayValue);
+    Json::Value maxValue(Json::arrayValue);
+    for (size_t c = 0; c < 3; ++c) {
+      float minC = static_cast<float>(vertices[c]);
+      float maxC = minC;
+      for (size_t i = 1; i < numVertices; ++i) {
+        float v = static_cast<float>(vertices[3 * i + c]);
+        minC = std::min(minC, v);
+        maxC = std::max(maxC, v);
+      }
+      minValue.append(minC);
+      maxValue.append(maxC);
+    }
+
+    Json::Value positions(Json::objectValue);
+    positions["bufferView"] = addBufferView(12 * std::uint64_t(numVertices), arrayBufferTarget);
+    positions["componentType"] = floatComponent;
+    positions["count"] = Json::UInt64(numVertices);
+    positions["type"] = "VEC3";
+    positions["min"] = minValue;
+    positions["max"] = maxValue;
+    geometryAccessors[geometry.m_uuid] = accessors.size();
+    accessors.append(positions);
+
+    Json::Value indices(Json::objectValue);
+    indices["bufferView"] = addBufferView(4 * std::uint64_t(triangles.back().size()), elementArrayBufferTarget);
+    indices["componentType"] = unsignedIntComponent;
+    indices["count"] = Json::UInt64(triangles.back().size());
+    indices["type"] = "SCALAR";
+    accessors.append(indices);
+  }
+
+  std::map<std::string, Json::ArrayIndex> materialIndices;
+  Json::Value materials(Json::arrayValue);
+  for (const auto& material : m_materials) {
+    Json::Value baseColor(Json::arrayValue);
+    baseColor.append(((material.m_color >> 16) & 0xFF) / 255.0);
+    baseColor.append(((material.m_color >> 8) & 0xFF) / 255.0);
+    baseColor.append((material.m_color & 0xFF) / 255.0);
+    baseColor.append(material.m_opacity);
+
+    Json::Value pbr(Json::objectValue);
+    pbr["baseColorFactor"] = baseColor;
+    pbr["metallicFactor"] = 0.0;
+    pbr["roughnessFactor"] = 1.0;
+
+    Json::Value gltfMaterial(Json::objectValue);
+    gltfMaterial["name"] = material.m_name;
+    gltfMaterial["pbrMetallicRoughness"] = pbr;
+    gltfMaterial["doubleSided"] = (material.m_side == ThreeSide::DoubleSide);
+    if (material.m_transparent || material.m_opacity < 1) {
+      gltfMaterial["alphaMode"] = "BLEND";
+    }
+    materialIndices[material.m_uuid] = materials.size();
+    materials.append(gltfMaterial);
+  }
+
+  // node 0 is the scene object, its children are the scene children
+  Json::Value nodes(Json::arrayValue);
+  Json::Value meshes(Json::arrayValue);
+  Json::Value rootNode(Json::objectValue);
+  rootNode["name"] = m_sceneObject.m_uuid;
+  if (!isIdentityMatrix(m_sceneObject.m_matrix) && m_sceneObject.m_matrix.size() == 16) {
+    for (double d : m_sceneObject.m_matrix) {
+      rootNode["matrix"].append(d);
+    }
+  }
+  nodes.append(rootNode);
+
+  for (const auto& child : m_sceneObject.m_children) {
+    Json::Value node(Json::objectValue);
+    node["name"] = child.name();
+
+    std::vector<double> matrix = child.matrix();
+    if (!isIdentityMatrix(matrix) && matrix.size() == 16) {
+      for (double d : matrix) {
+        node["matrix"].append(d);
+      }
+    }
+
+    auto accessorIt = geometryAccessors.find(child.geometry());
+    if (accessorIt != geometryAccessors.end()) {
+      Json::Value primitive(Json::objectValue);
+      primitive["attributes"]["POSITION"] = accessorIt->second;
+      primitive["indices"] = accessorIt->second + 1;
+      primitive["mode"] = trianglesMode;
+      auto materialIt = materialIndices.find(child.material());
+      if (materialIt != materialIndices.end()) {
+        primitive["material"] = materialIt->second;
+      }
+
+      Json::Value mesh(Json::objectValue);
+      mesh["name"] = child.uuid();
+      mesh["primitives"].append(primitive);
+      node["mesh"] = meshes.size();
+      meshes.append(mesh);
+    }
+
+    nodes[0]["children"].append(nodes.size());
+    nodes.append(node);
+  }
+
+  // empty arrays are not allowed in glTF
+  Json::Value gltf(Json::objectValue);
+  gltf["asset"]["version"] = "2.0";
+  gltf["asset"]["generator"] = "OpenStudio";
+  gltf["scene"] = 0;
+  gltf["scenes"][0]["nodes"][0] = 0;
+  gltf["nodes"] = nodes;
+  if (!meshes.empty()) {
+    gltf["meshes"] = meshes;
+  }
+  if (!materials.empty()) {
+    gltf["materials"] = materials;
+  }
+  if (!accessors.empty()) {
+    gltf["accessors"] = accessors;
+    gltf["bufferViews"] = bufferViews;
+    gltf["buffers"][0]["byteLength"] = Json::UInt64(binLength);
+  }
+
+  Json::StreamWriterBuilder wbuilder;
+  wbuilder["commentStyle"] = "None";
+  wbuilder["indentation"] = "";
+  std::string json = Json::writeString(wbuilder, gltf);
+
+  // chunks are 4 byte aligned, JSON is padded with spaces
+  json.append((4 - json.size() % 4) % 4, ' ');
+
+  std::uint64_t totalLength = 12 + 8 + json.size();
+  if (binLength > 0) {
+    totalLength += 8 + binLength;
+  }
+  if (totalLength > std::numeric_limits<std::uint32_t>::max()) {
+    LOG_AND_THROW("ThreeScene is too large for a binary glTF file (" << totalLength << " bytes)");
+  }
+
+  BinaryChunkWriter out(os);
+
+  // header, magic is 'glTF'
+  out.uint32(0x46546C67);
+  out.uint32(2);
+  out.uint32(static_cast<std::uint32_t>(totalLength));
+
+  // JSON chunk
+  out.uint32(static_cast<std::uint32_t>(json.size()));
+  out.uint32(0x4E4F534A);
+  out.bytes(json);
+
+  // BIN chunk, in the same order as the buffer views
+  if (binLength > 0) {
+    out.uint32(static_cast<std::uint32_t>(binLength));
+    out.uint32(0x004E4942);
+    for (size_t i = 0; i < m_geometries.size(); ++i) {
+      if (triangles[i].empty()) {
+        continue;
+      }
+      const std::vector<double>& vertices = m_geometries[i].m_data.m_vertices;
+      for (size_t j = 0; j < 3 * (vertices.size() / 3); ++j) {
+        out.float32(static_cast<float>(vertices[j]));
+      }
+      for (std::uint32_t index : triangles[i]) {
+        out.uint32(index);
+      }
+    }
+  }
+  out.flush();
+
+  return os;
+}
+
+bool ThreeScene::saveGLB(const openstudio::path& p, bool overwrite) const {
+  if (!overwrite && openstudio::filesystem::exists(p)) {
+    LOG(Info, "Save method failed because instructed not to overwrite path '" << toString(p) << "'.");
+    return false;
+  }
+
+  if (makeParentFolder(p)) {
+    openstudio::filesystem::ofstream outFile(p, std::ios_base::binary);
+    if (outFile) {
+      try {
+        printGLB(outFile);
+        outFile.close();
+        return true;
+      } catch (...) {
+        LOG(Error, "Unable to write file to path '" << toString(p) << "'.");
+        return false;
+      }
+    }
+  }
+
+  LOG(Error, "Unable to write file to path '" << toString(p) << "'.");
+  return false;
+}
+
 ThreeSceneMetadata ThreeScene::metadata() const {
   return m_metadata;
 }
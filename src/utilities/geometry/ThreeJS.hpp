@@ -36,7 +36,9 @@
 #include "Transformation.hpp"
 
 #include "../core/Logger.hpp"
+#include "../core/Path.hpp"
 
+#include <iosfwd>
 #include <vector>
 #include <map>
 #include <boost/optional.hpp>
@@ -119,6 +121,7 @@ class UTILITIES_API ThreeGeometryData
 
  private:
   friend class ThreeGeometry;
+  friend class ThreeScene;
   ThreeGeometryData(const Json::Value& value);
   Json::Value toJsonValue() const;
 
@@ -556,6 +559,17 @@ class UTILITIES_API ThreeScene
   /// print to JSON
   std::string toJSON(bool prettyPrint = false) const;
 
+  /// print compact JSON to a stream, same output as toJSON(false) but geometry arrays are written directly
+  /// instead of being built up as Json::Values first
+  std::ostream& printJSON(std::ostream& os) const;
+
+  /** print as binary glTF 2.0 (.glb) with float32 positions and uint32 triangle indices, one mesh per scene child.
+   *  OpenStudio polygon faces are triangulated, geometry buffers are streamed rather than assembled in memory. */
+  std::ostream& printGLB(std::ostream& os) const;
+
+  /// save as binary glTF 2.0 (.glb)
+  bool saveGLB(const openstudio::path& p, bool overwrite = false) const;
+
   ThreeSceneMetadata metadata() const;
   std::vector<ThreeGeometry> geometries() const;
   boost::optional<ThreeGeometry> getGeometry(const std::string& geometryId) const;
@@ -42,78 +42,84 @@
 
 #include <math.h>
 
-using boost::numeric::ublas::identity_matrix;
 using std::min;
 
 namespace openstudio {
 
+namespace {
+
+  const double identityStorage[16] = {1.0, 0.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 0.0, 1.0};
+
+  /// result = lhs * rhs for row major 4x4 matrices, result must not alias lhs or rhs
+  void multiply(const double* lhs, const double* rhs, double* result) {
+    for (unsigned i = 0; i < 4; ++i) {
+      for (unsigned j = 0; j < 4; ++j) {
+        result[4 * i + j] =
+          lhs[4 * i] * rhs[j] + lhs[4 * i + 1] * rhs[4 + j] + lhs[4 * i + 2] * rhs[8 + j] + lhs[4 * i + 3] * rhs[12 + j];
+      }
+    }
+  }
+
+}  // namespace
+
 /// default constructor creates identity transformation
-Transformation::Transformation() : m_storage(identity_matrix<double>(4)) {}
+Transformation::Transformation() {
+  std::copy(identityStorage, identityStorage + 16, m_storage);
+}
 
 /// copy constructor
-Transformation::Transformation(const Transformation& other) : m_storage(other.m_storage) {}
+Transformation::Transformation(const Transformation& other) {
+  std::copy(other.m_storage, other.m_storage + 16, m_storage);
+}
 
 /// constructor from storage, asserts matrix is 4x4
-Transformation::Transformation(const Matrix& matrix) : m_storage(matrix) {
+Transformation::Transformation(const Matrix& matrix) {
   OS_ASSERT(matrix.size1() == 4);
   OS_ASSERT(matrix.size2() == 4);
+
+  for (unsigned i = 0; i < 4; ++i) {
+    for (unsigned j = 0; j < 4; ++j) {
+      m_storage[4 * i + j] = matrix(i, j);
+    }
+  }
 }
 
 /// constructor from storage, asserts vector is size 16
-Transformation::Transformation(const Vector& vector) : m_storage(Matrix(4, 4)) {
+Transformation::Transformation(const Vector& vector) {
   OS_ASSERT(vector.size() == 16);
 
-  m_storage(0, 0) = vector[0];
-  m_storage(1, 0) = vector[1];
-  m_storage(2, 0) = vector[2];
-  m_storage(3, 0) = vector[3];
-  m_storage(0, 1) = vector[4];
-  m_storage(1, 1) = vector[5];
-  m_storage(2, 1) = vector[6];
-  m_storage(2, 1) = vector[7];
-  m_storage(0, 2) = vector[8];
-  m_storage(1, 2) = vector[9];
-  m_storage(2, 2) = vector[10];
-  m_storage(3, 2) = vector[11];
-  m_storage(0, 3) = vector[12];
-  m_storage(1, 3) = vector[13];
-  m_storage(2, 3) = vector[14];
-  m_storage(3, 3) = vector[15];
+  // vector is column major
+  for (unsigned i = 0; i < 4; ++i) {
+    for (unsigned j = 0; j < 4; ++j) {
+      m_storage[4 * i + j] = vector[4 * j + i];
+    }
+  }
 }
 
 /// rotation about origin defined by axis and angle (radians)
 Transformation Transformation::rotation(const Vector3d& axis, double radians) {
-  Matrix storage = identity_matrix<double>(4);
-
   Vector3d temp = axis;
   if (!temp.normalize()) {
     LOG(Error, "Could not normalize axis");
   }
-  Vector normalVector = temp.vector();
+  const double n[3] = {temp.x(), temp.y(), temp.z()};
 
   // Rodrigues' rotation formula / Rotation matrix from Euler axis/angle
   // I*cos(radians) + I*(1-cos(radians))*axis*axis^T + Q*sin(radians)
   // Q = [0, -axis[2], axis[1]; axis[2], 0, -axis[0]; -axis[1], axis[0], 0]
-  Matrix P = outer_prod(normalVector, normalVector);
-  Matrix I = identity_matrix<double>(3);
-  Matrix Q(3, 3, 0.0);
-  Q(0, 1) = -normalVector(2);
-  Q(0, 2) = normalVector(1);
-  Q(1, 0) = normalVector(2);
-  Q(1, 2) = -normalVector(0);
-  Q(2, 0) = -normalVector(1);
-  Q(2, 1) = normalVector(0);
-
-  // rotation matrix
-  Matrix R = I * cos(radians) + (1 - cos(radians)) * P + Q * sin(radians);
+  const double Q[9] = {0.0, -n[2], n[1], n[2], 0.0, -n[0], -n[1], n[0], 0.0};
+  const double c = cos(radians);
+  const double s = sin(radians);
 
+  Transformation result;
   for (unsigned i = 0; i < 3; ++i) {
     for (unsigned j = 0; j < 3; ++j) {
-      storage(i, j) = R(i, j);
+      double I = (i == j) ? 1.0 : 0.0;
+      result.m_storage[4 * i + j] = I * c + (1 - c) * (n[i] * n[j]) + Q[3 * i + j] * s;
     }
   }
 
-  return Transformation(storage);
+  return result;
 }
 
 /// rotation about point defined by axis and angle (radians)
@@ -133,13 +139,11 @@ Transformation Transformation::rotation(const EulerAngles& angles) {
 
 /// translation along vector
 Transformation Transformation::translation(const Vector3d& translation) {
-  Matrix storage = identity_matrix<double>(4);
-
-  storage(0, 3) = translation.x();
-  storage(1, 3) = translation.y();
-  storage(2, 3) = translation.z();
-
-  return Transformation(storage);
+  Transformation result;
+  result.m_storage[3] = translation.x();
+  result.m_storage[7] = translation.y();
+  result.m_storage[11] = translation.z();
+  return result;
 }
 
 /// transforms system with z' to regular system
@@ -174,18 +178,17 @@ Transformation Transformation::alignZPrime(const Vector3d& zPrime) {
     yp = zp.cross(xp);
   }
 
-  Matrix storage = identity_matrix<double>(4);
-  storage(0, 0) = xp.x();
-  storage(1, 0) = xp.y();
-  storage(2, 0) = xp.z();
-  storage(0, 1) = yp.x();
-  storage(1, 1) = yp.y();
-  storage(2, 1) = yp.z();
-  storage(0, 2) = zp.x();
-  storage(1, 2) = zp.y();
-  storage(2, 2) = zp.z();
-
-  return Transformation(storage);
+  Transformation result;
+  result.m_storage[0] = xp.x();
+  result.m_storage[4] = xp.y();
+  result.m_storage[8] = xp.z();
+  result.m_storage[1] = yp.x();
+  result.m_storage[5] = yp.y();
+  result.m_storage[9] = yp.z();
+  result.m_storage[2] = zp.x();
+  result.m_storage[6] = zp.y();
+  result.m_storage[10] = zp.z();
+  return result;
 }
 
 /// transforms face coordinates to regular system, face normal will be z'
@@ -221,7 +224,7 @@ Transformation Transformation::alignFace(const std::vector<Point3d>& vertices) {
 /// returns a transformation which is the inverse of this
 Transformation Transformation::inverse() const {
   Matrix matrix(4, 4);
-  bool test = invert(m_storage, matrix);
+  bool test = invert(this->matrix(), matrix);
   if (!test) {
     // this should never happen
     LOG_AND_THROW("Matrix inversion failed");
@@ -231,28 +234,24 @@ Transformation Transformation::inverse() const {
 
 /// get the matrix representation directly
 Matrix Transformation::matrix() const {
-  return m_storage;
+  Matrix result(4, 4);
+  for (unsigned i = 0; i < 4; ++i) {
+    for (unsigned j = 0; j < 4; ++j) {
+      result(i, j) = m_storage[4 * i + j];
+    }
+  }
+  return result;
 }
 
 /// get the vector representation directly
 Vector Transformation::vector() const {
+  // vector is column major
   openstudio::Vector result(16);
-  result[0] = m_storage(0, 0);
-  result[1] = m_storage(1, 0);
-  result[2] = m_storage(2, 0);
-  result[3] = m_storage(3, 0);
-  result[4] = m_storage(0, 1);
-  result[5] = m_storage(1, 1);
-  result[6] = m_storage(2, 1);
-  result[7] = m_storage(3, 1);
-  result[8] = m_storage(0, 2);
-  result[9] = m_storage(1, 2);
-  result[10] = m_storage(2, 2);
-  result[11] = m_storage(3, 2);
-  result[12] = m_storage(0, 3);
-  result[13] = m_storage(1, 3);
-  result[14] = m_storage(2, 3);
-  result[15] = m_storage(3, 3);
+  for (unsigned i = 0; i < 4; ++i) {
+    for (unsigned j = 0; j < 4; ++j) {
+      result[4 * j + i] = m_storage[4 * i + j];
+    }
+  }
   return result;
 }
 
@@ -261,19 +260,19 @@ EulerAngles Transformation::eulerAngles() const {
   double psi;
   double theta;
   double phi;
-  if (m_storage(2, 0) == 1.0) {
+  if (m_storage[8] == 1.0) {
     phi = 0;
     theta = -boost::math::constants::pi<double>() / 2.0;
-    psi = atan2(-m_storage(0, 1), -m_storage(0, 2));
-  } else if (m_storage(2, 0) == -1.0) {
+    psi = atan2(-m_storage[1], -m_storage[2]);
+  } else if (m_storage[8] == -1.0) {
     phi = 0;
     theta = boost::math::constants::pi<double>() / 2.0;
-    psi = atan2(m_storage(0, 1), m_storage(0, 2));
+    psi = atan2(m_storage[1], m_storage[2]);
   } else {
-    theta = -asin(m_storage(2, 0));
+    theta = -asin(m_storage[8]);
     // theta = pi + asin(m_storage(2,0)); // alternate solution
-    psi = atan2(m_storage(2, 1) / cos(theta), m_storage(2, 2) / cos(theta));
-    phi = atan2(m_storage(1, 0) / cos(theta), m_storage(0, 0) / cos(theta));
+    psi = atan2(m_storage[9] / cos(theta), m_storage[10] / cos(theta));
+    phi = atan2(m_storage[4] / cos(theta), m_storage[0] / cos(theta));
   }
   EulerAngles result(psi, theta, phi);
   return result;
@@ -284,7 +283,7 @@ Matrix Transformation::rotationMatrix() const {
   Matrix result(3, 3);
   for (unsigned i = 0; i < 3; ++i) {
     for (unsigned j = 0; j < 3; ++j) {
-      result(i, j) = m_storage(i, j);
+      result(i, j) = m_storage[4 * i + j];
     }
   }
   return result;
@@ -292,30 +291,27 @@ Matrix Transformation::rotationMatrix() const {
 
 /// get the translation for the transformation, does not include rotation
 Vector3d Transformation::translation() const {
-  Vector3d result(m_storage(0, 3), m_storage(1, 3), m_storage(2, 3));
+  Vector3d result(m_storage[3], m_storage[7], m_storage[11]);
   return result;
 }
 
 /// apply the transformation to the point
 Point3d Transformation::operator*(const Point3d& point) const {
-  Vector temp(4);
-  temp(0) = point.x();
-  temp(1) = point.y();
-  temp(2) = point.z();
-  temp(3) = 1.0;
-  temp = prod(m_storage, temp);
-  return Point3d(temp[0], temp[1], temp[2]);
+  const double* m = m_storage;
+  double x = point.x();
+  double y = point.y();
+  double z = point.z();
+  return Point3d(m[0] * x + m[1] * y + m[2] * z + m[3], m[4] * x + m[5] * y + m[6] * z + m[7], m[8] * x + m[9] * y + m[10] * z + m[11]);
 }
 
 /// apply the transformation to the vector
 Vector3d Transformation::operator*(const Vector3d& vector) const {
-  Vector temp(4);
-  temp(0) = vector.x();
-  temp(1) = vector.y();
-  temp(2) = vector.z();
-  temp(3) = 1.0;
-  temp = prod(m_storage, temp);
-  return Vector3d(temp[0], temp[1], temp[2]);
+  // vectors are transformed like points, including the translation
+  const double* m = m_storage;
+  double x = vector.x();
+  double y = vector.y();
+  double z = vector.z();
+  return Vector3d(m[0] * x + m[1] * y + m[2] * z + m[3], m[4] * x + m[5] * y + m[6] * z + m[7], m[8] * x + m[9] * y + m[10] * z + m[11]);
 }
 
 /// apply the transformation to the BoundingBox
@@ -345,25 +341,37 @@ Plane Transformation::operator*(const Plane& plane) const {
 
 /// apply the transformation to a vector of points
 std::vector<Point3d> Transformation::operator*(const std::vector<Point3d>& points) const {
-  std::vector<Point3d> result(points.size());
-  for (unsigned i = 0; i < points.size(); ++i) {
-    result[i] = (*this) * points[i];
+  // copy the affine part into locals so the loop body is a plain 3x4 multiply the compiler can keep in registers
+  const double m0 = m_storage[0], m1 = m_storage[1], m2 = m_storage[2], m3 = m_storage[3];
+  const double m4 = m_storage[4], m5 = m_storage[5], m6 = m_storage[6], m7 = m_storage[7];
+  const double m8 = m_storage[8], m9 = m_storage[9], m10 = m_storage[10], m11 = m_storage[11];
+
+  std::vector<Point3d> result;
+  result.reserve(points.size());
+  for (const Point3d& point : points) {
+    double x = point.x();
+    double y = point.y();
+    double z = point.z();
+    result.emplace_back(m0 * x + m1 * y + m2 * z + m3, m4 * x + m5 * y + m6 * z + m7, m8 * x + m9 * y + m10 * z + m11);
   }
   return result;
 }
 
 /// apply the transformation to a vector of vector
 std::vector<Vector3d> Transformation::operator*(const std::vector<Vector3d>& vectors) const {
-  std::vector<Vector3d> result(vectors.size());
-  for (unsigned i = 0; i < vectors.size(); ++i) {
-    result[i] = (*this) * vectors[i];
+  std::vector<Vector3d> result;
+  result.reserve(vectors.size());
+  for (const Vector3d& vector : vectors) {
+    result.push_back((*this) * vector);
   }
   return result;
 }
 
 /// apply the transformation to the other transformation
 Transformation Transformation::operator*(const Transformation& other) const {
-  return Transformation(prod(m_storage, other.m_storage));
+  Transformation result;
+  multiply(m_storage, other.m_storage, result.m_storage);
+  return result;
 }
 
 /// ostream operator
@@ -125,7 +125,9 @@ class UTILITIES_API Transformation
 
  private:
   REGISTER_LOGGER("utilities.Transformation");
-  Matrix m_storage;
+
+  /// 4x4 matrix stored inline in row major order, element (i, j) is m_storage[4 * i + j]
+  double m_storage[16];
 };
 
 /// ostream operator
@@ -102,13 +102,13 @@ class UTILITIES_API Vector3d
   /// cross product with another Vector3d
   Vector3d cross(const Vector3d& other) const;
 
-  /// get the Vector directly
+  /// get a copy of the coordinates as a Vector
   Vector vector() const;
 
  private:
   REGISTER_LOGGER("utilities.Vector3d");
 
-  Vector m_storage;
+  double m_storage[3];
 };
 
 /// ostream operator
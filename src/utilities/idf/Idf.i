@@ -90,6 +90,12 @@
 %ignore openstudio::IdfFile::load(std::istream&);
 %ignore openstudio::IdfFile::load(std::istream&, IddFileType);
 %ignore openstudio::IdfFile::load(std::istream&, const IddFile&);
+%ignore openstudio::IdfFile::loadBinary(std::istream&);
+%ignore openstudio::IdfFile::printBinary;
+
+// views over implementation pointers are for C++ loops only
+%ignore openstudio::WorkspaceObjectImplRange;
+%ignore openstudio::Workspace::objectImplsByType;
 
 #if defined(SWIGRUBY)
   // add mixins
@@ -45,8 +45,126 @@
 #include <boost/iostreams/filter/newline.hpp>
 #include <boost/iostreams/filtering_stream.hpp>
 
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <unordered_map>
+
 namespace openstudio {
 
+namespace {
+
+  // Binary snapshot layout, all integers are unsigned LEB128 varints and all strings are a varint length followed by the bytes:
+  //   magic, format version, IddFileType name, IDD version, header,
+  //   string table: count, strings
+  //   type table: count, string index of each IddObject name
+  //   objects: count, then for each object its type index, 16 handle bytes, comment string index,
+  //            field count and field string indices, field comment count and field comment string indices
+  const std::string binarySnapshotMagic("OSIDFBIN");
+  const unsigned binarySnapshotFormatVersion = 1;
+
+  void appendVarint(std::string& buffer, std::uint64_t value) {
+    while (value >= 0x80) {
+      buffer.push_back(static_cast<char>((value & 0x7f) | 0x80));
+      value >>= 7;
+    }
+    buffer.push_back(static_cast<char>(value));
+  }
+
+  void appendString(std::string& buffer, const std::string& value) {
+    appendVarint(buffer, value.size());
+    buffer.append(value);
+  }
+
+  /** Interns strings, assigning indices in order of first use. */
+  class BinarySnapshotStringTable
+  {
+   public:
+    unsigned index(const std::string& value) {
+      auto inserted = m_indices.emplace(value, static_cast<unsigned>(m_strings.size()));
+      if (inserted.second) {
+        m_strings.push_back(&inserted.first->first);
+      }
+      return inserted.first->second;
+    }
+
+    void append(std::string& buffer) const {
+      appendVarint(buffer, m_strings.size());
+      for (const std::string* value : m_strings) {
+        appendString(buffer, *value);
+      }
+    }
+
+   private:
+    // node based, so pointers to the keys stay valid
+    std::unordered_map<std::string, unsigned> m_indices;
+    std::vector<const std::string*> m_strings;
+  };
+
+  /** Bounds checked reads from a binary snapshot, throws std::runtime_error on malformed data. */
+  class BinarySnapshotReader
+  {
+   public:
+    explicit BinarySnapshotReader(const std::string& data) : m_data(data) {}
+
+    bool atEnd() const {
+      return m_pos == m_data.size();
+    }
+
+    std::uint64_t varint() {
+      std::uint64_t result = 0;
+      for (unsigned shift = 0; shift < 64; shift += 7) {
+        if (m_pos >= m_data.size()) {
+          throw std::runtime_error("Unexpected end of snapshot");
+        }
+        const auto byte = static_cast<std::uint8_t>(m_data[m_pos++]);
+        result |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0) {
+          return result;
+        }
+      }
+      throw std::runtime_error("Invalid varint in snapshot");
+    }
+
+    /** A count of items that each take at least one byte, checked against the bytes left so corrupt counts cannot cause huge allocations. */
+    std::size_t count() {
+      const auto result = varint();
+      if (result > m_data.size() - m_pos) {
+        throw std::runtime_error("Count exceeds the size of the snapshot");
+      }
+      return static_cast<std::size_t>(result);
+    }
+
+    /** An index into a table of size n. */
+    std::size_t index(std::size_t n) {
+      const auto result = varint();
+      if (result >= n) {
+        throw std::runtime_error("Index out of range in snapshot");
+      }
+      return static_cast<std::size_t>(result);
+    }
+
+    const char* bytes(std::size_t n) {
+      if (n > m_data.size() - m_pos) {
+        throw std::runtime_error("Unexpected end of snapshot");
+      }
+      const char* result = m_data.data() + m_pos;
+      m_pos += n;
+      return result;
+    }
+
+    std::string string() {
+      const auto n = count();
+      return std::string(bytes(n), n);
+    }
+
+   private:
+    const std::string& m_data;
+    std::size_t m_pos = 0;
+  };
+
+}  // namespace
+
 // CONSTRUCTORS
 
 IdfFile::IdfFile(IddFileType iddFileType) : m_iddFileAndFactoryWrapper(iddFileType) {
@@ -514,6 +632,176 @@ bool IdfFile::save(const openstudio::path& p, bool overwrite) {
   return false;
 }
 
+bool IdfFile::printBinary(std::ostream& os) const {
+  IddFileType iddFileType = m_iddFileAndFactoryWrapper.iddFileType();
+  if (iddFileType == IddFileType::UserCustom) {
+    LOG(Error, "Unable to print a binary snapshot of an IdfFile that does not use an IddFileType provided by the IddFactory.");
+    return false;
+  }
+
+  BinarySnapshotStringTable strings;
+  std::unordered_map<std::string, unsigned> typeIndices;
+  std::string types;
+  std::string objects;
+
+  appendVarint(objects, m_objects.size());
+  for (const IdfObject& object : m_objects) {
+    const auto impl = object.getImpl<detail::IdfObject_Impl>();
+
+    const std::string& typeName = impl->m_iddObject.name();
+    auto inserted = typeIndices.emplace(typeName, static_cast<unsigned>(typeIndices.size()));
+    if (inserted.second) {
+      appendVarint(types, strings.index(typeName));
+    }
+    appendVarint(objects, inserted.first->second);
+
+    objects.append(reinterpret_cast<const char*>(impl->m_handle.begin()), impl->m_handle.size());
+    appendVarint(objects, strings.index(impl->m_comment));
+    appendVarint(objects, impl->m_fields.size());
+    for (const std::string& field : impl->m_fields) {
+      appendVarint(objects, strings.index(field));
+    }
+    appendVarint(objects, impl->m_fieldComments.size());
+    for (const std::string& fieldComment : impl->m_fieldComments) {
+      appendVarint(objects, strings.index(fieldComment));
+    }
+  }
+
+  std::string buffer(binarySnapshotMagic);
+  appendVarint(buffer, binarySnapshotFormatVersion);
+  appendString(buffer, iddFileType.valueName());
+  appendString(buffer, m_iddFileAndFactoryWrapper.version());
+  appendString(buffer, m_header);
+  strings.append(buffer);
+  appendVarint(buffer, typeIndices.size());
+  buffer.append(types);
+  buffer.append(objects);
+
+  os.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+  return bool(os);
+}
+
+bool IdfFile::saveBinary(const openstudio::path& p, bool overwrite) const {
+
+  // do not overwrite if not allowed
+  if (!overwrite && openstudio::filesystem::exists(p)) {
+    LOG(Info, "Save method failed because instructed not to overwrite path '" << toString(p) << "'.");
+    return false;
+  }
+
+  if (makeParentFolder(p)) {
+    openstudio::filesystem::ofstream outFile(p, std::ios_base::binary | std::ios_base::trunc);
+    if (outFile) {
+      if (printBinary(outFile)) {
+        outFile.close();
+        return true;
+      }
+      LOG(Error, "Unable to write binary snapshot to path '" << toString(p) << "'.");
+      return false;
+    }
+  }
+
+  LOG(Error, "Unable to write file to path '" << toString(p) << "', because parent directory "
+                                              << "could not be created.");
+  return false;
+}
+
+boost::optional<IdfFile> IdfFile::loadBinary(std::istream& is) {
+  const std::string data{std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>()};
+
+  try {
+    BinarySnapshotReader reader(data);
+
+    if (std::string(reader.bytes(binarySnapshotMagic.size()), binarySnapshotMagic.size()) != binarySnapshotMagic) {
+      LOG(Error, "Unable to load binary snapshot, the data is not an IdfFile snapshot.");
+      return boost::none;
+    }
+    const auto formatVersion = reader.varint();
+    if (formatVersion != binarySnapshotFormatVersion) {
+      LOG(Error, "Unable to load binary snapshot of unknown format version " << formatVersion << ".");
+      return boost::none;
+    }
+
+    IddFileType iddFileType(reader.string());
+    if (iddFileType == IddFileType::UserCustom) {
+      throw std::runtime_error("Snapshot does not use an IddFileType provided by the IddFactory");
+    }
+    IdfFile result(iddFileType);
+    // remove initial version object, the snapshot has its own
+    if (OptionalIdfObject vo = result.versionObject()) {
+      result.removeObject(*vo);
+    }
+
+    const std::string iddVersion = reader.string();
+    if (iddVersion != result.m_iddFileAndFactoryWrapper.version()) {
+      LOG(Warn, "Unable to load binary snapshot written with " << iddFileType.valueName() << " IDD version " << iddVersion
+                                                                << ", the current version is " << result.m_iddFileAndFactoryWrapper.version() << ".");
+      return boost::none;
+    }
+    result.setHeader(reader.string());
+
+    std::vector<std::string> strings(reader.count());
+    for (std::string& value : strings) {
+      value = reader.string();
+    }
+
+    const auto numTypes = reader.count();
+    std::vector<IddObject> types;
+    types.reserve(numTypes);
+    for (std::size_t i = 0; i < numTypes; ++i) {
+      const std::string& typeName = strings[reader.index(strings.size())];
+      if (typeName == IddObject().name()) {
+        types.push_back(IddObject());
+      } else if (OptionalIddObject iddObject = result.m_iddFileAndFactoryWrapper.getObject(typeName)) {
+        types.push_back(*iddObject);
+      } else {
+        throw std::runtime_error("Snapshot object type '" + typeName + "' is not in the Idd");
+      }
+    }
+
+    const auto numObjects = reader.count();
+    result.m_objects.reserve(numObjects);
+    Handle handle;
+    for (std::size_t i = 0; i < numObjects; ++i) {
+      const IddObject& iddObject = types[reader.index(types.size())];
+      const char* handleBytes = reader.bytes(handle.size());
+      std::copy(handleBytes, handleBytes + handle.size(), handle.begin());
+      const std::string& comment = strings[reader.index(strings.size())];
+
+      std::vector<std::string> fields(reader.count());
+      for (std::string& field : fields) {
+        field = strings[reader.index(strings.size())];
+      }
+      std::vector<std::string> fieldComments(reader.count());
+      for (std::string& fieldComment : fieldComments) {
+        fieldComment = strings[reader.index(strings.size())];
+      }
+
+      result.addObject(IdfObject(std::make_shared<detail::IdfObject_Impl>(handle, comment, iddObject, fields, fieldComments)));
+    }
+
+    if (!reader.atEnd()) {
+      throw std::runtime_error("Unexpected data after the last object");
+    }
+
+    return result;
+  } catch (const std::exception& e) {
+    LOG(Error, "Unable to load binary snapshot: " << e.what());
+  }
+
+  return boost::none;
+}
+
+boost::optional<IdfFile> IdfFile::loadBinary(const path& p) {
+  openstudio::filesystem::ifstream inFile(p, std::ios_base::binary);
+  if (inFile) {
+    return loadBinary(inFile);
+  }
+
+  LOG(Error, "Unable to open binary snapshot at path '" << toString(p) << "'.");
+  return boost::none;
+}
+
 // PRIVATE
 
 // SERIALIZATION
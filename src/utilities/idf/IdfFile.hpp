@@ -211,6 +211,24 @@ class UTILITIES_API IdfFile
    *  and 'idf' otherwise. Returns true if the save operation is successful; false otherwise. */
   bool save(const openstudio::path& p, bool overwrite = false);
 
+  /** Print a binary snapshot of this file to std::ostream os. The snapshot holds the IddFileType and
+   *  IDD version, the header, and each object's type, handle, comments and fields in a string table,
+   *  so loadBinary reproduces exactly what print would write. Returns false if this file does not
+   *  use an IddFileType provided by the IddFactory. */
+  bool printBinary(std::ostream& os) const;
+
+  /** Save a binary snapshot of this file to path p, see printBinary. The extension of p is used as
+   *  is. Will only overwrite an existing file if overwrite==true. */
+  bool saveBinary(const openstudio::path& p, bool overwrite = false) const;
+
+  /** Load an IdfFile from a binary snapshot written by printBinary. Returns boost::none if is does
+   *  not hold a snapshot, if the snapshot is corrupt, or if it was written with a different IDD
+   *  version, in which case the text form should be loaded and version translated instead. */
+  static boost::optional<IdfFile> loadBinary(std::istream& is);
+
+  /** Load an IdfFile from a binary snapshot saved at path p, see loadBinary(std::istream&). */
+  static boost::optional<IdfFile> loadBinary(const path& p);
+
   //@}
 
  protected:
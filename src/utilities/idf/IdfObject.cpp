@@ -315,6 +315,9 @@ namespace detail {
   }
 
   void IdfObject_Impl::setComment(const std::string& comment, bool checkValidity) {
+    if (isReadOnly()) {
+      return;
+    }
     m_comment = makeComment(comment);
     m_diffs.push_back(IdfObjectDiff(boost::none, boost::none, boost::none));
   }
@@ -328,6 +331,9 @@ namespace detail {
   }
 
   bool IdfObject_Impl::setFieldComment(unsigned index, const std::string& cmnt, bool checkValidity) {
+    if (isReadOnly()) {
+      return false;
+    }
     if (index < m_fields.size()) {
       if (index >= m_fieldComments.size()) {
         m_fieldComments.resize(index + 1);
@@ -1819,6 +1825,10 @@ namespace detail {
     return true;
   }
 
+  bool IdfObject_Impl::isReadOnly() const {
+    return false;
+  }
+
   bool IdfObject_Impl::withinBounds(double fieldValue, const IddField& iddField) const {
 
     // minimum bounds
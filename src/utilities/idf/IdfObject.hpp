@@ -35,6 +35,7 @@
 #include "Handle.hpp"
 
 #include "../core/Logger.hpp"
+#include "../core/CachedDynamicCast.hpp"
 
 #include <boost/optional.hpp>
 
@@ -372,10 +373,10 @@ class UTILITIES_API IdfObject
   //LER@20101028 so that impls can call (someModel.getImpl<some_Impl>())
   //impls do NOT inherit from the object tree, so it's either friend every single
   //model class or make it public.
-  // get the impl
+  // get the impl, the result of the dynamic cast is remembered per concrete impl class
   template <typename T>
   std::shared_ptr<T> getImpl() const {
-    return std::dynamic_pointer_cast<T>(m_impl);
+    return cachedDynamicPointerCast<T>(m_impl);
   }
 
   /// cast to type T, can throw std::bad_cast
@@ -410,6 +411,7 @@ class UTILITIES_API IdfObject
   friend class detail::Workspace_Impl;        // for finding IdfObjects in a workspace
   friend class WorkspaceObject;               // for WorkspaceObject::idfObject()
   friend class Workspace;                     // for toIdfFile completion (constructs IdfObject from impl)
+  friend class IdfFile;                       // for loadBinary (constructs IdfObject from impl)
 
   /** Protected constructor from impl. */
   IdfObject(std::shared_ptr<detail::IdfObject_Impl> impl);
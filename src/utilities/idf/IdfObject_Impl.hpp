@@ -37,6 +37,7 @@
 
 #include <utilities/core/Logger.hpp>
 #include <utilities/core/Containers.hpp>
+#include <utilities/core/CachedDynamicCast.hpp>
 #include <nano/nano_signal_slot.hpp>  // Signal-Slot replacement
 
 #include <boost/optional.hpp>
@@ -49,6 +50,7 @@ namespace openstudio {
 
 // forward declarations
 class IdfObject;
+class IdfFile;
 class IdfExtensibleGroup;
 struct IdfObjectImplLess;
 class StrictnessLevel;
@@ -351,7 +353,7 @@ namespace detail {
     /** Get an object that wraps this impl. */
     template <typename T>
     T getObject() const {
-      T result(std::dynamic_pointer_cast<typename T::ImplType>(std::const_pointer_cast<IdfObject_Impl>(shared_from_this())));
+      T result(cachedDynamicPointerCast<typename T::ImplType>(std::const_pointer_cast<IdfObject_Impl>(shared_from_this())));
       return result;
     }
 
@@ -380,6 +382,7 @@ namespace detail {
 
    protected:
     friend class openstudio::IdfObject;
+    friend class openstudio::IdfFile;  // for binary snapshots
 
     // handle
     Handle m_handle;
@@ -418,6 +421,9 @@ namespace detail {
 
     virtual bool fieldIsNonnullIfRequired(unsigned index) const;
 
+    /** True if the data of this object may not be changed, e.g. because it is in a frozen Workspace. */
+    virtual bool isReadOnly() const;
+
    private:
     IdfObject_Impl() {}
 
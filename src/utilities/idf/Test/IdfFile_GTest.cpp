@@ -81,6 +81,39 @@ TEST_F(IdfFixture, IdfFile_BasicTests_LoadedFile) {
   LOG(Info, "IdfFile written to idf text in " << writeTime << "s. Please check diff by hand.");
 }
 
+TEST_F(IdfFixture, IdfFile_BinarySnapshot) {
+  std::stringstream text;
+  epIdfFile.print(text);
+
+  std::stringstream binary;
+  ASSERT_TRUE(epIdfFile.printBinary(binary));
+  const std::string data = binary.str();
+  EXPECT_LT(data.size(), text.str().size());
+
+  OptionalIdfFile loaded = IdfFile::loadBinary(binary);
+  ASSERT_TRUE(loaded);
+  EXPECT_EQ(epIdfFile.iddFileType(), loaded->iddFileType());
+  EXPECT_EQ(epIdfFile.header(), loaded->header());
+  EXPECT_TRUE(loaded->versionObject());
+
+  // reproduces the text form exactly, including handles and comments
+  std::stringstream reprinted;
+  loaded->print(reprinted);
+  EXPECT_EQ(text.str(), reprinted.str());
+  IdfObjectVector objects = epIdfFile.objects();
+  IdfObjectVector loadedObjects = loaded->objects();
+  ASSERT_EQ(objects.size(), loadedObjects.size());
+  for (unsigned i = 0; i < objects.size(); ++i) {
+    EXPECT_EQ(objects[i].handle(), loadedObjects[i].handle());
+  }
+
+  // truncated snapshots and text files are rejected
+  std::stringstream truncated(data.substr(0, data.size() - 1));
+  EXPECT_FALSE(IdfFile::loadBinary(truncated));
+  std::stringstream notASnapshot(text.str());
+  EXPECT_FALSE(IdfFile::loadBinary(notASnapshot));
+}
+
 TEST_F(IdfFixture, IdfFile_Header) {
   IdfFile file(IddFileType::EnergyPlus);
   std::string header = "! A one-line header. ";
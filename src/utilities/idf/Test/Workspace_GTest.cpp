@@ -54,9 +54,11 @@
 #include <utilities/idd/BuildingSurface_Detailed_FieldEnums.hxx>
 #include <utilities/idd/Sizing_Zone_FieldEnums.hxx>
 #include <utilities/idd/OS_WeatherFile_FieldEnums.hxx>
+#include <utilities/idd/OS_Space_FieldEnums.hxx>
 #include "../WorkspaceWatcher.hpp"
 #include "IdfTestQObjects.hpp"
 
+#include "../../core/Filesystem.hpp"
 #include "../../core/Path.hpp"
 #include "../../core/Optional.hpp"
 
@@ -70,6 +72,9 @@
 using namespace openstudio;
 
 #include <iostream>
+#include <iterator>
+#include <sstream>
+#include <thread>
 
 TEST_F(IdfFixture, IdfFile_Workspace_DefaultConstructor) {
   Workspace workspaceNone(StrictnessLevel::None);
@@ -535,6 +540,85 @@ TEST_F(IdfFixture, Workspace_Clone) {
   EXPECT_FALSE(cloneHandles == wsHandles);
 }
 
+TEST_F(IdfFixture, Workspace_ClonePointers) {
+  Workspace workspace(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+  OptionalWorkspaceObject owo = workspace.addObject(IdfObject(IddObjectType::Lights));
+  ASSERT_TRUE(owo);
+  WorkspaceObject light = *owo;
+  owo = workspace.addObject(IdfObject(IddObjectType::Zone));
+  ASSERT_TRUE(owo);
+  WorkspaceObject zone = *owo;
+  EXPECT_TRUE(light.setPointer(LightsFields::ZoneorZoneListName, zone.handle()));
+
+  // pointers are remapped to the cloned objects
+  Workspace clone = workspace.clone();
+  WorkspaceObjectVector lights = clone.getObjectsByType(IddObjectType::Lights);
+  WorkspaceObjectVector zones = clone.getObjectsByType(IddObjectType::Zone);
+  ASSERT_EQ(1u, lights.size());
+  ASSERT_EQ(1u, zones.size());
+  EXPECT_NE(light.handle(), lights[0].handle());
+  EXPECT_NE(zone.handle(), zones[0].handle());
+  ASSERT_TRUE(lights[0].getTarget(LightsFields::ZoneorZoneListName));
+  EXPECT_EQ(zones[0].handle(), lights[0].getTarget(LightsFields::ZoneorZoneListName)->handle());
+  ASSERT_EQ(1u, zones[0].sources().size());
+  EXPECT_EQ(lights[0].handle(), zones[0].sources()[0].handle());
+  ASSERT_TRUE(zone.name());
+  EXPECT_TRUE(lights[0].setString(LightsFields::ZoneorZoneListName, zone.name().get()));
+  ASSERT_TRUE(lights[0].getTarget(LightsFields::ZoneorZoneListName));
+  EXPECT_EQ(zones[0].handle(), lights[0].getTarget(LightsFields::ZoneorZoneListName)->handle());
+
+  // pointers to objects outside of the subset are nulled
+  Workspace subset = workspace.cloneSubset(HandleVector(1u, light.handle()));
+  lights = subset.getObjectsByType(IddObjectType::Lights);
+  ASSERT_EQ(1u, lights.size());
+  EXPECT_TRUE(subset.getObjectsByType(IddObjectType::Zone).empty());
+  EXPECT_FALSE(lights[0].getTarget(LightsFields::ZoneorZoneListName));
+
+  // the original is untouched
+  ASSERT_TRUE(light.getTarget(LightsFields::ZoneorZoneListName));
+  EXPECT_EQ(zone.handle(), light.getTarget(LightsFields::ZoneorZoneListName)->handle());
+  ASSERT_EQ(1u, zone.sources().size());
+}
+
+TEST_F(IdfFixture, Workspace_CloneSubset_FinalWithoutRequiredObjects) {
+  Workspace workspace(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+  OptionalWorkspaceObject zone1 = workspace.addObject(IdfObject(IddObjectType::Zone));
+  OptionalWorkspaceObject zone2 = workspace.addObject(IdfObject(IddObjectType::Zone));
+  ASSERT_TRUE(zone1);
+  ASSERT_TRUE(zone2);
+  EXPECT_FALSE(workspace.isValid(StrictnessLevel::Final));
+
+  // the subset is missing required objects like Building, but each cloned object is valid on its own
+  HandleVector handles{zone1->handle(), zone2->handle()};
+  Workspace newHandles = workspace.cloneSubset(handles, false, StrictnessLevel::Final);
+  Workspace keptHandles = workspace.cloneSubset(handles, true, StrictnessLevel::Final);
+  EXPECT_EQ(2u, newHandles.getObjectsByType(IddObjectType::Zone).size());
+  EXPECT_EQ(2u, keptHandles.getObjectsByType(IddObjectType::Zone).size());
+  EXPECT_EQ(StrictnessLevel(StrictnessLevel::Final), newHandles.strictnessLevel());
+}
+
+TEST_F(IdfFixture, Workspace_AddObjectsToBlankWorkspace_NameConflict) {
+  Workspace workspace1(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+  Workspace workspace2(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+  OptionalWorkspaceObject zone1 = workspace1.addObject(IdfObject(IddObjectType::Zone));
+  OptionalWorkspaceObject zone2 = workspace2.addObject(IdfObject(IddObjectType::Zone));
+  ASSERT_TRUE(zone1);
+  ASSERT_TRUE(zone2);
+  EXPECT_TRUE(zone1->setName("Office"));
+  EXPECT_TRUE(zone2->setName("Office"));
+
+  // the added objects conflict with each other even though the workspace is blank
+  WorkspaceObjectVector objects{*zone1, *zone2};
+  Workspace workspace(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+  EXPECT_TRUE(workspace.addObjects(objects).empty());
+  EXPECT_TRUE(workspace.getObjectsByType(IddObjectType::Zone).empty());
+
+  EXPECT_TRUE(zone2->setName("Lobby"));
+  objects = {*zone1, *zone2};
+  EXPECT_EQ(2u, workspace.addObjects(objects).size());
+  EXPECT_EQ(2u, workspace.getObjectsByType(IddObjectType::Zone).size());
+}
+
 TEST_F(IdfFixture, Workspace_Insert) {
   Workspace workspace(epIdfFile, StrictnessLevel::None);
   unsigned n = workspace.handles().size();
@@ -2115,3 +2199,203 @@ TEST_F(IdfFixture, Workspace_getObjects_Type_StringOverload) {
     EXPECT_EQ(expectedErrorMessage, std::string(e.what()));
   }
 }
+
+TEST_F(IdfFixture, Workspace_LoadManyObjects) {
+  // enough objects for Workspace_Impl::createObjects to use several threads
+  IdfFile idfFile(IddFileType::EnergyPlus);
+  const unsigned numZones = 1500;
+  for (unsigned i = 0; i < numZones; ++i) {
+    IdfObject zone(IddObjectType::Zone);
+    EXPECT_TRUE(zone.setName("Office " + std::to_string(i)));
+    idfFile.addObject(zone);
+
+    IdfObject lights(IddObjectType::Lights);
+    EXPECT_TRUE(lights.setName("Lights " + std::to_string(i)));
+    EXPECT_TRUE(lights.setString(LightsFields::ZoneorZoneListName, "Office " + std::to_string(i)));
+    idfFile.addObject(lights);
+  }
+  // no name, has to be named while loading, the default name must not clash with the offices
+  idfFile.addObject(IdfObject(IddObjectType::Zone));
+
+  Workspace workspace(idfFile);
+  std::vector<IdfObject> idfObjects = idfFile.objects();
+  EXPECT_EQ(idfObjects.size(), workspace.numObjects());
+  for (const IdfObject& idfObject : idfObjects) {
+    OptionalWorkspaceObject object = workspace.getObject(idfObject.handle());
+    ASSERT_TRUE(object);
+    EXPECT_EQ(idfObject.iddObject().type(), object->iddObject().type());
+    if (!idfObject.nameString().empty()) {
+      EXPECT_EQ(idfObject.nameString(), object->nameString());
+    } else {
+      EXPECT_FALSE(object->nameString().empty());
+    }
+  }
+
+  for (unsigned i = 0; i < numZones; ++i) {
+    OptionalWorkspaceObject lights = workspace.getObjectByTypeAndName(IddObjectType::Lights, "Lights " + std::to_string(i));
+    ASSERT_TRUE(lights);
+    OptionalWorkspaceObject zone = lights->getTarget(LightsFields::ZoneorZoneListName);
+    ASSERT_TRUE(zone);
+    EXPECT_EQ("Office " + std::to_string(i), zone->nameString());
+  }
+}
+
+TEST_F(IdfFixture, Workspace_ObjectsByTypeInInsertionOrder) {
+  Workspace workspace(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+  std::vector<Handle> handles;
+  for (unsigned i = 0; i < 10; ++i) {
+    OptionalWorkspaceObject zone = workspace.addObject(IdfObject(IddObjectType::Zone));
+    ASSERT_TRUE(zone);
+    handles.push_back(zone->handle());
+  }
+  ASSERT_TRUE(workspace.addObject(IdfObject(IddObjectType::Lights)));
+
+  // remove enough objects for the remaining ones to be compacted
+  for (unsigned i : {1u, 2u, 4u, 5u, 6u, 8u}) {
+    ASSERT_TRUE(workspace.getObject(handles[i]));
+    workspace.getObject(handles[i])->remove();
+  }
+  std::vector<Handle> expected{handles[0], handles[3], handles[7], handles[9]};
+
+  for (unsigned pass = 0; pass < 2; ++pass) {
+    std::vector<WorkspaceObject> zones = workspace.getObjectsByType(IddObjectType::Zone);
+    ASSERT_EQ(expected.size(), zones.size());
+    EXPECT_EQ(expected.size(), workspace.numObjectsOfType(IddObjectType::Zone));
+    for (unsigned i = 0; i < expected.size(); ++i) {
+      EXPECT_EQ(expected[i], zones[i].handle());
+    }
+
+    WorkspaceObjectImplRange range = workspace.objectImplsByType(IddObjectType::Zone);
+    EXPECT_EQ(expected.size(), range.size());
+    std::vector<Handle> rangeHandles;
+    for (const auto& objectImplPtr : range) {
+      rangeHandles.push_back(objectImplPtr->handle());
+    }
+    EXPECT_EQ(expected, rangeHandles);
+
+    // added objects go last
+    OptionalWorkspaceObject zone = workspace.addObject(IdfObject(IddObjectType::Zone));
+    ASSERT_TRUE(zone);
+    expected.push_back(zone->handle());
+  }
+
+  EXPECT_TRUE(workspace.objectImplsByType(IddObjectType::Building).empty());
+  // version object is left out
+  EXPECT_EQ(2u, workspace.objectImplsByType().size());
+}
+
+TEST_F(IdfFixture, Workspace_Freeze) {
+  Workspace workspace(epIdfFile);
+  EXPECT_FALSE(workspace.isFrozen());
+
+  Workspace frozen = workspace.freeze();
+  EXPECT_TRUE(frozen.isFrozen());
+  EXPECT_EQ(workspace.numObjects(), frozen.numObjects());
+
+  // all changes are refused
+  std::vector<WorkspaceObject> zones = frozen.getObjectsByType(IddObjectType::Zone);
+  ASSERT_FALSE(zones.empty());
+  WorkspaceObject zone = zones[0];
+  std::string name = zone.nameString();
+  EXPECT_FALSE(zone.setName("New Name"));
+  EXPECT_FALSE(zone.setString(ZoneFields::Multiplier, "2"));
+  EXPECT_FALSE(frozen.addObject(IdfObject(IddObjectType::Zone)));
+  EXPECT_FALSE(frozen.removeObject(zone.handle()));
+  EXPECT_TRUE(zone.remove().empty());
+  EXPECT_EQ(name, zone.nameString());
+  EXPECT_EQ(workspace.numObjects(), frozen.numObjects());
+
+  // the original and clones of the snapshot can still be changed
+  EXPECT_TRUE(workspace.getObject(zone.handle())->setName("New Name"));
+  Workspace thawed = frozen.clone();
+  EXPECT_FALSE(thawed.isFrozen());
+  EXPECT_TRUE(thawed.getObjectsByType(IddObjectType::Zone)[0].setName("New Name"));
+
+  // concurrent queries see the same data as a single thread
+  std::vector<std::string> expected;
+  for (const WorkspaceObject& object : frozen.objects(true)) {
+    expected.push_back(object.nameString() + object.iddObject().name());
+    for (const WorkspaceObject& target : object.targets()) {
+      expected.back() += target.nameString();
+    }
+  }
+  std::vector<std::vector<std::string>> results(4);
+  std::vector<std::thread> threads;
+  for (auto& result : results) {
+    threads.emplace_back([&frozen, &result]() {
+      for (const WorkspaceObject& object : frozen.objects(true)) {
+        result.push_back(object.nameString() + object.iddObject().name());
+        for (const WorkspaceObject& target : object.targets()) {
+          result.back() += target.nameString();
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (const auto& result : results) {
+    EXPECT_EQ(expected, result);
+  }
+}
+
+TEST_F(IdfFixture, Workspace_IncrementalSave) {
+  Workspace workspace(StrictnessLevel::Draft, IddFileType::OpenStudio);
+  EXPECT_FALSE(workspace.incrementalSave());
+  workspace.setIncrementalSave(true);
+  EXPECT_TRUE(workspace.incrementalSave());
+
+  WorkspaceObject story = workspace.addObject(IdfObject(IddObjectType::OS_BuildingStory)).get();
+  std::vector<WorkspaceObject> spaces;
+  for (unsigned i = 0; i < 10; ++i) {
+    spaces.push_back(workspace.addObject(IdfObject(IddObjectType::OS_Space)).get());
+    EXPECT_TRUE(spaces.back().setPointer(OS_SpaceFields::BuildingStoryName, story.handle()));
+  }
+
+  openstudio::path path = outDir / toPath("IncrementalSave.osm");
+  const auto savedText = [](const openstudio::path& p) {
+    openstudio::filesystem::ifstream inFile(p);
+    return std::string(std::istreambuf_iterator<char>(inFile), std::istreambuf_iterator<char>());
+  };
+  const auto fullText = [&workspace]() {
+    std::stringstream ss;
+    workspace.toIdfFile().print(ss);
+    return ss.str();
+  };
+
+  ASSERT_TRUE(workspace.save(path, true));
+  EXPECT_EQ(fullText(), savedText(path));
+
+  // changed, added and removed objects
+  EXPECT_TRUE(spaces[3].setName("Renamed Space"));
+  spaces[5].setComment("A comment");
+  EXPECT_TRUE(workspace.addObject(IdfObject(IddObjectType::OS_Space)));
+  EXPECT_FALSE(spaces[7].remove().empty());
+  ASSERT_TRUE(workspace.save(path, true));
+  EXPECT_EQ(fullText(), savedText(path));
+
+  // removing the story nullifies the pointers of the remaining spaces
+  EXPECT_FALSE(story.remove().empty());
+  ASSERT_TRUE(workspace.save(path, true));
+  EXPECT_EQ(fullText(), savedText(path));
+  EXPECT_FALSE(workspace.save(path, false));
+
+  // changes made to the file by others are discarded
+  {
+    openstudio::filesystem::ofstream outFile(path);
+    outFile << "Not an osm\n";
+  }
+  ASSERT_TRUE(workspace.save(path, true));
+  EXPECT_EQ(fullText(), savedText(path));
+
+  // saving to another path starts over
+  openstudio::path otherPath = outDir / toPath("IncrementalSave2.osm");
+  EXPECT_TRUE(spaces[0].setName("Another Name"));
+  ASSERT_TRUE(workspace.save(otherPath, true));
+  EXPECT_EQ(fullText(), savedText(otherPath));
+  ASSERT_TRUE(workspace.save(path, true));
+  EXPECT_EQ(fullText(), savedText(path));
+
+  openstudio::filesystem::remove(path);
+  openstudio::filesystem::remove(otherPath);
+}
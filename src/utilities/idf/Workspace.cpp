@@ -33,16 +33,26 @@
 #include "IdfFile.hpp"
 #include "ValidityReport.hpp"
 
+#include "../idd/Comments.hpp"
+
 #include <utilities/idd/IddEnums.hxx>
 #include <utilities/idd/IddFactory.hxx>
 
 #include "../plot/ProgressBar.hpp"
 
 #include "../core/Assert.hpp"
+#include "../core/FilesystemHelpers.hpp"
+#include "../core/PathHelpers.hpp"
+#include "../core/ParallelFor.hpp"
 #include "../core/StringHelpers.hpp"
 
 #include <boost/lexical_cast.hpp>
 
+#include <algorithm>
+#include <iterator>
+#include <sstream>
+#include <unordered_set>
+
 using namespace std;
 using openstudio::istringEqual;  // used for all name comparisons
 
@@ -56,6 +66,8 @@ namespace detail {
     : m_strictnessLevel(level),
       m_iddFileAndFactoryWrapper(iddFileType),
       m_fastNaming(false),
+      m_frozen(false),
+      m_incrementalSave(false),
       m_workspaceObjectOrder(std::shared_ptr<WorkspaceObjectOrder_Impl>(
         new WorkspaceObjectOrder_Impl(HandleVector(), std::bind(&Workspace_Impl::getObject, this, std::placeholders::_1)))) {
     m_workspaceObjectMap.reserve(1 << 15);
@@ -67,6 +79,8 @@ namespace detail {
       m_header(idfFile.header()),
       m_iddFileAndFactoryWrapper(idfFile.iddFileAndFactoryWrapper()),
       m_fastNaming(false),
+      m_frozen(false),
+      m_incrementalSave(false),
       m_workspaceObjectOrder(std::shared_ptr<WorkspaceObjectOrder_Impl>(
         new WorkspaceObjectOrder_Impl(HandleVector(), std::bind(&Workspace_Impl::getObject, this, std::placeholders::_1)))) {
     m_workspaceObjectMap.reserve(1 << 15);
@@ -78,6 +92,8 @@ namespace detail {
       m_header(other.m_header),
       m_iddFileAndFactoryWrapper(other.m_iddFileAndFactoryWrapper),
       m_fastNaming(other.fastNaming()),
+      m_frozen(false),
+      m_incrementalSave(false),
       m_workspaceObjectOrder(std::shared_ptr<WorkspaceObjectOrder_Impl>(
         new WorkspaceObjectOrder_Impl(std::bind(&Workspace_Impl::getObject, this, std::placeholders::_1)))) {
     // m_workspaceObjectOrder
@@ -98,6 +114,8 @@ namespace detail {
       m_header(),  // subset of original data--discard header
       m_iddFileAndFactoryWrapper(other.m_iddFileAndFactoryWrapper),
       m_fastNaming(other.fastNaming()),
+      m_frozen(false),
+      m_incrementalSave(false),
       m_workspaceObjectOrder(std::shared_ptr<WorkspaceObjectOrder_Impl>(
         new WorkspaceObjectOrder_Impl(hs, std::bind(&Workspace_Impl::getObject, this, std::placeholders::_1)))) {
     // m_workspaceObjectOrder
@@ -108,9 +126,10 @@ namespace detail {
     OptionalHandleVector directOrderVector = other.order().directOrder();
     if (directOrderVector) {
       // discard unused handles
+      std::unordered_set<Handle, boost::hash<boost::uuids::uuid>> subsetHandles(hs.begin(), hs.end());
       HandleVector subsetOrder;
       for (const Handle& h : *directOrderVector) {
-        if (std::find(hs.begin(), hs.end(), h) != hs.end()) {
+        if (subsetHandles.count(h) != 0) {
           subsetOrder.push_back(h);
         }
       }
@@ -140,6 +159,22 @@ namespace detail {
     return result;
   }
 
+  Workspace Workspace_Impl::freeze() const {
+    Workspace result = clone(true);
+    std::shared_ptr<Workspace_Impl> resultImpl = result.getImpl<Workspace_Impl>();
+    resultImpl->populateCaches();
+    resultImpl->m_frozen = true;
+    return result;
+  }
+
+  void Workspace_Impl::populateCaches() const {
+    m_iddFileAndFactoryWrapper.versionObject();
+    for (const WorkspaceObjectMap::value_type& p : m_workspaceObjectMap) {
+      p.second->iddObject().hasNameField();
+      p.second->populateCaches();
+    }
+  }
+
   void Workspace_Impl::swap(Workspace& other) {
     std::shared_ptr<Workspace_Impl> otherImpl = other.getImpl<Workspace_Impl>();
 
@@ -155,6 +190,10 @@ namespace detail {
     m_iddFileAndFactoryWrapper = otherImpl->m_iddFileAndFactoryWrapper;
     otherImpl->m_iddFileAndFactoryWrapper = tifafw;
 
+    bool tf = m_frozen;
+    m_frozen = otherImpl->m_frozen;
+    otherImpl->m_frozen = tf;
+
     bool tfn = m_fastNaming;
     m_fastNaming = otherImpl->m_fastNaming;
     otherImpl->m_fastNaming = tfn;
@@ -190,6 +229,10 @@ namespace detail {
     return m_strictnessLevel;
   }
 
+  bool Workspace_Impl::isFrozen() const {
+    return m_frozen;
+  }
+
   VersionString Workspace_Impl::version() const {
     return VersionString(m_iddFileAndFactoryWrapper.version());
   }
@@ -229,20 +272,26 @@ namespace detail {
     }
 
     if (sorted) {
+      // the version object is usually part of the direct order, skip it rather than falling back
+      // to sorting by position in the direct order, which is quadratic in the number of objects
       OptionalHandleVector directOrder = order().directOrder();
-      if (directOrder && (directOrder->size() == numObjects())) {
+      if (directOrder) {
         WorkspaceObjectVector result;
+        result.reserve(directOrder->size());
         HandleSet setToCheckUniqueness;
         for (const Handle& h : *directOrder) {
           OptionalWorkspaceObject owo = getObject(h);
           std::pair<HandleSet::iterator, bool> insertResult = setToCheckUniqueness.insert(h);
-          if (owo && insertResult.second && (owo->iddObject() != versionIdd.get())) {
-            result.push_back(*owo);
-          } else {
+          if (!owo || !insertResult.second) {
             return sort(objects(false));
           }
+          if (owo->iddObject() != versionIdd.get()) {
+            result.push_back(*owo);
+          }
+        }
+        if (result.size() == numObjects()) {
+          return result;
         }
-        return result;
       }
       return sort(objects(false));
     }
@@ -258,26 +307,35 @@ namespace detail {
   }
 
   std::vector<Handle> Workspace_Impl::handles(bool sorted) const {
+    HandleVector result;
+    OptionalIddObject versionIdd = m_iddFileAndFactoryWrapper.versionObject();
+    if (!versionIdd) {
+      return result;
+    }
+
     if (sorted) {
+      // the version object is usually part of the direct order, skip it rather than falling back to sort
       OptionalHandleVector directOrder = order().directOrder();
-      if (directOrder && (directOrder->size() == numObjects())) {
+      if (directOrder) {
+        result.reserve(directOrder->size());
         HandleSet setToCheckUniqueness;
         for (const Handle& h : *directOrder) {
+          auto womIt = m_workspaceObjectMap.find(h);
           std::pair<HandleSet::iterator, bool> insertResult = setToCheckUniqueness.insert(h);
-          if (!insertResult.second) {
+          if ((womIt == m_workspaceObjectMap.end()) || !insertResult.second) {
             return sort(handles(false));
           }
+          if (womIt->second->iddObject() != versionIdd.get()) {
+            result.push_back(h);
+          }
+        }
+        if (result.size() == numObjects()) {
+          return result;
         }
-        return *directOrder;
       }
       return sort(handles(false));
     }
 
-    HandleVector result;
-    OptionalIddObject versionIdd = m_iddFileAndFactoryWrapper.versionObject();
-    if (!versionIdd) {
-      return result;
-    }
     for (const WorkspaceObjectMap::value_type& p : m_workspaceObjectMap) {
       if (p.second->iddObject() != versionIdd.get()) {
         result.push_back(p.first);
@@ -358,14 +416,48 @@ namespace detail {
   }
 
   std::vector<WorkspaceObject> Workspace_Impl::getObjectsByType(IddObjectType objectType) const {
-    auto loc = m_iddObjectTypeMap.find(objectType);
-    if (loc == m_iddObjectTypeMap.end()) {
-      return WorkspaceObjectVector();
-    }
     std::vector<WorkspaceObject> result;
-    result.reserve(loc->second.size());
-    for (auto it = loc->second.begin(); it != loc->second.end(); ++it) {
-      result.push_back(it->second);
+    WorkspaceObjectImplRange range = objectImplsByType(objectType);
+    result.reserve(range.size());
+    for (const std::shared_ptr<WorkspaceObject_Impl>& objectImplPtr : range) {
+      result.push_back(WorkspaceObject(objectImplPtr));
+    }
+    return result;
+  }
+
+  const Workspace_Impl::ObjectsOfType* Workspace_Impl::objectsOfType(IddObjectType type) const {
+    auto index = static_cast<size_t>(type.value());
+    if ((index < m_iddObjectTypeMap.size()) && !m_iddObjectTypeMap[index].slotIndices.empty()) {
+      return &m_iddObjectTypeMap[index];
+    }
+    return nullptr;
+  }
+
+  WorkspaceObjectImplRange Workspace_Impl::objectImplsByType(IddObjectType objectType) const {
+    const ObjectsOfType* objects = objectsOfType(objectType);
+    if (!objects) {
+      return WorkspaceObjectImplRange();
+    }
+    const auto* begin = objects->slots.data();
+    return WorkspaceObjectImplRange(begin, begin + objects->slots.size(), objects->slotIndices.size());
+  }
+
+  std::vector<WorkspaceObjectImplRange> Workspace_Impl::objectImplsByType() const {
+    std::vector<WorkspaceObjectImplRange> result;
+    OptionalIddObject versionIdd = m_iddFileAndFactoryWrapper.versionObject();
+    if (!versionIdd) {
+      return result;
+    }
+    for (const ObjectsOfType& objects : m_iddObjectTypeMap) {
+      if (objects.slotIndices.empty()) {
+        continue;
+      }
+      const auto* begin = objects.slots.data();
+      WorkspaceObjectImplRange range(begin, begin + objects.slots.size(), objects.slotIndices.size());
+      if ((*range.begin())->iddObject() == versionIdd.get()) {
+        continue;
+      }
+      result.push_back(range);
     }
     return result;
   }
@@ -450,6 +542,10 @@ namespace detail {
   // SETTERS
 
   bool Workspace_Impl::setStrictnessLevel(StrictnessLevel level) {
+    if (m_frozen) {
+      LOG(Error, "Cannot change the strictness level of a frozen Workspace.");
+      return false;
+    }
     if (isValid(level)) {
       m_strictnessLevel = level;
       return true;
@@ -468,6 +564,45 @@ namespace detail {
     return WorkspaceObject_ImplPtr(new WorkspaceObject_Impl(*originalObjectImplPtr, this, keepHandle));
   }
 
+  std::vector<std::shared_ptr<WorkspaceObject_Impl>> Workspace_Impl::createObjects(const std::vector<IdfObject>& idfObjects, bool keepHandles) {
+    WorkspaceObject_ImplPtrVector result(idfObjects.size());
+
+    // decide serially, this also fills the lazily computed name field caches of the shared IddObjects
+    std::vector<size_t> serialIndices;
+    std::vector<size_t> concurrentIndices;
+    for (size_t i = 0, n = idfObjects.size(); i < n; ++i) {
+      if (canCreateObjectConcurrently(idfObjects[i])) {
+        concurrentIndices.push_back(i);
+      } else {
+        serialIndices.push_back(i);
+      }
+    }
+
+    // threads only pay off for larger files
+    unsigned numThreads = (concurrentIndices.size() < 1000u) ? 1u : 0u;
+    parallelFor(concurrentIndices.size(), numThreads, [&](size_t i) {
+      size_t index = concurrentIndices[i];
+      result[index] = this->createObject(idfObjects[index], keepHandles);
+    });
+
+    for (size_t index : serialIndices) {
+      result[index] = this->createObject(idfObjects[index], keepHandles);
+    }
+
+    return result;
+  }
+
+  bool Workspace_Impl::canCreateObjectConcurrently(const IdfObject& object) const {
+    // WorkspaceObject_Impl creates missing names from the other names in this workspace
+    if (object.iddObject().hasNameField()) {
+      OptionalString name = object.name(true);
+      if (name && name->empty()) {
+        return false;
+      }
+    }
+    return true;
+  }
+
   std::vector<WorkspaceObject> Workspace_Impl::addObjects(std::vector<std::shared_ptr<WorkspaceObject_Impl>>& objectImplPtrs, bool checkNames) {
     return addObjects(objectImplPtrs, UHPointerVector(), HUPointerVector(), true, false, checkNames);
   }
@@ -479,6 +614,11 @@ namespace detail {
     HandleVector newHandles;
     WorkspaceObjectVector newObjects;
 
+    if (m_frozen) {
+      LOG(Error, "Cannot add objects to a frozen Workspace.");
+      return newObjects;
+    }
+
     int i = 0;
     int N = objectImplPtrs.size();
     this->progressRange.nano_emit(0, 3 * N);
@@ -562,6 +702,11 @@ namespace detail {
                                                          const HandleMap& oldNewHandleMap, bool collectionClone,
                                                          const std::vector<UHPointer>& pointersIntoWorkspace,
                                                          const std::vector<HUPointer>& pointersFromWorkspace, bool driverMethod) {
+    if (m_frozen) {
+      LOG(Error, "Cannot add objects to a frozen Workspace.");
+      return WorkspaceObjectVector();
+    }
+
     int i = 0;
     int N = objectImplPtrs.size();
     if (oldNewHandleMap.empty()) {
@@ -660,6 +805,173 @@ namespace detail {
     return newObjects;
   }
 
+  std::vector<WorkspaceObject> Workspace_Impl::addBulkClones(const std::vector<std::shared_ptr<WorkspaceObject_Impl>>& originalObjectImplPtrs,
+                                                             bool collectionClone, bool driverMethod) {
+    if (m_frozen) {
+      LOG(Error, "Cannot add objects to a frozen Workspace.");
+      return WorkspaceObjectVector();
+    }
+
+    int i = 0;
+    int N = originalObjectImplPtrs.size();
+    this->progressRange.nano_emit(0, 3 * N);
+    this->progressValue.nano_emit(0);
+    this->progressCaption.nano_emit("Cloning Objects");
+
+    // step 1: clone objects and add them to maps, remembering where each original was
+    std::unordered_map<Handle, size_t, boost::hash<boost::uuids::uuid>> denseIndices;
+    denseIndices.reserve(N);
+    m_workspaceObjectMap.reserve(m_workspaceObjectMap.size() + N);
+    WorkspaceObject_ImplPtrVector objectImplPtrs;
+    objectImplPtrs.reserve(N);
+    HandleVector newHandles;
+    newHandles.reserve(N);
+    // reference lists of each IddObjectType, looked up once rather than once per object
+    std::vector<boost::optional<std::vector<WorkspaceObjectMap*>>> referenceMapsByType;
+    for (const WorkspaceObject_ImplPtr& originalPtr : originalObjectImplPtrs) {
+      denseIndices.insert(std::make_pair(originalPtr->handle(), objectImplPtrs.size()));
+      objectImplPtrs.push_back(createObject(originalPtr, false));
+      const WorkspaceObject_ImplPtr& ptr = objectImplPtrs.back();
+      newHandles.push_back(ptr->handle());
+      m_workspaceObjectMap.insert(WorkspaceObjectMap::value_type(newHandles.back(), ptr));
+      insertIntoIddObjectTypeMap(ptr);
+
+      IddObjectType type = ptr->iddObject().type();
+      if ((type == IddObjectType::UserCustom) || (type == IddObjectType::Catchall)) {
+        // objects of these types do not share an IddObject
+        insertIntoIdfReferencesMap(ptr);
+      } else {
+        auto typeIndex = static_cast<size_t>(type.value());
+        if (typeIndex >= referenceMapsByType.size()) {
+          referenceMapsByType.resize(typeIndex + 1);
+        }
+        boost::optional<std::vector<WorkspaceObjectMap*>>& referenceMaps = referenceMapsByType[typeIndex];
+        if (!referenceMaps) {
+          referenceMaps = std::vector<WorkspaceObjectMap*>();
+          for (const std::string& referenceName : ptr->iddObject().references()) {
+            referenceMaps->push_back(&m_idfReferencesMap[referenceName]);
+          }
+        }
+        for (WorkspaceObjectMap* referenceMap : *referenceMaps) {
+          referenceMap->insert(WorkspaceObjectMap::value_type(newHandles.back(), ptr));
+        }
+      }
+      this->progressValue.nano_emit(++i);
+    }
+
+    // step 2: remap pointers through the clones' positions
+    for (const WorkspaceObject_ImplPtr& ptr : objectImplPtrs) {
+      ptr->initializeOnBulkClone(denseIndices, objectImplPtrs);
+      this->progressValue.nano_emit(++i);
+    }
+
+    // step 3: remap orderer
+    if (m_workspaceObjectOrder.isDirectOrder()) {
+      if (collectionClone) {
+        // objects in order, just under wrong handles
+        HandleVector directOrderVector = order().directOrder().get();
+        HandleVector mappedOrder;
+        for (const Handle& h : directOrderVector) {
+          auto it = denseIndices.find(h);
+          if (it != denseIndices.end()) {
+            mappedOrder.push_back(newHandles[it->second]);
+          }
+        }
+        m_workspaceObjectOrder.setDirectOrder(mappedOrder);
+      } else {
+        // new objects not yet in order
+        for (const Handle& h : newHandles) {
+          m_workspaceObjectOrder.push_back(h);
+        }
+      }
+    }
+
+    // step 4: register initialization
+    WorkspaceObjectVector newObjects;
+    newObjects.reserve(N);
+    for (WorkspaceObject_ImplPtr& ptr : objectImplPtrs) {
+      ptr->setInitialized();
+      newObjects.push_back(WorkspaceObject(ptr));
+      this->progressValue.nano_emit(++i);
+    }
+
+    // step 5: check validity, like addClones the whole workspace is checked only if it holds nothing but the clones
+    bool ok = true;
+    StrictnessLevel level = strictnessLevel();
+    if (driverMethod && (!collectionClone || (level == StrictnessLevel::Final))) {
+      bool wholeWorkspace = (objectImplPtrs.size() == numObjects());
+      if (wholeWorkspace && (level > StrictnessLevel::Draft)) {
+        ok = isValid();
+      } else {
+        // check individual objects
+        for (const WorkspaceObject& newObject : newObjects) {
+          ok = ok && newObject.isValid(level);
+          if ((level > StrictnessLevel::Draft) && (newObject.iddObject().properties().unique)) {
+            ok = ok && (numObjectsOfType(newObject.iddObject().type()) == 1u);
+          }
+          if (!ok) {
+            break;
+          }
+        }
+        if (ok && wholeWorkspace && (level > StrictnessLevel::None)) {
+          // the rest of the Draft whole workspace check, which only needs to look at the clones
+          // DataErrorType::NoIdd
+          for (const WorkspaceObject_ImplPtr& ptr : objectImplPtrs) {
+            if (iddFileType() == IddFileType::UserCustom) {
+              ok = m_iddFileAndFactoryWrapper.isInFile(ptr->iddObject().name());
+            } else {
+              ok = m_iddFileAndFactoryWrapper.isInFile(ptr->iddObject().type());
+            }
+            if (!ok) {
+              break;
+            }
+          }
+
+          // DataErrorType::NameConflict, same rule as validityReport
+          std::unordered_map<std::string, std::vector<const WorkspaceObject_Impl*>> objectsByName;
+          for (const WorkspaceObject_ImplPtr& ptr : objectImplPtrs) {
+            OptionalString name = ptr->name();
+            if (name) {
+              objectsByName[*name].push_back(ptr.get());
+            }
+          }
+          for (const auto& namedObjects : objectsByName) {
+            const std::vector<const WorkspaceObject_Impl*>& sameName = namedObjects.second;
+            for (size_t j = 0; ok && (j < sameName.size()); ++j) {
+              for (size_t k = j + 1; ok && (k < sameName.size()); ++k) {
+                ok = intersectReferenceLists(sameName[j]->iddObject().references(), sameName[k]->iddObject().references()).empty();
+              }
+            }
+            if (!ok) {
+              LOG(Info, "Unable to add cloned objects to Workspace because more than one of them is named '" << namedObjects.first << "'.");
+              break;
+            }
+          }
+        }
+      }
+    }
+
+    // step 6: rollback if necessary
+    if (!ok) {
+      LOG(Info, "Unable to add cloned objects to Workspace. The validity report is: " << '\n' << validityReport());
+      nominallyRemoveObjects(newHandles);  // no validity check
+      for (WorkspaceObject_ImplPtr& ptr : objectImplPtrs) {
+        ptr->disconnect();
+      }
+      newObjects.clear();
+      return newObjects;
+    }
+
+    // step 7: emit signals for successful completion
+    if (driverMethod) {
+      for (const WorkspaceObject& newObject : newObjects) {
+        registerAdditionOfObject(newObject);
+      }
+    }
+
+    return newObjects;
+  }
+
   boost::optional<WorkspaceObject> Workspace_Impl::addObject(const IdfObject& idfObject) {
     WorkspaceObject_ImplPtr objectImplPtr;
 
@@ -742,10 +1054,7 @@ namespace detail {
 
     // no name conflicts---directly create and add objects
     OS_ASSERT(newObjects.empty());
-    auto it(idfObjects.begin()), itEnd(idfObjects.end());
-    for (; it != itEnd; ++it) {
-      newObjects.push_back(this->createObject(*it, keepHandles));
-    }
+    newObjects = createObjects(idfObjects, keepHandles);
     result = addObjects(newObjects, checkNames);
     if (!checkedForNameConflicts) {
       Workspace thisWorkspace = workspace();
@@ -960,15 +1269,12 @@ namespace detail {
     }
 
     // blank Workspace---directly create and add objects
-    OS_ASSERT(newObjects.empty());
-    OS_ASSERT(oldNewHandleMap.empty());
-    unsigned i(0);
+    WorkspaceObject_ImplPtrVector originalObjects;
+    originalObjects.reserve(objects.size());
     for (const WorkspaceObject& object : objects) {
-      newObjects.push_back(this->createObject(object.getImpl<WorkspaceObject_Impl>(), false));
-      oldNewHandleMap.insert(HandleMap::value_type(object.handle(), newObjects.back()->handle()));
-      ++i;
+      originalObjects.push_back(object.getImpl<WorkspaceObject_Impl>());
     }
-    result = addClones(newObjects, oldNewHandleMap, false);
+    result = addBulkClones(originalObjects, false);
 
     return result;
   }
@@ -1211,6 +1517,11 @@ namespace detail {
   }
 
   bool Workspace_Impl::swap(WorkspaceObject& currentObject, IdfObject& newObject, bool keepTargets) {
+    if (m_frozen) {
+      LOG(Error, "Cannot swap objects in a frozen Workspace.");
+      return false;
+    }
+
     // make sure currentObject is in workspace
     if (!isMember(currentObject.handle())) {
       LOG(Info, "Unable to swap objects because WorkspaceObject is not in this Workspace.");
@@ -1392,6 +1703,10 @@ namespace detail {
   }
 
   bool Workspace_Impl::removeObject(const Handle& handle) {
+    if (m_frozen) {
+      LOG(Error, "Cannot remove objects from a frozen Workspace.");
+      return false;
+    }
 
     OptionalSavedWorkspaceObject objectData = savedWorkspaceObject(handle);
     if (!objectData) {
@@ -1418,6 +1733,10 @@ namespace detail {
   }
 
   bool Workspace_Impl::removeObjects(const std::vector<Handle>& handles) {
+    if (m_frozen) {
+      LOG(Error, "Cannot remove objects from a frozen Workspace.");
+      return false;
+    }
 
     if (handles.empty()) {
       return true;
@@ -1457,11 +1776,16 @@ namespace detail {
     OS_ASSERT(owo);
     WorkspaceObject sourceObject = *owo;
 
-    // get reference lists and add targetHandle to them (ok if insert fails)
+    forwardReferences(*sourceObject.getImpl<WorkspaceObject_Impl>(), index, getObject(targetHandle)->getImpl<WorkspaceObject_Impl>());
+  }
+
+  void Workspace_Impl::forwardReferences(const WorkspaceObject_Impl& sourceObject, unsigned index,
+                                         const std::shared_ptr<WorkspaceObject_Impl>& targetObject) {
+    // get reference lists and add targetObject to them (ok if insert fails)
     OptionalIddField iddField = sourceObject.iddObject().getField(index);
     OS_ASSERT(iddField);
     for (const std::string& referenceName : iddField->properties().references) {
-      m_idfReferencesMap[referenceName].insert(std::make_pair(targetHandle, getObject(targetHandle)->getImpl<WorkspaceObject_Impl>()));
+      m_idfReferencesMap[referenceName].insert(std::make_pair(targetObject->handle(), targetObject));
     }
   }
 
@@ -1545,11 +1869,11 @@ namespace detail {
   }
 
   unsigned Workspace_Impl::numObjectsOfType(IddObjectType type) const {
-    auto iotmLoc = m_iddObjectTypeMap.find(type);
-    if (iotmLoc == m_iddObjectTypeMap.end()) {
+    const ObjectsOfType* objects = objectsOfType(type);
+    if (!objects) {
       return 0;
     }
-    return iotmLoc->second.size();
+    return objects->slotIndices.size();
   }
 
   unsigned Workspace_Impl::numObjectsOfType(const IddObject& objectType) const {
@@ -1759,9 +2083,25 @@ namespace detail {
   // SERIALIZATION
 
   bool Workspace_Impl::save(const openstudio::path& p, bool overwrite) {
+    // only where pointers are saved as handles, renaming an object changes the text of objects pointing to it otherwise
+    if (m_incrementalSave && (m_iddFileAndFactoryWrapper.iddFileType() == IddFileType::OpenStudio)) {
+      return saveIncrementally(p, overwrite);
+    }
+    m_savedText = SavedText();
     return toIdfFile().save(p, overwrite);
   }
 
+  bool Workspace_Impl::incrementalSave() const {
+    return m_incrementalSave;
+  }
+
+  void Workspace_Impl::setIncrementalSave(bool incrementalSave) {
+    m_incrementalSave = incrementalSave;
+    if (!incrementalSave) {
+      m_savedText = SavedText();
+    }
+  }
+
   IdfFile Workspace_Impl::toIdfFile() {
 
     IdfFile result;
@@ -1791,6 +2131,97 @@ namespace detail {
 
   // PRIVATE
 
+  bool Workspace_Impl::saveIncrementally(const openstudio::path& p, bool overwrite) {
+
+    // same extension handling as IdfFile::save
+    path wp(p);
+    if (getFileExtension(p) != componentFileExtension()) {
+      wp = setFileExtension(p, modelFileExtension(), false, true);
+    }
+
+    // do not overwrite if not allowed
+    if (!overwrite) {
+      path temp = completePathToFile(wp, path());
+      if (!temp.empty()) {
+        LOG(Info, "Save method failed because instructed not to overwrite path '" << toString(wp) << "'.");
+        return false;
+      }
+    }
+
+    if (!makeParentFolder(wp)) {
+      LOG(Error, "Unable to write file to path '" << toString(wp) << "', because parent directory "
+                                                  << "could not be created.");
+      return false;
+    }
+
+    // text of the last save, if the file is still as it was written
+    std::string previous;
+    if ((wp == m_savedText.path) && openstudio::filesystem::exists(wp) && (openstudio::filesystem::file_size(wp) == m_savedText.fileSize)
+        && (openstudio::filesystem::last_write_time_as_time_t(wp) == m_savedText.writeTime)) {
+      openstudio::filesystem::ifstream inFile(wp);
+      previous.assign(std::istreambuf_iterator<char>(inFile), std::istreambuf_iterator<char>());
+      if (previous.size() != m_savedText.size) {
+        previous.clear();
+      }
+    }
+    if (previous.empty()) {
+      m_savedText.objectSpans.clear();
+    }
+
+    // same layout as IdfFile::print of toIdfFile
+    std::string text;
+    text.reserve(previous.size());
+    const std::string header = makeComment(m_header);
+    if (!header.empty()) {
+      text += header;
+      text += '\n';
+    }
+    text += '\n';
+
+    WorkspaceObjectVector objs = objects(true);  // sorted objects
+    if (OptionalWorkspaceObject vo = versionObject()) {
+      objs.insert(objs.begin(), *vo);
+    }
+
+    decltype(m_savedText.objectSpans) objectSpans;
+    objectSpans.reserve(objs.size());
+    std::stringstream ss;
+    for (const WorkspaceObject& obj : objs) {
+      const std::size_t offset = text.size();
+      auto it = m_savedText.objectSpans.find(obj.handle());
+      if ((it != m_savedText.objectSpans.end()) && !obj.getImpl<WorkspaceObject_Impl>()->changedSinceSave()) {
+        text.append(previous, it->second.first, it->second.second);
+      } else {
+        ss.str(std::string());
+        obj.idfObject().print(ss);
+        text += ss.str();
+      }
+      objectSpans.emplace(obj.handle(), std::make_pair(offset, text.size() - offset));
+    }
+
+    openstudio::filesystem::ofstream outFile(wp);
+    if (outFile) {
+      outFile << text;
+      outFile.close();
+    }
+    if (!outFile) {
+      LOG(Error, "Unable to write file to path '" << toString(wp) << "'.");
+      m_savedText = SavedText();
+      return false;
+    }
+
+    m_savedText.path = wp;
+    m_savedText.size = text.size();
+    m_savedText.fileSize = openstudio::filesystem::file_size(wp);
+    m_savedText.writeTime = openstudio::filesystem::last_write_time_as_time_t(wp);
+    m_savedText.objectSpans = std::move(objectSpans);
+    for (const WorkspaceObject& obj : objs) {
+      obj.getImpl<WorkspaceObject_Impl>()->setSaved();
+    }
+
+    return true;
+  }
+
   // GETTER HELPERS
 
   HandleVector Workspace_Impl::handles(const std::set<Handle>& handles, bool sorted) const {
@@ -1955,7 +2386,13 @@ namespace detail {
   }
 
   void Workspace_Impl::insertIntoIddObjectTypeMap(const std::shared_ptr<WorkspaceObject_Impl>& objectImplPtr) {
-    m_iddObjectTypeMap[objectImplPtr->iddObject().type()].insert(std::make_pair(objectImplPtr->handle(), objectImplPtr));
+    auto index = static_cast<size_t>(objectImplPtr->iddObject().type().value());
+    if (index >= m_iddObjectTypeMap.size()) {
+      m_iddObjectTypeMap.resize(index + 1);
+    }
+    ObjectsOfType& objects = m_iddObjectTypeMap[index];
+    objects.slotIndices.insert(std::make_pair(objectImplPtr->handle(), objects.slots.size()));
+    objects.slots.push_back(objectImplPtr);
   }
 
   void Workspace_Impl::insertIntoIdfReferencesMap(const std::shared_ptr<WorkspaceObject_Impl>& objectImplPtr) {
@@ -2154,14 +2591,21 @@ namespace detail {
     }
 
     // IddObjectTypeMap
-    auto iotmLoc = m_iddObjectTypeMap.find(objectImplPtr->iddObject().type());
-    OS_ASSERT(iotmLoc != m_iddObjectTypeMap.end());
-    auto loc = iotmLoc->second.find(handle);
-    OS_ASSERT(loc != iotmLoc->second.end());
-    iotmLoc->second.erase(loc);
-    // erase entry if set is empty
-    if (iotmLoc->second.empty()) {
-      m_iddObjectTypeMap.erase(iotmLoc);
+    auto iotmIndex = static_cast<size_t>(objectImplPtr->iddObject().type().value());
+    OS_ASSERT(iotmIndex < m_iddObjectTypeMap.size());
+    ObjectsOfType& objects = m_iddObjectTypeMap[iotmIndex];
+    auto slotLoc = objects.slotIndices.find(handle);
+    OS_ASSERT(slotLoc != objects.slotIndices.end());
+    objects.slots[slotLoc->second].reset();
+    objects.slotIndices.erase(slotLoc);
+    // compact once most slots are empty, keeping the insertion order
+    if (objects.slotIndices.empty()) {
+      objects.slots.clear();
+    } else if (2 * objects.slotIndices.size() < objects.slots.size()) {
+      objects.slots.erase(std::remove(objects.slots.begin(), objects.slots.end(), nullptr), objects.slots.end());
+      for (size_t i = 0; i < objects.slots.size(); ++i) {
+        objects.slotIndices[objects.slots[i]->handle()] = i;
+      }
     }
 
     // WorkspaceObjectOrder
@@ -2348,17 +2792,23 @@ namespace detail {
 
   void Workspace_Impl::createAndAddClonedObjects(const std::shared_ptr<detail::Workspace_Impl>& thisImpl,
                                                  std::shared_ptr<detail::Workspace_Impl> cloneImpl, bool keepHandles) const {
+    detail::WorkspaceObject_ImplPtrVector objectImplPtrs;
+    objectImplPtrs.reserve(m_workspaceObjectMap.size());
+    for (const WorkspaceObjectMap::value_type& p : m_workspaceObjectMap) {
+      objectImplPtrs.push_back(p.second);
+    }
+    if (!keepHandles) {
+      // clone and remap pointers in one pass
+      cloneImpl->addBulkClones(objectImplPtrs, true);
+      return;
+    }
     detail::WorkspaceObject_ImplPtrVector newObjectImplPtrs;
-    HandleMap oldNewHandleMap;
-    for (const WorkspaceObject& object : allObjects()) {
-      newObjectImplPtrs.push_back(cloneImpl->createObject(object.getImpl<detail::WorkspaceObject_Impl>(), keepHandles));
-      Handle h = newObjectImplPtrs.back()->handle();
-      if (!keepHandles) {
-        oldNewHandleMap.insert(HandleMap::value_type(object.handle(), h));
-      }
+    newObjectImplPtrs.reserve(objectImplPtrs.size());
+    for (const WorkspaceObject_ImplPtr& objectImplPtr : objectImplPtrs) {
+      newObjectImplPtrs.push_back(cloneImpl->createObject(objectImplPtr, keepHandles));
     }
-    // add Object_ImplPtrs to clone's Workspace_Impl
-    cloneImpl->addClones(newObjectImplPtrs, oldNewHandleMap, true);
+    // add Object_ImplPtrs to clone's Workspace_Impl, handles are unchanged so there is nothing to remap
+    cloneImpl->addClones(newObjectImplPtrs, HandleMap(), true);
   }
 
   void Workspace_Impl::createAndAddSubsetClonedObjects(const std::shared_ptr<detail::Workspace_Impl>& thisImpl,
@@ -2372,22 +2822,29 @@ namespace detail {
       }
     }
 
-    // construct clone's WorkspaceObject_ImplPtrs
-    detail::WorkspaceObject_ImplPtrVector newObjectImplPtrs;
-    HandleMap oldNewHandleMap;
+    detail::WorkspaceObject_ImplPtrVector objectImplPtrs;
+    objectImplPtrs.reserve(wHandles.size());
     for (const Handle& h : wHandles) {
-      OptionalWorkspaceObject object = thisImpl->getObject(h);
-      if (object) {
-        newObjectImplPtrs.push_back(cloneImpl->createObject(object->getImpl<detail::WorkspaceObject_Impl>(), keepHandles));
-        Handle newH = newObjectImplPtrs.back()->handle();
-        if (!keepHandles) {
-          oldNewHandleMap.insert(HandleMap::value_type(h, newH));
-        }
+      auto it = thisImpl->m_workspaceObjectMap.find(h);
+      if (it != thisImpl->m_workspaceObjectMap.end()) {
+        objectImplPtrs.push_back(it->second);
       }
     }
+    if (!keepHandles) {
+      // clone and remap pointers in one pass
+      cloneImpl->addBulkClones(objectImplPtrs, true);
+      return;
+    }
 
-    // add Object_ImplPtrs to clone's Workspace_Impl
-    cloneImpl->addClones(newObjectImplPtrs, oldNewHandleMap, true);
+    // construct clone's WorkspaceObject_ImplPtrs
+    detail::WorkspaceObject_ImplPtrVector newObjectImplPtrs;
+    newObjectImplPtrs.reserve(objectImplPtrs.size());
+    for (const WorkspaceObject_ImplPtr& objectImplPtr : objectImplPtrs) {
+      newObjectImplPtrs.push_back(cloneImpl->createObject(objectImplPtr, keepHandles));
+    }
+
+    // add Object_ImplPtrs to clone's Workspace_Impl, handles are unchanged so there is nothing to remap
+    cloneImpl->addClones(newObjectImplPtrs, HandleMap(), true);
   }
 
   std::vector<WorkspaceObject> Workspace_Impl::allObjects() const {
@@ -2420,9 +2877,8 @@ Workspace::Workspace(const IdfFile& idfFile, StrictnessLevel level) : m_impl(new
   if (OptionalIdfObject vo = idfFile.versionObject()) {
     objectImplPtrs.push_back(m_impl->createObject(*vo, true));
   }
-  for (const IdfObject& idfObject : idfFile.objects()) {
-    objectImplPtrs.push_back(m_impl->createObject(idfObject, true));
-  }
+  openstudio::detail::WorkspaceObject_ImplPtrVector newObjectImplPtrs = m_impl->createObjects(idfFile.objects(), true);
+  objectImplPtrs.insert(objectImplPtrs.end(), newObjectImplPtrs.begin(), newObjectImplPtrs.end());
   // add Object_ImplPtrs to Workspace_Impl
   m_impl->addObjects(objectImplPtrs, false);
   Workspace copyOfThis(m_impl);
@@ -2442,6 +2898,10 @@ Workspace Workspace::cloneSubset(const std::vector<Handle>& handles, bool keepHa
   return result;
 }
 
+Workspace Workspace::freeze() const {
+  return m_impl->freeze();
+}
+
 void Workspace::swap(Workspace& other) {
   // Can't do typeid(*(m_impl.get())) comparison due to -Wpotentially-evaluated-expression warning with clang
   // Operator* is equivalent to *get()
@@ -2461,6 +2921,10 @@ StrictnessLevel Workspace::strictnessLevel() const {
   return m_impl->strictnessLevel();
 }
 
+bool Workspace::isFrozen() const {
+  return m_impl->isFrozen();
+}
+
 VersionString Workspace::version() const {
   return m_impl->version();
 }
@@ -2517,6 +2981,14 @@ std::vector<WorkspaceObject> Workspace::getObjectsByType(IddObjectType objectTyp
   return m_impl->getObjectsByType(objectType);
 }
 
+WorkspaceObjectImplRange Workspace::objectImplsByType(IddObjectType objectType) const {
+  return m_impl->objectImplsByType(objectType);
+}
+
+std::vector<WorkspaceObjectImplRange> Workspace::objectImplsByType() const {
+  return m_impl->objectImplsByType();
+}
+
 std::vector<WorkspaceObject> Workspace::getObjectsByType(const IddObject& objectType) const {
   return m_impl->getObjectsByType(objectType);
 }
@@ -2711,6 +3183,14 @@ bool Workspace::save(const openstudio::path& p, bool overwrite) {
   return m_impl->save(p, overwrite);
 }
 
+bool Workspace::incrementalSave() const {
+  return m_impl->incrementalSave();
+}
+
+void Workspace::setIncrementalSave(bool incrementalSave) {
+  m_impl->setIncrementalSave(incrementalSave);
+}
+
 boost::optional<Workspace> Workspace::load(const openstudio::path& p) {
   OptionalIdfFile oIdfFile = IdfFile::load(p);
   if (oIdfFile) {
@@ -2735,6 +3215,18 @@ boost::optional<Workspace> Workspace::load(const openstudio::path& p, const IddF
   return boost::none;
 }
 
+bool Workspace::saveBinary(const openstudio::path& p, bool overwrite) const {
+  return m_impl->toIdfFile().saveBinary(p, overwrite);
+}
+
+boost::optional<Workspace> Workspace::loadBinary(const openstudio::path& p) {
+  OptionalIdfFile oIdfFile = IdfFile::loadBinary(p);
+  if (oIdfFile) {
+    return Workspace(*oIdfFile);
+  }
+  return boost::none;
+}
+
 IdfFile Workspace::toIdfFile() const {
   return m_impl->toIdfFile();
 }
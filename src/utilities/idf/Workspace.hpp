@@ -37,6 +37,8 @@
 #include "../core/Logger.hpp"
 #include "../core/Path.hpp"
 
+#include <iterator>
+#include <memory>
 #include <string>
 #include <ostream>
 #include <vector>
@@ -65,6 +67,96 @@ namespace detail {
   class WorkspaceObject_Impl;
 }  // namespace detail
 
+/** Read only view of the implementation objects of one IddObjectType in a Workspace, in the order
+ *  the objects were added. Iterating the view does not allocate. The view is invalidated when
+ *  objects are added to or removed from the Workspace. */
+class WorkspaceObjectImplRange
+{
+ public:
+  typedef std::shared_ptr<detail::WorkspaceObject_Impl> value_type;
+
+  /** Iterates the slots of the range, skipping the slots of removed objects. */
+  class const_iterator
+  {
+   public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef WorkspaceObjectImplRange::value_type value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef const value_type* pointer;
+    typedef const value_type& reference;
+
+    const_iterator() = default;
+
+    const_iterator(const value_type* current, const value_type* end) : m_current(current), m_end(end) {
+      skipRemoved();
+    }
+
+    reference operator*() const {
+      return *m_current;
+    }
+
+    pointer operator->() const {
+      return m_current;
+    }
+
+    const_iterator& operator++() {
+      ++m_current;
+      skipRemoved();
+      return *this;
+    }
+
+    const_iterator operator++(int) {
+      const_iterator result(*this);
+      ++(*this);
+      return result;
+    }
+
+    bool operator==(const const_iterator& other) const {
+      return m_current == other.m_current;
+    }
+
+    bool operator!=(const const_iterator& other) const {
+      return m_current != other.m_current;
+    }
+
+   private:
+    void skipRemoved() {
+      while ((m_current != m_end) && !(*m_current)) {
+        ++m_current;
+      }
+    }
+
+    const value_type* m_current = nullptr;
+    const value_type* m_end = nullptr;
+  };
+
+  WorkspaceObjectImplRange() = default;
+
+  /** Slots in [begin, end) may be null, size is the number of non-null slots. */
+  WorkspaceObjectImplRange(const value_type* begin, const value_type* end, size_t size) : m_begin(begin), m_end(end), m_size(size) {}
+
+  const_iterator begin() const {
+    return {m_begin, m_end};
+  }
+
+  const_iterator end() const {
+    return {m_end, m_end};
+  }
+
+  size_t size() const {
+    return m_size;
+  }
+
+  bool empty() const {
+    return m_size == 0;
+  }
+
+ private:
+  const value_type* m_begin = nullptr;
+  const value_type* m_end = nullptr;
+  size_t m_size = 0;
+};
+
 /** Workspace holds a collection of interconnected \link WorkspaceObject WorkspaceObjects\endlink.
  *  Similar to IdfFile, Workspace represents data (typically a whole or partial building energy
  *  model) in EnergyPlus Input Data File (IDF) format, and each instance of Workspace is
@@ -142,6 +234,13 @@ class UTILITIES_API Workspace
    *  Virtual implementation, and similar usage to clone. */
   Workspace cloneSubset(const std::vector<Handle>& handles, bool keepHandles = false, StrictnessLevel level = StrictnessLevel::Draft) const;
 
+  /** Create a read only snapshot of this Workspace. The snapshot is a clone that keeps handles, in
+   *  which lazily cached data (e.g. surface vertices, the model's Building) has been computed up
+   *  front and all further changes are refused, so that const queries of the snapshot and of its
+   *  objects may be made from several threads at once. As with clone, a Model snapshot can be
+   *  retrieved with freeze().cast<model::Model>(). */
+  Workspace freeze() const;
+
   /** Swaps underlying data between this workspace and other. Throws if other and this
    *  are not of the same type (must both be plain Workspaces, model::Models, or
    *  model::Components). */
@@ -156,6 +255,9 @@ class UTILITIES_API Workspace
   /// Returns the strictness level under which this Workspace is currently operating.
   StrictnessLevel strictnessLevel() const;
 
+  /** Returns true if this Workspace is a read only snapshot returned by freeze. */
+  bool isFrozen() const;
+
   /** Returns the version of this model, as determined by the IddFile header. */
   VersionString version() const;
 
@@ -201,6 +303,13 @@ class UTILITIES_API Workspace
    *  IddObjectType("OS:Construction")). */
   std::vector<WorkspaceObject> getObjectsByType(IddObjectType objectType) const;
 
+  /** Returns a view of the objects of type objectType, in the order they were added, without
+   *  copying them out. Intended for tight loops such as Model::getConcreteModelObjects. */
+  WorkspaceObjectImplRange objectImplsByType(IddObjectType objectType) const;
+
+  /** Returns one view per IddObjectType present in the workspace, version objects excluded. */
+  std::vector<WorkspaceObjectImplRange> objectImplsByType() const;
+
   /** Returns all objects with .iddObject() == objectType. */
   std::vector<WorkspaceObject> getObjectsByType(const IddObject& objectType) const;
 
@@ -414,6 +523,16 @@ class UTILITIES_API Workspace
    *  and 'idf' otherwise. Returns true if the save operation is successful; false otherwise. */
   bool save(const openstudio::path& p, bool overwrite = false);
 
+  /** Returns true if save is incremental, see setIncrementalSave. */
+  bool incrementalSave() const;
+
+  /** If incrementalSave is true, save records where it wrote each object, and the next save to the
+   *  same path, if the file was not modified in between, copies the text of objects that have not
+   *  changed since instead of printing them again. The result is identical to a full save. Only
+   *  Workspaces using the OpenStudio IDD, which saves pointers as handles, are saved incrementally.
+   *  Off by default. */
+  void setIncrementalSave(bool incrementalSave);
+
   /** Load a Workspace from path using the IddFactory, and choosing iddFileType based on file
    *  extension, if possible. (IddFileType::OpenStudio if extension is modelFileExtension() or
    *  componentFileExtension(), IddFileType::EnergyPlus otherwise.) */
@@ -425,6 +544,14 @@ class UTILITIES_API Workspace
   /** Load a Workspace from path using iddFile. */
   static boost::optional<Workspace> load(const openstudio::path& p, const IddFile& iddFile);
 
+  /** Save a binary snapshot of this Workspace to path p, see IdfFile::printBinary. Snapshots are
+   *  much faster to save and load than the text form, but are only readable by builds using the
+   *  same IDD version. */
+  bool saveBinary(const openstudio::path& p, bool overwrite = false) const;
+
+  /** Load a Workspace from a binary snapshot saved by saveBinary. */
+  static boost::optional<Workspace> loadBinary(const openstudio::path& p);
+
   /** Returns an IdfFile equivalent to this Workspace. If the objects have handle fields (as in the
    *  OpenStudio IDD), pointers between objects are serialized as handles, otherwise they are
    *  serialized as names. */
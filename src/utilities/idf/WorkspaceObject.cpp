@@ -55,6 +55,8 @@ namespace detail {
   WorkspaceObject_Impl::WorkspaceObject_Impl(const IdfObject& idfObject, Workspace_Impl* workspace, bool keepHandle)
     : IdfObject_Impl(*(idfObject.getImpl<detail::IdfObject_Impl>()), keepHandle),  // clones idfObject data
       m_initialized(false),
+      m_changedSinceSave(true),
+      m_numDiffsAtSave(0),
       m_workspace(workspace) {
     if (!m_iddObject.objectLists().empty()) {
       // can nominally be source
@@ -69,6 +71,8 @@ namespace detail {
   WorkspaceObject_Impl::WorkspaceObject_Impl(const WorkspaceObject_Impl& other, Workspace_Impl* workspace, bool keepHandle)
     : IdfObject_Impl(other, keepHandle),
       m_initialized(false),
+      m_changedSinceSave(true),
+      m_numDiffsAtSave(0),
       m_workspace(workspace),
       m_sourceData(other.m_sourceData),
       m_targetData(other.m_targetData) {}
@@ -77,6 +81,10 @@ namespace detail {
 
   std::vector<IdfObject> WorkspaceObject_Impl::remove() {
     std::vector<IdfObject> result;
+    if (isReadOnly()) {
+      LOG(Error, "Cannot remove " << briefDescription() << " from a frozen Workspace.");
+      return result;
+    }
     result.push_back(this->idfObject());
     bool ok = this->workspace().removeObject(this->handle());
     OS_ASSERT(ok);
@@ -166,6 +174,34 @@ namespace detail {
     }
   }
 
+  void WorkspaceObject_Impl::initializeOnBulkClone(const std::unordered_map<Handle, size_t, boost::hash<boost::uuids::uuid>>& denseIndices,
+                                                   const std::vector<std::shared_ptr<WorkspaceObject_Impl>>& clones) {
+    OS_ASSERT(m_workspace);
+    if (m_sourceData) {
+      SourceData::pointer_set mappedPointers;
+      for (const ForwardPointer& fp : m_sourceData->pointers) {
+        Handle th;
+        auto it = denseIndices.find(fp.targetHandle);
+        if (it != denseIndices.end()) {
+          th = clones[it->second]->handle();
+          m_workspace->forwardReferences(*this, fp.fieldIndex, clones[it->second]);
+        }
+        mappedPointers.insert(mappedPointers.end(), ForwardPointer(fp.fieldIndex, th));
+      }
+      m_sourceData->pointers = mappedPointers;
+    }
+    if (m_targetData) {
+      TargetData::pointer_set mappedPointers;
+      for (const ReversePointer& rp : m_targetData->reversePointers) {
+        auto it = denseIndices.find(rp.sourceHandle);
+        if (it != denseIndices.end()) {
+          mappedPointers.insert(ReversePointer(clones[it->second]->handle(), rp.fieldIndex));
+        }
+      }
+      m_targetData->reversePointers = mappedPointers;
+    }
+  }
+
   // GETTERS
 
   Workspace_Impl* WorkspaceObject_Impl::workspaceImpl() const {
@@ -352,7 +388,7 @@ namespace detail {
   }
 
   boost::optional<std::string> WorkspaceObject_Impl::setName(const std::string& newName, bool checkValidity) {
-    if (m_handle.isNull()) {
+    if (m_handle.isNull() || isReadOnly()) {
       return boost::none;
     }
     StrictnessLevel level = m_workspace->strictnessLevel();
@@ -393,6 +429,9 @@ namespace detail {
 
   boost::optional<std::string> WorkspaceObject_Impl::createName(bool overwrite) {
     OptionalString result;
+    if (isReadOnly()) {
+      return result;
+    }
     if (OptionalUnsigned index = iddObject().nameFieldIndex()) {
       OptionalString oName = name();
       if (!oName || oName->empty() || overwrite) {
@@ -422,7 +461,7 @@ namespace detail {
 
   // Pre-condition:  Object valid at Workspace's strictness level.
   bool WorkspaceObject_Impl::setString(unsigned index, const std::string& value, bool checkValidity) {
-    if (m_handle.isNull()) {
+    if (m_handle.isNull() || isReadOnly()) {
       return false;
     }
     StrictnessLevel level = m_workspace->strictnessLevel();
@@ -505,7 +544,7 @@ namespace detail {
   }
 
   bool WorkspaceObject_Impl::setPointer(unsigned index, const Handle& targetHandle, bool checkValidity) {
-    if (m_handle.isNull()) {
+    if (m_handle.isNull() || isReadOnly()) {
       return false;
     }
 
@@ -597,7 +636,7 @@ namespace detail {
   }
 
   bool WorkspaceObject_Impl::pushString(const std::string& value, bool checkValidity) {
-    if (m_handle.isNull()) {
+    if (m_handle.isNull() || isReadOnly()) {
       return false;
     }
 
@@ -677,6 +716,9 @@ namespace detail {
 
   std::vector<std::string> WorkspaceObject_Impl::popExtensibleGroup(bool checkValidity) {
     StringVector result;
+    if (isReadOnly()) {
+      return result;
+    }
     if (!initialized()) {
       UnsignedVector olFields = iddObject().objectListFields();
       if (!olFields.empty() && iddObject().isExtensibleField(olFields.back())) {
@@ -952,6 +994,8 @@ namespace detail {
       return;
     }
 
+    m_changedSinceSave = true;
+
     bool nameChange = false;
     bool dataChange = false;
 
@@ -1009,6 +1053,15 @@ namespace detail {
     m_initialized = true;
   }
 
+  bool WorkspaceObject_Impl::changedSinceSave() const {
+    return m_changedSinceSave || (m_diffs.size() != m_numDiffsAtSave);
+  }
+
+  void WorkspaceObject_Impl::setSaved() {
+    m_changedSinceSave = false;
+    m_numDiffsAtSave = m_diffs.size();
+  }
+
   void WorkspaceObject_Impl::disconnect() {
     this->onRemoveFromWorkspace.nano_emit(m_handle);
     m_handle = Handle();
@@ -1319,6 +1372,12 @@ namespace detail {
     return result;
   }
 
+  bool WorkspaceObject_Impl::isReadOnly() const {
+    return (m_workspace != nullptr) && m_workspace->isFrozen();
+  }
+
+  void WorkspaceObject_Impl::populateCaches() const {}
+
 }  // namespace detail
 
 bool WorkspaceObject::operator<(const WorkspaceObject& right) const {
@@ -36,6 +36,10 @@
 #include <utilities/idf/IdfObject_Impl.hpp>
 #include <utilities/idf/ObjectPointer.hpp>
 
+#include <boost/functional/hash.hpp>
+
+#include <unordered_map>
+
 namespace openstudio {
 
 // forward declarations
@@ -131,6 +135,13 @@ namespace detail {
     /** Complete copy construction process by updating pointer handles. */
     virtual void initializeOnClone(const HandleMap& oldNewHandleMap);
 
+    /** Complete copy construction process when many objects are cloned at once. Pointer handles are
+     *  looked up in denseIndices, the position of each original object in the list that was cloned,
+     *  and replaced by the handle of the clone at that position. Pointers to objects that were not
+     *  cloned are nulled. */
+    virtual void initializeOnBulkClone(const std::unordered_map<Handle, size_t, boost::hash<boost::uuids::uuid>>& denseIndices,
+                                       const std::vector<std::shared_ptr<WorkspaceObject_Impl>>& clones);
+
     virtual ~WorkspaceObject_Impl();
 
     /// remove the object from the workspace
@@ -305,6 +316,13 @@ namespace detail {
     /** Denotes that this object has been initialized by Workspace_Impl. */
     void setInitialized();
 
+    /** True if this object may have changed since setSaved was last called, that is if it has
+     *  emitted or recorded any diffs since. Used by Workspace_Impl for incremental saving. */
+    bool changedSinceSave() const;
+
+    /** Denotes that the current data of this object has been saved. */
+    void setSaved();
+
     /** Disconnects this object from its workspace. Nullifies m_workspace and m_handle. */
     void disconnect();
 
@@ -335,8 +353,17 @@ namespace detail {
 
     virtual bool fieldIsNonnullIfRequired(unsigned index) const override;
 
+    virtual bool isReadOnly() const override;
+
+    /** Computes any lazily cached data of this object, called before its Workspace is frozen.
+     *  Overrides should call the base class implementation. */
+    virtual void populateCaches() const;
+
    private:
     bool m_initialized;
+    bool m_changedSinceSave;
+    // diffs still waiting to be emitted when setSaved was last called
+    std::size_t m_numDiffsAtSave;
     Workspace_Impl* m_workspace;
     OptionalSourceData m_sourceData;
     OptionalTargetData m_targetData;
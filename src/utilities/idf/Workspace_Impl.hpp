@@ -44,6 +44,7 @@
 
 #include <utilities/core/Logger.hpp>
 
+#include <ctime>
 #include <string>
 #include <ostream>
 #include <vector>
@@ -98,6 +99,10 @@ namespace detail {
      *  Virtual implementation, and similar usage to clone. */
     virtual Workspace cloneSubset(const std::vector<Handle>& handles, bool keepHandles = false, StrictnessLevel level = StrictnessLevel::Draft) const;
 
+    /** Clone this Workspace, keeping handles, into a read only Workspace whose lazily cached data
+     *  has already been computed, so that it can be queried from several threads at once. */
+    Workspace freeze() const;
+
     /** Swaps underlying data between this workspace and other. */
     virtual void swap(Workspace& other);
 
@@ -130,6 +135,9 @@ namespace detail {
     /// Get the StrictnessLevel this Workspace is currently operating under
     StrictnessLevel strictnessLevel() const;
 
+    /** True if this Workspace was returned by freeze, in which case all changes are refused. */
+    bool isFrozen() const;
+
     /** Get the version of this model, as determined by the IDD. */
     VersionString version() const;
 
@@ -175,6 +183,10 @@ namespace detail {
     /// get all idf objects by type (e.g. Zone)
     std::vector<WorkspaceObject> getObjectsByType(IddObjectType objectType) const;
 
+    WorkspaceObjectImplRange objectImplsByType(IddObjectType objectType) const;
+
+    std::vector<WorkspaceObjectImplRange> objectImplsByType() const;
+
     /// get all idf objects by full idd type
     std::vector<WorkspaceObject> getObjectsByType(const IddObject& objectType) const;
 
@@ -213,6 +225,13 @@ namespace detail {
     // Helper function to start the process of adding a cloned object to the workspace.
     virtual std::shared_ptr<WorkspaceObject_Impl> createObject(const std::shared_ptr<WorkspaceObject_Impl>& originalObjectImplPtr, bool keepHandle);
 
+    // Calls createObject for each of idfObjects, on several threads if there are many. The result is in the same order as idfObjects.
+    std::vector<std::shared_ptr<WorkspaceObject_Impl>> createObjects(const std::vector<IdfObject>& idfObjects, bool keepHandles);
+
+    // Returns false if createObject(object, keepHandle) reads or changes anything other than the new object, such as when the
+    // object has to be named. Those objects are created serially, in order, by createObjects.
+    virtual bool canCreateObjectConcurrently(const IdfObject& object) const;
+
     virtual std::vector<WorkspaceObject> addObjects(std::vector<std::shared_ptr<WorkspaceObject_Impl>>& objectImplPtrs, bool checkNames);
 
     virtual std::vector<WorkspaceObject> addObjects(std::vector<std::shared_ptr<WorkspaceObject_Impl>>& objectImplPtrs,
@@ -229,6 +248,15 @@ namespace detail {
                                                    const std::vector<UHPointer>& pointersIntoWorkspace = UHPointerVector(),
                                                    const std::vector<HUPointer>& pointersFromWorkspace = HUPointerVector(), bool driverMethod = true);
 
+    /** Clones originalObjectImplPtrs into this Workspace, which should hold no objects other than the
+     *  version object, in one pass. Pointers are remapped by the position of their target in
+     *  originalObjectImplPtrs, so no HandleMap is needed, and pointers to objects that are not cloned
+     *  become null. Validity is checked as in addClones, the whole Workspace if the clones are all of it
+     *  and object by object otherwise, except that the Draft whole Workspace check only looks at the
+     *  clones rather than building a validityReport. The directOrder (if it exists) is remapped if this is a collectionClone, otherwise the new objects' handles are pushed onto it. */
+    std::vector<WorkspaceObject> addBulkClones(const std::vector<std::shared_ptr<WorkspaceObject_Impl>>& originalObjectImplPtrs,
+                                               bool collectionClone, bool driverMethod = true);
+
     /** Add object to Workspace. */
     virtual boost::optional<WorkspaceObject> addObject(const IdfObject& idfObject);
 
@@ -321,6 +349,9 @@ namespace detail {
      *  defines references. Make sure targetHandle is listed under those reference lists. */
     void forwardReferences(const Handle& sourceHandle, unsigned index, const Handle& targetHandle);
 
+    /** Add forwarded references, for callers that already hold the source and target objects. */
+    void forwardReferences(const WorkspaceObject_Impl& sourceObject, unsigned index, const std::shared_ptr<WorkspaceObject_Impl>& targetObject);
+
     /** Remove forwarded references. Field index of sourceObject is an object list field that also
      *  defines references. That field did point to targetObject. If no other source places
      *  targetObject in those reference lists, remove the association. */
@@ -410,6 +441,10 @@ namespace detail {
      *  .idf or modelFileExtension() depending on the underlying IddFileType. */
     virtual bool save(const openstudio::path& p, bool overwrite = false);
 
+    bool incrementalSave() const;
+
+    void setIncrementalSave(bool incrementalSave);
+
     /** Creates an IdfFile from the collection, naming objects if necessary. To print out IDF text,
      *  use this method, then IdfFile.print(ostream). */
     IdfFile toIdfFile();
@@ -465,6 +500,10 @@ namespace detail {
     void change();
 
    protected:
+    /** Computes all lazily cached data, called by freeze before the Workspace becomes read only.
+     *  Overrides should call the base class implementation. */
+    virtual void populateCaches() const;
+
     // helper for non-virtual part of clone implementation
     void createAndAddClonedObjects(const std::shared_ptr<Workspace_Impl>& thisImpl, std::shared_ptr<Workspace_Impl> cloneImpl,
                                    bool keepHandles) const;
@@ -480,6 +519,20 @@ namespace detail {
     std::string m_header;                                 // header for the IdfFile
     IddFileAndFactoryWrapper m_iddFileAndFactoryWrapper;  // IDD file to be used for validity checking
     bool m_fastNaming;
+    bool m_frozen;  // set by freeze, refuses all changes afterwards
+    bool m_incrementalSave;
+
+    // text written by the last incremental save, see Workspace::setIncrementalSave
+    struct SavedText
+    {
+      openstudio::path path;
+      std::size_t size = 0;         // characters written
+      std::uintmax_t fileSize = 0;  // size and time on disk, to detect changes made by others
+      std::time_t writeTime = 0;
+      // (offset, length) of each object's text
+      std::unordered_map<Handle, std::pair<std::size_t, std::size_t>, boost::hash<boost::uuids::uuid>> objectSpans;
+    };
+    SavedText m_savedText;
 
     typedef std::unordered_map<Handle, std::shared_ptr<WorkspaceObject_Impl>, boost::hash<boost::uuids::uuid>> WorkspaceObjectMap;
     WorkspaceObjectMap m_workspaceObjectMap;
@@ -487,10 +540,23 @@ namespace detail {
     // object for ordering objects in the collection.
     WorkspaceObjectOrder m_workspaceObjectOrder;
 
-    // map of IddObjectType to set of objects identified by UUID
-    typedef std::map<IddObjectType, WorkspaceObjectMap> IddObjectTypeMap;
+    // objects of one IddObjectType in the order they were added, removed objects leave a null slot
+    // until more than half of the slots are null
+    struct ObjectsOfType
+    {
+      std::vector<std::shared_ptr<WorkspaceObject_Impl>> slots;
+      std::unordered_map<Handle, size_t, boost::hash<boost::uuids::uuid>> slotIndices;
+    };
+
+    // objects by IddObjectType::value()
+    typedef std::vector<ObjectsOfType> IddObjectTypeMap;
     IddObjectTypeMap m_iddObjectTypeMap;
 
+    const ObjectsOfType* objectsOfType(IddObjectType type) const;
+
+    /** Save that copies the text of objects that have not changed from the last incremental save. */
+    bool saveIncrementally(const openstudio::path& p, bool overwrite);
+
     // map of reference to set of objects identified by UUID
     typedef std::unordered_map<std::string, WorkspaceObjectMap> IdfReferencesMap;  // , IstringCompare
     IdfReferencesMap m_idfReferencesMap;
@@ -45,6 +45,9 @@
 
 #include "../core/Assert.hpp"
 
+#include <algorithm>
+#include <cmath>
+
 namespace openstudio {
 
 boost::optional<Quantity> QuantityConverterSingleton::convert(const Quantity& q, UnitSystem sys) const {
@@ -117,6 +120,118 @@ boost::optional<Quantity> QuantityConverterSingleton::convert(const Quantity& or
   return result;
 }
 
+boost::optional<double> QuantityConverterSingleton::convert(double original, const std::string& originalUnits,
+                                                            const std::string& finalUnits) const {
+  if (originalUnits == finalUnits) {
+    return original;
+  }
+
+  CachedConversion conversion = m_cachedConversion(originalUnits, finalUnits);
+  if (!conversion.valid) {
+    return boost::none;
+  }
+  if (conversion.affine) {
+    return conversion.factor * original + conversion.offset;
+  }
+  return m_convertUncached(original, originalUnits, finalUnits);
+}
+
+std::vector<double> QuantityConverterSingleton::convert(const std::vector<double>& original, const std::string& originalUnits,
+                                                        const std::string& finalUnits) const {
+  if (originalUnits == finalUnits) {
+    return original;
+  }
+
+  std::vector<double> result;
+  CachedConversion conversion = m_cachedConversion(originalUnits, finalUnits);
+  if (!conversion.valid) {
+    return result;
+  }
+
+  result.resize(original.size());
+  if (conversion.affine) {
+    // simple enough for the compiler to vectorize
+    const double factor = conversion.factor;
+    const double offset = conversion.offset;
+    const double* in = original.data();
+    double* out = result.data();
+    const size_t n = original.size();
+    for (size_t i = 0; i < n; ++i) {
+      out[i] = factor * in[i] + offset;
+    }
+  } else {
+    for (size_t i = 0; i < original.size(); ++i) {
+      boost::optional<double> value = m_convertUncached(original[i], originalUnits, finalUnits);
+      if (!value) {
+        return std::vector<double>();
+      }
+      result[i] = *value;
+    }
+  }
+  return result;
+}
+
+QuantityConverterSingleton::CachedConversion QuantityConverterSingleton::m_cachedConversion(const std::string& originalUnits,
+                                                                                            const std::string& finalUnits) const {
+  {
+    std::shared_lock<std::shared_mutex> lock(m_conversionCacheMutex);
+    auto it = m_conversionCache.find(originalUnits);
+    if (it != m_conversionCache.end()) {
+      auto jt = it->second.find(finalUnits);
+      if (jt != it->second.end()) {
+        return jt->second;
+      }
+    }
+  }
+
+  // fit factor and offset from two values, then check the fit against values away from them
+  CachedConversion conversion;
+  boost::optional<double> offset = m_convertUncached(0.0, originalUnits, finalUnits);
+  boost::optional<double> factorPlusOffset = m_convertUncached(1.0, originalUnits, finalUnits);
+  if (offset && factorPlusOffset) {
+    conversion.valid = true;
+    conversion.factor = *factorPlusOffset - *offset;
+    conversion.offset = *offset;
+    conversion.affine = true;
+    for (double probe : {-37.0, 3.5, 1000.0}) {
+      boost::optional<double> expected = m_convertUncached(probe, originalUnits, finalUnits);
+      double fit = conversion.factor * probe + conversion.offset;
+      if (!expected || std::abs(fit - *expected) > 1.0e-9 * std::max(1.0, std::abs(*expected))) {
+        conversion.affine = false;
+        break;
+      }
+    }
+  }
+
+  std::unique_lock<std::shared_mutex> lock(m_conversionCacheMutex);
+  m_conversionCache[originalUnits][finalUnits] = conversion;
+  return conversion;
+}
+
+boost::optional<double> QuantityConverterSingleton::m_convertUncached(double original, const std::string& originalUnits,
+                                                                      const std::string& finalUnits) const {
+  //create the units from the strings
+  boost::optional<Unit> originalUnit = UnitFactory::instance().createUnit(originalUnits);
+  boost::optional<Unit> finalUnit = UnitFactory::instance().createUnit(finalUnits);
+
+  //make sure both unit strings were valid
+  if (originalUnit && finalUnit) {
+
+    //make the original quantity
+    Quantity originalQuant = Quantity(original, *originalUnit);
+
+    //convert to final units
+    boost::optional<Quantity> finalQuant = convert(originalQuant, *finalUnit);
+
+    //if the conversion
+    if (finalQuant) {
+      return finalQuant->value();
+    }
+  }
+
+  return boost::none;
+}
+
 QuantityConverterSingleton::QuantityConverterSingleton() {
   // initialize the quantity converter maps here
 
@@ -469,30 +584,11 @@ boost::optional<Quantity> QuantityConverterSingleton::m_convertToTargetFromSI(co
 }
 
 boost::optional<double> convert(double original, const std::string& originalUnits, const std::string& finalUnits) {
-  if (originalUnits == finalUnits) {
-    return original;
-  }
-
-  //create the units from the strings
-  boost::optional<Unit> originalUnit = UnitFactory::instance().createUnit(originalUnits);
-  boost::optional<Unit> finalUnit = UnitFactory::instance().createUnit(finalUnits);
-
-  //make sure both unit strings were valid
-  if (originalUnit && finalUnit) {
-
-    //make the original quantity
-    Quantity originalQuant = Quantity(original, *originalUnit);
-
-    //convert to final units
-    boost::optional<Quantity> finalQuant = QuantityConverter::instance().convert(originalQuant, *finalUnit);
-
-    //if the conversion
-    if (finalQuant) {
-      return finalQuant->value();
-    }
-  }
+  return QuantityConverter::instance().convert(original, originalUnits, finalUnits);
+}
 
-  return boost::none;
+std::vector<double> convert(const std::vector<double>& original, const std::string& originalUnits, const std::string& finalUnits) {
+  return QuantityConverter::instance().convert(original, originalUnits, finalUnits);
 }
 
 boost::optional<Quantity> convert(const Quantity& original, UnitSystem sys) {
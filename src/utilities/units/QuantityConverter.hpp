@@ -37,6 +37,8 @@
 #include "Unit.hpp"
 #include <string>
 #include <map>
+#include <shared_mutex>
+#include <vector>
 
 namespace openstudio {
 
@@ -100,10 +102,37 @@ class UTILITIES_API QuantityConverterSingleton
 
   boost::optional<Quantity> convert(const Quantity& original, const Unit& targetUnits) const;
 
+  /** Converts original from originalUnits to finalUnits. Affine conversions are computed once per
+   *  pair of unit strings and then applied as factor * original + offset. */
+  boost::optional<double> convert(double original, const std::string& originalUnits, const std::string& finalUnits) const;
+
+  /** Converts each value in original from originalUnits to finalUnits. Returns an empty vector if
+   *  the units cannot be converted. */
+  std::vector<double> convert(const std::vector<double>& original, const std::string& originalUnits, const std::string& finalUnits) const;
+
  private:
   REGISTER_LOGGER("openstudio.units.QuantityConverter");
   QuantityConverterSingleton();
 
+  /** Result of converting between two unit strings. If affine is false the conversion has to go
+   *  through Quantity for each value, as it does for absolute temperatures raised to a power. */
+  struct CachedConversion
+  {
+    bool valid = false;
+    bool affine = false;
+    double factor = 1.0;
+    double offset = 0.0;
+  };
+
+  typedef std::map<std::string, std::map<std::string, CachedConversion, std::less<>>, std::less<>> ConversionCache;
+
+  mutable ConversionCache m_conversionCache;
+  mutable std::shared_mutex m_conversionCacheMutex;
+
+  CachedConversion m_cachedConversion(const std::string& originalUnits, const std::string& finalUnits) const;
+
+  boost::optional<double> m_convertUncached(double original, const std::string& originalUnits, const std::string& finalUnits) const;
+
   typedef std::map<std::string, baseUnitConversionFactor> BaseUnitConversionMap;
   typedef std::multimap<UnitSystem, baseUnitConversionFactor> UnitSystemConversionMultiMap;
 
@@ -123,6 +152,10 @@ typedef openstudio::Singleton<QuantityConverterSingleton> QuantityConverter;
 /** Non-member function to simplify interface for users. \relates QuantityConverterSingleton */
 UTILITIES_API boost::optional<double> convert(double original, const std::string& originalUnits, const std::string& finalUnits);
 
+/** Non-member function that converts an entire vector of values at once, returns an empty vector
+ *  if the units cannot be converted. \relates QuantityConverterSingleton */
+UTILITIES_API std::vector<double> convert(const std::vector<double>& original, const std::string& originalUnits, const std::string& finalUnits);
+
 /** Non-member function to simplify interface for users. \relates QuantityConverterSingleton */
 UTILITIES_API boost::optional<Quantity> convert(const Quantity& original, UnitSystem sys);
 
@@ -255,6 +255,43 @@ TEST_F(UnitsFixture, QuantityConverter_OSQuantityVector) {
   EXPECT_TRUE(resultQ->isRelative());
 }
 
+TEST_F(UnitsFixture, QuantityConverter_StringUnits) {
+  // cached conversions give the same values as going through Quantity every time
+  std::vector<std::pair<std::string, std::string>> unitPairs{
+    {"ft", "m"}, {"Btu/h", "W"}, {"W/m^2", "W/ft^2"}, {"C", "F"}, {"F", "C"}, {"K", "C"}, {"ft^3/min", "m^3/s"}};
+  std::vector<double> values{-40.0, 0.0, 1.0, 20.0, 12345.678};
+  for (const auto& unitPair : unitPairs) {
+    std::vector<double> converted = convert(values, unitPair.first, unitPair.second);
+    ASSERT_EQ(values.size(), converted.size()) << unitPair.first << " to " << unitPair.second;
+
+    boost::optional<Unit> originalUnit = UnitFactory::instance().createUnit(unitPair.first);
+    boost::optional<Unit> finalUnit = UnitFactory::instance().createUnit(unitPair.second);
+    ASSERT_TRUE(originalUnit);
+    ASSERT_TRUE(finalUnit);
+    for (size_t i = 0; i < values.size(); ++i) {
+      OptionalQuantity expected = convert(Quantity(values[i], *originalUnit), *finalUnit);
+      ASSERT_TRUE(expected);
+      boost::optional<double> value = convert(values[i], unitPair.first, unitPair.second);
+      ASSERT_TRUE(value);
+      EXPECT_NEAR(expected->value(), *value, 1.0E-9 * std::max(1.0, std::abs(expected->value())));
+      EXPECT_DOUBLE_EQ(*value, converted[i]);
+    }
+  }
+
+  EXPECT_NEAR(32.0, convert(0.0, "C", "F").get(), tol);
+  EXPECT_NEAR(212.0, convert(100.0, "C", "F").get(), tol);
+
+  // invalid conversions are cached as well
+  for (unsigned i = 0; i < 2; ++i) {
+    EXPECT_FALSE(convert(1.0, "ft", "W"));
+    EXPECT_TRUE(convert(values, "ft", "W").empty());
+    EXPECT_FALSE(convert(1.0, "notAUnit", "m"));
+  }
+
+  EXPECT_TRUE(convert(std::vector<double>(), "ft", "m").empty());
+  EXPECT_TRUE(values == convert(values, "notAUnit", "notAUnit"));
+}
+
 TEST_F(UnitsFixture, QuantityConverter_Profiling_QuantityVectorBaseCase) {
   QuantityVector result(testQuantityVector);
   for (auto& elem : result) {